@@ -1,8 +1,9 @@
 #include "Engine/Engine.h"
 
+#include <algorithm>
+
 Engine::Engine()
 {
-	m_layers.reserve(4);
 }
 
 Engine::Engine(const Engine& other)
@@ -17,6 +18,7 @@ Engine& Engine::operator=(const Engine& other)
 Engine::Engine(const EngineLimits& limits)
 {
 	m_limits = limits;
+	m_systemLayer.setLimits(limits);
 }
 
 Engine::~Engine()
@@ -26,38 +28,79 @@ Engine::~Engine()
 
 bool Engine::startUp()
 {
-	m_layers.push_back(&m_systemLayer);
-	m_layers.push_back(&m_resourceLayer);
-	m_layers.push_back(&m_moduleLayer);
-	m_layers.push_back(&m_contentLayer);
+	if (!m_limits.isValid())
+	{
+		return false;
+	}
 
-	for (Layer* pLayer : m_layers)
+	if (m_startupGraph.getNumTasks() == 0)
 	{
-		if (pLayer->startLayerUp() == LayerResponses::START_UP_FAILED)
-		{
-			return false;
-		}
+		// Each layer builds on the one below it
+		const StartupTaskId systemTask = addLayer("SystemLayer", m_systemLayer, {});
+		const StartupTaskId resourceTask = addLayer("ResourceLayer", m_resourceLayer,
+			{ systemTask });
+		const StartupTaskId moduleTask = addLayer("ModuleLayer", m_moduleLayer,
+			{ resourceTask });
+		addLayer("ContentLayer", m_contentLayer, { moduleTask });
 	}
 
-	return true;
+	return m_startupGraph.startUp(m_limits.uiNumStartUpThreads);
 }
 
 bool Engine::shutDown()
 {
-	for (Layer* pLayer : m_layers)
-	{
-		if (pLayer->shutLayerDown() == LayerResponses::SHUT_DOWN_FAILED)
-		{
-			return false;
-		}
-	}
-	m_layers.clear();
-
-	return true;
+	return m_startupGraph.shutDown(m_limits.uiNumStartUpThreads);
 }
 
 void Engine::run()
 {
 	// Wont enable this for now since there is no way to stop it yet
 	// m_systemLayer.startScheduler();
+}
+
+std::vector<StartupTiming> Engine::getStartupTimings() const
+{
+	std::vector<StartupTiming> timings = m_startupGraph.getTimings();
+	for (StartupTiming timing : m_systemLayer.getSubsystemTimings())
+	{
+		timing.sName = "SystemLayer/" + timing.sName;
+		timings.push_back(std::move(timing));
+	}
+
+	std::stable_sort(timings.begin(), timings.end(), [](const StartupTiming& first,
+		const StartupTiming& second)
+	{
+		return first.dStartSeconds < second.dStartSeconds;
+	});
+
+	return timings;
+}
+
+void Engine::writeStartupReport(std::ostream& stream) const
+{
+	::writeStartupReport(stream, getStartupTimings());
+}
+
+void Engine::writeStartupTrace(std::ostream& stream) const
+{
+	::writeStartupTrace(stream, getStartupTimings());
+}
+
+void Engine::writeMemoryReport(std::ostream& stream) const
+{
+	m_systemLayer.getMemoryTags().writeReport(stream);
+}
+
+StartupTaskId Engine::addLayer(const std::string& sName, Layer& layer,
+	const std::vector<StartupTaskId>& dependencies)
+{
+	return m_startupGraph.addTask(sName, [&layer]()
+	{
+		return layer.startLayerUp() != LayerResponses::START_UP_FAILED;
+	},
+	[&layer]()
+	{
+		return layer.shutLayerDown() != LayerResponses::SHUT_DOWN_FAILED;
+	},
+	dependencies);
 }
\ No newline at end of file
@@ -1,7 +1,14 @@
 /**
 The engine.
 
-@date edited 28/11/2016
+The layers are started up through a startup graph, each after the layers it depends on, and shut
+down in the reverse order. Layers that do not depend on each other start concurrently.
+
+The wall time, CPU time, allocations and peak resident memory growth of starting up and shutting
+down each layer and subsystem are recorded, and may be written out as a report or a trace. The
+memory used by each subsystem may be written out as a report at any time.
+
+@date edited 18/10/2026
 @date authored 10/09/2016
 
 @author Nathan Sainsbury */
@@ -9,6 +16,8 @@ The engine.
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include <ostream>
+#include <string>
 #include <vector>
 
 #include "Engine/Layer/Layer.h"
@@ -17,6 +26,7 @@ The engine.
 #include "Engine/Layer/Module/ModuleLayer.h"
 #include "Engine/Layer/Content/ContentLayer.h"
 #include "Engine/EngineLimits.h"
+#include "Engine/System/Schedule/StartupGraph.h"
 
 class Engine
 {
@@ -32,7 +42,8 @@ class Engine
 
 		/**
 		Starts up the engine. 
-		@return True if the start up was successful, false if it was not */
+		@return True if the start up was successful, false if it was not or the limits were not
+		valid */
 		bool startUp();
 
 		/**
@@ -45,16 +56,48 @@ class Engine
 		function. */
 		void run();
 
+		/**
+		Retrieves the timings of the most recent start up and shut down of each layer and
+		subsystem, ordered by when they began. Subsystems are named after their layer, such as
+		"SystemLayer/FileWatcher".
+		@return The timings */
+		std::vector<StartupTiming> getStartupTimings() const;
+
+		/**
+		Writes the startup timings as a plain text report.
+		@param stream The stream to write to */
+		void writeStartupReport(std::ostream& stream) const;
+
+		/**
+		Writes the startup timings as a trace in the Chrome trace event format.
+		@param stream The stream to write to */
+		void writeStartupTrace(std::ostream& stream) const;
+
+		/**
+		Writes the current usage, peak usage and budget of each subsystem's memory tag as a plain
+		text report.
+		@param stream The stream to write to */
+		void writeMemoryReport(std::ostream& stream) const;
+
 	protected:
 
 	private:
-		std::vector<Layer*> m_layers;
+		StartupGraph m_startupGraph;
 		EngineLimits m_limits;
 		SystemLayer m_systemLayer;
 		ResourceLayer m_resourceLayer;
 		ModuleLayer m_moduleLayer;
 		ContentLayer m_contentLayer;
 
+		/**
+		Adds a layer to the startup graph.
+		@param sName The name of the layer
+		@param layer The layer
+		@param dependencies The layers that must start before this one
+		@return The id of the layer's task */
+		StartupTaskId addLayer(const std::string& sName, Layer& layer,
+			const std::vector<StartupTaskId>& dependencies);
+
 		/**
 		Forbidden. Engine limits should always be given. */
 		Engine();
@@ -2,7 +2,10 @@
 An engine limits structure is used during engine initialisation to specify a series of properties
 regarding the desired configuration of the engines components.
 
-@date edited 31/01/2017
+Capacities are budgets. Each subsystem reserves room for its budget when it starts up, so that
+staying within the budgets lets every frame run without allocating from the heap.
+
+@date edited 18/10/2026
 @date authored 10/09/2016
 
 @author Nathan Sainsbury */
@@ -10,8 +13,82 @@ regarding the desired configuration of the engines components.
 #ifndef ENGINE_LIMITS_H
 #define ENGINE_LIMITS_H
 
+#include <cstdint>
+
+#include "Engine/System/Memory/AllocationCounter.h"
+
 struct EngineLimits
 {
+	/**
+	The maximum number of threads used to start up and shut down the engine's layers and
+	subsystems, including the calling thread. 0 uses one thread per hardware thread. */
+	std::uint32_t uiNumStartUpThreads;
+
+	/**
+	Runs without a window or graphics context, for dedicated servers and benchmark jobs on
+	machines without a display. */
+	bool bHeadless;
+
+	/**
+	The number of scheduled items the scheduler reserves room for, including the engine's own. */
+	std::uint32_t uiMaxScheduledItems;
+
+	/**
+	The number of scheduler listeners the scheduler reserves room for. */
+	std::uint32_t uiMaxSchedulerListeners;
+
+	/**
+	The number of asynchronous file reads that may be in flight before their completions need
+	more room. */
+	std::uint32_t uiMaxFileReads;
+
+	/**
+	The number of file changes that may be delivered in a single frame before they need more
+	room. */
+	std::uint32_t uiMaxFileChanges;
+
+	/**
+	The number of bytes of scratch memory scheduled items may use each frame before it comes from
+	the heap. */
+	std::uint32_t uiFrameArenaBytes;
+
+	/**
+	The number of bytes of scratch memory that lives for two frames scheduled items may use each
+	frame before it comes from the heap. Twice this is reserved. */
+	std::uint32_t uiTwoFrameArenaBytes;
+
+	/**
+	The number of bytes of scratch memory each worker thread may use each frame before it comes
+	from the heap. */
+	std::uint32_t uiThreadFrameArenaBytes;
+
+	/**
+	The number of task system worker threads. 0 uses one fewer than the number of hardware
+	threads, leaving one for the scheduler. */
+	std::uint32_t uiNumTaskWorkers;
+
+	/**
+	The number of tasks each thread may have waiting to run before it runs them itself. */
+	std::uint32_t uiMaxTasksPerThread;
+
+	/**
+	The number of threads other than the task system's workers that may submit tasks to it,
+	including the scheduler's thread. Further threads run their tasks themselves. */
+	std::uint32_t uiMaxTaskThreads;
+
+	/**
+	Pins each task system worker to its own hardware thread. */
+	bool bPinTaskWorkers;
+
+	/**
+	Counts and reports every scheduler frame that allocates from the heap once the warm up frames
+	have run. Requires stat tracking. */
+	bool bCheckFrameAllocations;
+
+	/**
+	The number of scheduler frames to run before checking for allocations. */
+	std::uint32_t uiAllocationWarmUpFrames;
+
 	/**
 	Constructs a default engine limits structure. */
 	EngineLimits()
@@ -23,6 +100,21 @@ struct EngineLimits
 	Sets all fields to their default values. */
 	void setToDefaults()
 	{
+		uiNumStartUpThreads = 0;
+		bHeadless = false;
+		uiMaxScheduledItems = 64;
+		uiMaxSchedulerListeners = 16;
+		uiMaxFileReads = 256;
+		uiMaxFileChanges = 256;
+		uiFrameArenaBytes = 4 * 1024 * 1024;
+		uiTwoFrameArenaBytes = 1024 * 1024;
+		uiThreadFrameArenaBytes = 256 * 1024;
+		uiNumTaskWorkers = 0;
+		uiMaxTasksPerThread = 4096;
+		uiMaxTaskThreads = 4;
+		bPinTaskWorkers = false;
+		bCheckFrameAllocations = false;
+		uiAllocationWarmUpFrames = 60;
 	}
 
 	/**
@@ -30,7 +122,10 @@ struct EngineLimits
 	@return True if the limits were valid, false otherwise */
 	bool isValid() const
 	{
-		return true;
+		// The system layer schedules the file reader and the file watcher itself
+		return uiMaxScheduledItems >= 2 && uiMaxFileReads > 0 && uiMaxFileChanges > 0 &&
+			uiMaxTasksPerThread > 0 &&
+			(!bCheckFrameAllocations || AllocationCounter::isEnabled());
 	}
 };
 
@@ -2,11 +2,80 @@
 
 SystemLayer::SystemLayer()
 {
+	m_subsystems.addTask("Scheduler", [this]()
+	{
+		m_scheduler.reserve(m_limits.uiMaxScheduledItems, m_limits.uiMaxSchedulerListeners);
+
+		SchedulerConfig config = m_scheduler.getPendingConfig();
+		config.bCheckFrameAllocations = m_limits.bCheckFrameAllocations;
+		config.uiAllocationWarmUpFrames = m_limits.uiAllocationWarmUpFrames;
+		m_scheduler.setConfig(config);
+
+		// Each tag's budget is the arena's reserved room, so spilling on to the heap warns
+		m_frameArena.setTag(&m_memoryTags.add("FrameArena", m_limits.uiFrameArenaBytes));
+		m_twoFrameArena.setTag(&m_memoryTags.add("TwoFrameArena",
+			2 * (size_t)m_limits.uiTwoFrameArenaBytes));
+		m_threadArenas.setTag(&m_memoryTags.add("ThreadFrameArenas"));
+
+		m_frameArena.reserve(m_limits.uiFrameArenaBytes, 1);
+		m_twoFrameArena.reserve(m_limits.uiTwoFrameArenaBytes, 2);
+		m_threadArenas.reserve(m_limits.uiThreadFrameArenaBytes, 1);
+
+		FrameMemory frameMemory;
+		frameMemory.pFrameArena = &m_frameArena;
+		frameMemory.pTwoFrameArena = &m_twoFrameArena;
+		frameMemory.pThreadArenas = &m_threadArenas;
+		m_scheduler.setFrameMemory(frameMemory);
+		m_scheduler.setTaskSystem(&m_taskSystem);
+		return true;
+	});
+
+	m_subsystems.addTask("TaskSystem", [this]()
+	{
+		return m_taskSystem.start(m_limits.uiNumTaskWorkers, m_limits.uiMaxTasksPerThread,
+			m_limits.uiMaxTaskThreads, m_limits.bPinTaskWorkers);
+	},
+	[this]()
+	{
+		m_taskSystem.stop();
+		return true;
+	});
+
+	m_subsystems.addTask("AsyncFileReader", [this]()
+	{
+		m_fileReader.reserve(m_limits.uiMaxFileReads);
+		return m_fileReader.start();
+	},
+	[this]()
+	{
+		m_fileReader.stop();
+		return true;
+	});
+
+	m_subsystems.addTask("FileWatcher", [this]()
+	{
+		m_fileWatcher.reserve(m_limits.uiMaxFileChanges);
+		return m_fileWatcher.start();
+	},
+	[this]()
+	{
+		m_fileWatcher.stop();
+		return true;
+	});
 }
 
 LayerResponses SystemLayer::startLayerUp()
 {
 	// Initialise each subsystem according to their unique specifications
+	if (!m_subsystems.startUp(m_limits.uiNumStartUpThreads))
+	{
+		m_subsystems.shutDown(m_limits.uiNumStartUpThreads);
+		return LayerResponses::START_UP_FAILED;
+	}
+
+	// The scheduler is not thread safe, so items are only added once every subsystem has started
+	m_scheduler.addScheduledItem(&m_fileReader, SchedulerRate(SchedulerRatePresets::UNLIMITED));
+	m_scheduler.addScheduledItem(&m_fileWatcher, SchedulerRate(SchedulerRatePresets::UNLIMITED));
 
 	return LayerResponses::START_UP_SUCCESS;
 }
@@ -14,10 +83,27 @@ LayerResponses SystemLayer::startLayerUp()
 LayerResponses SystemLayer::shutLayerDown()
 {
 	// Shut down each subsystem
+	m_scheduler.removeScheduledItem(&m_fileWatcher);
+	m_scheduler.removeScheduledItem(&m_fileReader);
+
+	if (!m_subsystems.shutDown(m_limits.uiNumStartUpThreads))
+	{
+		return LayerResponses::SHUT_DOWN_FAILED;
+	}
 
 	return LayerResponses::SHUT_DOWN_SUCCESS;
 }
 
+void SystemLayer::setLimits(const EngineLimits& limits)
+{
+	m_limits = limits;
+}
+
+const std::vector<StartupTiming>& SystemLayer::getSubsystemTimings() const
+{
+	return m_subsystems.getTimings();
+}
+
 void SystemLayer::setSchedulerConfig(const SchedulerConfig& config)
 {
 	m_scheduler.setConfig(config);
@@ -76,4 +162,34 @@ void SystemLayer::removeSchedulerListener(SchedulerListener* const pListener)
 bool SystemLayer::schedulerListenerExists(SchedulerListener* const pListener) const
 {
 	return m_scheduler.schedulerListenerExists(pListener);
+}
+
+AsyncFileReader& SystemLayer::getFileReader()
+{
+	return m_fileReader;
+}
+
+FileWatcher& SystemLayer::getFileWatcher()
+{
+	return m_fileWatcher;
+}
+
+ThreadFrameArenas& SystemLayer::getThreadFrameArenas()
+{
+	return m_threadArenas;
+}
+
+TaskSystem& SystemLayer::getTaskSystem()
+{
+	return m_taskSystem;
+}
+
+MemoryTags& SystemLayer::getMemoryTags()
+{
+	return m_memoryTags;
+}
+
+const MemoryTags& SystemLayer::getMemoryTags() const
+{
+	return m_memoryTags;
 }
\ No newline at end of file
@@ -4,7 +4,19 @@ The system layer.
 This layer is responsible for the ownership of a series of "subsystems" that provide very basic
 functionality that does not directly depend on any other system.
 
-@date edited 31/01/2017
+Subsystems are started through a startup graph, so those that do not depend on each other start
+concurrently, and are shut down in the reverse order. Subsystems reserve room for the budgets in
+the engine limits as they start, so the scheduler's frames need not allocate. The cost of starting
+up and shutting down each subsystem is recorded as a startup timing.
+
+The layer owns the frame arenas handed to scheduled items through their time info, for scratch
+memory that is released at the end of every scheduler frame. The memory used by each arena is
+accounted for by a memory tag, which warns when the arena runs out of room.
+
+The layer also owns the task system, which scheduled items reach through their time info to fan
+work out across the worker threads.
+
+@date edited 18/10/2026
 @date authored 10/09/2016
 
 @author Nathan Sainsbury */
@@ -13,15 +25,33 @@ functionality that does not directly depend on any other system.
 #define SYSTEM_LAYER_H
 
 #include <string>
+#include <vector>
 
+#include "Engine/EngineLimits.h"
 #include "Engine/Layer/Layer.h"
+#include "Engine/System/File/AsyncFileReader.h"
+#include "Engine/System/File/FileWatcher.h"
+#include "Engine/System/Memory/FrameArena.h"
+#include "Engine/System/Memory/MemoryTags.h"
+#include "Engine/System/Memory/ThreadFrameArenas.h"
 #include "Engine/System/Schedule/Scheduler.h"
+#include "Engine/System/Schedule/StartupGraph.h"
+#include "Engine/System/Thread/TaskSystem.h"
 
 class SystemLayer : 
 	public Layer
 {
 	private:
+		MemoryTags m_memoryTags;
 		Scheduler m_scheduler;
+		FrameArena m_frameArena;
+		FrameArena m_twoFrameArena;
+		ThreadFrameArenas m_threadArenas;
+		TaskSystem m_taskSystem;
+		AsyncFileReader m_fileReader;
+		FileWatcher m_fileWatcher;
+		StartupGraph m_subsystems;
+		EngineLimits m_limits;
 
 	protected:
 
@@ -40,6 +70,17 @@ class SystemLayer :
 		@return A layer response indicating the result of the operation */
 		LayerResponses shutLayerDown();
 
+		/**
+		Sets the limits the subsystems are started up with. Each subsystem reserves room for its
+		budget when the layer starts up.
+		@param limits The limits */
+		void setLimits(const EngineLimits& limits);
+
+		/**
+		Retrieves the timings of the most recent start up and shut down of each subsystem.
+		@return The timings */
+		const std::vector<StartupTiming>& getSubsystemTimings() const;
+
 		/**
 		Sets the scheduler config. Note that the configuration will not be applied until the
 		scheduler is restarted.
@@ -103,6 +144,37 @@ class SystemLayer :
 		@param pListener The listener to search for
 		@return True if the listener existed, false if it did not */
 		bool schedulerListenerExists(SchedulerListener* const pListener) const;
+
+		/**
+		Retrieves the asynchronous file reader. Its completions are delivered each scheduler frame.
+		@return The file reader */
+		AsyncFileReader& getFileReader();
+
+		/**
+		Retrieves the file watcher. Its changes are delivered each scheduler frame.
+		@return The file watcher */
+		FileWatcher& getFileWatcher();
+
+		/**
+		Retrieves the arenas for worker threads, whose frames end with the scheduler's.
+		@return The arenas */
+		ThreadFrameArenas& getThreadFrameArenas();
+
+		/**
+		Retrieves the task system.
+		@return The task system */
+		TaskSystem& getTaskSystem();
+
+		/**
+		Retrieves the memory tags of the engine's subsystems. Subsystems of other layers may add
+		their own tags, so that all of the engine's memory is reported together.
+		@return The memory tags */
+		MemoryTags& getMemoryTags();
+
+		/**
+		Retrieves the memory tags of the engine's subsystems.
+		@return The memory tags */
+		const MemoryTags& getMemoryTags() const;
 };
 
 #endif
\ No newline at end of file
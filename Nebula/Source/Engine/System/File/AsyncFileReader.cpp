@@ -0,0 +1,495 @@
+#include "Engine/System/File/AsyncFileReader.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+#else
+	#include <cerrno>
+
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace
+{
+	/**
+	The number of reads the ring keeps in flight at once. */
+	const unsigned int uiRingEntries = 64;
+}
+
+AsyncFileReader::AsyncFileReader() :
+	m_uiNumUndelivered(0),
+	m_uiNextId(1),
+	m_bStopping(false),
+	m_bPaused(false),
+	m_backend(AsyncFileReaderBackends::NONE)
+{
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+	stop();
+}
+
+bool AsyncFileReader::start(size_t uiNumThreads, bool bAllowIoUring)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_backend != AsyncFileReaderBackends::NONE)
+	{
+		return true;
+	}
+
+	m_bStopping = false;
+	if (bAllowIoUring && m_ring.open(uiRingEntries))
+	{
+		m_backend = AsyncFileReaderBackends::IO_URING;
+		m_threads.emplace_back(&AsyncFileReader::runRing, this);
+	}
+	else
+	{
+		m_backend = AsyncFileReaderBackends::THREAD_POOL;
+		for (size_t i = 0; i < std::max<size_t>(uiNumThreads, 1); ++i)
+		{
+			m_threads.emplace_back(&AsyncFileReader::runWorker, this);
+		}
+	}
+
+	return true;
+}
+
+void AsyncFileReader::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_backend == AsyncFileReaderBackends::NONE)
+		{
+			return;
+		}
+
+		m_bStopping = true;
+		for (std::pair<const QueueKey, AsyncReadRequest>& queued : m_queue)
+		{
+			finish(queued.first.second, queued.second, AsyncReadResults::CANCELLED, 0);
+		}
+
+		m_queue.clear();
+		m_queueKeys.clear();
+	}
+
+	m_condition.notify_all();
+	for (std::thread& thread : m_threads)
+	{
+		thread.join();
+	}
+
+	m_threads.clear();
+	m_ring.close();
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_backend = AsyncFileReaderBackends::NONE;
+	}
+
+	deliverCompletions();
+}
+
+bool AsyncFileReader::isRunning() const
+{
+	return getBackend() != AsyncFileReaderBackends::NONE;
+}
+
+AsyncFileReaderBackends AsyncFileReader::getBackend() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_backend;
+}
+
+void AsyncFileReader::pause()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_bPaused = true;
+}
+
+void AsyncFileReader::resume()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bPaused = false;
+	}
+
+	m_condition.notify_all();
+}
+
+bool AsyncFileReader::isPaused() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_bPaused;
+}
+
+AsyncReadId AsyncFileReader::submit(const AsyncReadRequest& request)
+{
+	AsyncReadId id = 0;
+	submitBatch(&request, 1, &id);
+	return id;
+}
+
+size_t AsyncFileReader::submitBatch(const AsyncReadRequest* pRequests, size_t uiNumRequests,
+	AsyncReadId* pIds)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_backend == AsyncFileReaderBackends::NONE || m_bStopping)
+		{
+			return 0;
+		}
+
+		for (size_t i = 0; i < uiNumRequests; ++i)
+		{
+			const AsyncReadId id = enqueue(pRequests[i]);
+			if (pIds != nullptr)
+			{
+				pIds[i] = id;
+			}
+		}
+	}
+
+	if (uiNumRequests == 1)
+	{
+		m_condition.notify_one();
+	}
+	else
+	{
+		m_condition.notify_all();
+	}
+
+	return uiNumRequests;
+}
+
+bool AsyncFileReader::cancel(AsyncReadId id)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const std::unordered_map<AsyncReadId, QueueKey>::iterator key = m_queueKeys.find(id);
+	if (key == m_queueKeys.end())
+	{
+		return false;
+	}
+
+	const std::map<QueueKey, AsyncReadRequest>::iterator queued = m_queue.find(key->second);
+	finish(id, queued->second, AsyncReadResults::CANCELLED, 0);
+	m_queue.erase(queued);
+	m_queueKeys.erase(key);
+	return true;
+}
+
+size_t AsyncFileReader::deliverCompletions()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_finished.empty())
+		{
+			return 0;
+		}
+
+		// Swap rather than move so that both buffers keep their capacity between frames
+		m_delivering.swap(m_finished);
+	}
+
+	for (FinishedRead& read : m_delivering)
+	{
+		if (read.onComplete)
+		{
+			read.onComplete(read.completion);
+		}
+	}
+
+	const size_t uiNumDelivered = m_delivering.size();
+	m_delivering.clear();
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_uiNumUndelivered -= uiNumDelivered;
+	return uiNumDelivered;
+}
+
+size_t AsyncFileReader::getNumPending() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_uiNumUndelivered;
+}
+
+void AsyncFileReader::reserve(size_t uiNumReads)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_finished.reserve(uiNumReads);
+	m_delivering.reserve(uiNumReads);
+	m_queueKeys.reserve(uiNumReads);
+}
+
+void AsyncFileReader::onUpdate(const SchedulerTimeInfo& info)
+{
+	deliverCompletions();
+}
+
+AsyncReadId AsyncFileReader::enqueue(const AsyncReadRequest& request)
+{
+	const AsyncReadId id = m_uiNextId++;
+	const QueueKey key(-(int)request.priority, id);
+	m_queue.emplace(key, request);
+	m_queueKeys.emplace(id, key);
+	++m_uiNumUndelivered;
+	return id;
+}
+
+bool AsyncFileReader::take(AsyncReadId& id, AsyncReadRequest& request, bool bWait)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (bWait)
+	{
+		m_condition.wait(lock, [this]()
+		{
+			return m_bStopping || (!m_bPaused && !m_queue.empty());
+		});
+	}
+
+	if (m_bStopping || m_bPaused || m_queue.empty())
+	{
+		return false;
+	}
+
+	const std::map<QueueKey, AsyncReadRequest>::iterator queued = m_queue.begin();
+	id = queued->first.second;
+	request = std::move(queued->second);
+	m_queueKeys.erase(id);
+	m_queue.erase(queued);
+	return true;
+}
+
+void AsyncFileReader::finish(AsyncReadId id, AsyncReadRequest& request, AsyncReadResults result,
+	size_t uiBytesRead)
+{
+	FinishedRead read;
+	read.completion.id = id;
+	read.completion.result = result;
+	read.completion.pBuffer = request.pBuffer;
+	read.completion.uiBytesRead = uiBytesRead;
+	read.onComplete = std::move(request.onComplete);
+	m_finished.push_back(std::move(read));
+}
+
+void AsyncFileReader::runWorker()
+{
+	AsyncReadId id;
+	AsyncReadRequest request;
+	while (take(id, request, true))
+	{
+		size_t uiBytesRead = 0;
+		const AsyncReadResults result = readBlocking(request, uiBytesRead);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		finish(id, request, result, uiBytesRead);
+	}
+}
+
+void AsyncFileReader::runRing()
+{
+#ifndef _WIN32
+	struct InFlightRead
+	{
+		AsyncReadId id;
+		AsyncReadRequest request;
+		int iFile;
+		size_t uiBytesRead;
+	};
+
+	std::vector<InFlightRead> reads(m_ring.getNumEntries());
+	std::vector<unsigned int> freeSlots;
+	for (unsigned int uiSlot = (unsigned int)reads.size(); uiSlot > 0; --uiSlot)
+	{
+		freeSlots.push_back(uiSlot - 1);
+	}
+
+	const auto finishRead = [this, &reads, &freeSlots](unsigned int uiSlot,
+		AsyncReadResults result)
+	{
+		InFlightRead& read = reads[uiSlot];
+		::close(read.iFile);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		finish(read.id, read.request, result, read.uiBytesRead);
+		freeSlots.push_back(uiSlot);
+	};
+
+	while (true)
+	{
+		// Top the ring up with the highest priority reads. Only wait for new reads when there is
+		// nothing in flight to reap instead
+		AsyncReadId id;
+		AsyncReadRequest request;
+		while (!freeSlots.empty() && take(id, request, freeSlots.size() == reads.size()))
+		{
+			const int iFile = ::open(request.sPath.c_str(), O_RDONLY | O_CLOEXEC);
+			if (iFile < 0)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				finish(id, request, AsyncReadResults::FAIL_OPEN, 0);
+				continue;
+			}
+
+			const unsigned int uiSlot = freeSlots.back();
+			freeSlots.pop_back();
+
+			InFlightRead& read = reads[uiSlot];
+			read.id = id;
+			read.request = std::move(request);
+			read.iFile = iFile;
+			read.uiBytesRead = 0;
+			if (read.request.uiSize == 0)
+			{
+				finishRead(uiSlot, AsyncReadResults::SUCCESS);
+				continue;
+			}
+
+			m_ring.queueRead(uiSlot, iFile, read.request.pBuffer, read.request.uiSize,
+				read.request.uiOffset);
+		}
+
+		if (freeSlots.size() == reads.size())
+		{
+			// Nothing is in flight and no read could be taken, so the reader is stopping
+			return;
+		}
+
+		unsigned int uiSlot;
+		int iResult;
+		if (!m_ring.submit() || !m_ring.reap(uiSlot, iResult, true))
+		{
+			break;
+		}
+
+		do
+		{
+			InFlightRead& read = reads[uiSlot];
+			if (iResult > 0)
+			{
+				read.uiBytesRead += (size_t)iResult;
+			}
+
+			if (iResult < 0 && iResult != -EINTR && iResult != -EAGAIN)
+			{
+				finishRead(uiSlot, AsyncReadResults::FAIL_READ);
+			}
+			else if (iResult == 0 || read.uiBytesRead == read.request.uiSize)
+			{
+				finishRead(uiSlot, AsyncReadResults::SUCCESS);
+			}
+			else
+			{
+				// Reissue the remainder of a short or interrupted read
+				m_ring.queueRead(uiSlot, read.iFile,
+					static_cast<unsigned char*>(read.request.pBuffer) + read.uiBytesRead,
+					read.request.uiSize - read.uiBytesRead,
+					read.request.uiOffset + read.uiBytesRead);
+			}
+		} while (m_ring.reap(uiSlot, iResult, false));
+	}
+
+	// The ring has failed. Finish the reads it held with blocking reads and carry on without it
+	for (unsigned int uiSlot = 0; uiSlot < reads.size(); ++uiSlot)
+	{
+		if (std::find(freeSlots.begin(), freeSlots.end(), uiSlot) == freeSlots.end())
+		{
+			InFlightRead& read = reads[uiSlot];
+			const AsyncReadResults result = readBlocking(read.request, read.uiBytesRead);
+			finishRead(uiSlot, result);
+		}
+	}
+
+	runWorker();
+#endif
+}
+
+AsyncReadResults AsyncFileReader::readBlocking(const AsyncReadRequest& request,
+	size_t& uiBytesRead)
+{
+	unsigned char* pBuffer = static_cast<unsigned char*>(request.pBuffer);
+	AsyncReadResults result = AsyncReadResults::SUCCESS;
+	uiBytesRead = 0;
+
+#ifdef _WIN32
+	const HANDLE hFile = CreateFileA(request.sPath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return AsyncReadResults::FAIL_OPEN;
+	}
+
+	while (uiBytesRead < request.uiSize)
+	{
+		const std::uint64_t uiOffset = request.uiOffset + uiBytesRead;
+		const DWORD uiChunk = (DWORD)std::min<size_t>(request.uiSize - uiBytesRead, 1u << 30);
+
+		OVERLAPPED overlapped = {};
+		overlapped.Offset = (DWORD)uiOffset;
+		overlapped.OffsetHigh = (DWORD)(uiOffset >> 32);
+
+		DWORD uiRead = 0;
+		if (!ReadFile(hFile, pBuffer + uiBytesRead, uiChunk, &uiRead, &overlapped))
+		{
+			if (GetLastError() != ERROR_HANDLE_EOF)
+			{
+				result = AsyncReadResults::FAIL_READ;
+			}
+
+			break;
+		}
+		else if (uiRead == 0)
+		{
+			break;
+		}
+
+		uiBytesRead += uiRead;
+	}
+
+	CloseHandle(hFile);
+#else
+	const int iFile = ::open(request.sPath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (iFile < 0)
+	{
+		return AsyncReadResults::FAIL_OPEN;
+	}
+
+	while (uiBytesRead < request.uiSize)
+	{
+		const ssize_t iRead = pread(iFile, pBuffer + uiBytesRead, request.uiSize - uiBytesRead,
+			(off_t)(request.uiOffset + uiBytesRead));
+		if (iRead < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			result = AsyncReadResults::FAIL_READ;
+			break;
+		}
+		else if (iRead == 0)
+		{
+			break;
+		}
+
+		uiBytesRead += (size_t)iRead;
+	}
+
+	::close(iFile);
+#endif
+
+	return result;
+}
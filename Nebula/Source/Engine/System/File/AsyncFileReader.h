@@ -0,0 +1,301 @@
+/**
+The asynchronous file reader streams file ranges in to caller provided buffers without blocking
+the thread that requested them.
+
+Reads are queued with a priority and serviced highest priority first, and in submission order
+within a priority. A read that has not yet been started can be cancelled. On Linux reads are
+issued through io_uring where it is available, and otherwise by a small pool of threads that use
+blocking positioned reads.
+
+Completions are never delivered from the background threads. They are collected and handed out
+by deliverCompletions, which the reader calls itself each frame once it is registered with a
+scheduler. Completion callbacks therefore run on the scheduler thread between updates, and a
+buffer may be reused as soon as its callback has run.
+
+A buffer must remain valid until its completion has been delivered, including for cancelled
+reads. Submission and cancellation are thread-safe, deliverCompletions is not.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef ASYNC_FILE_READER_H
+#define ASYNC_FILE_READER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Engine/System/File/IoUring.h"
+#include "Engine/System/Schedule/ScheduledItem.h"
+
+/**
+Identifies a read. 0 is never a valid id. */
+typedef std::uint64_t AsyncReadId;
+
+enum class AsyncReadPriorities
+{
+	/**
+	Speculative reads, such as prefetching content that may soon be needed. */
+	BACKGROUND,
+
+	/**
+	Regular streaming reads. */
+	NORMAL,
+
+	/**
+	Reads that something is waiting on, such as content that is visible this frame. */
+	URGENT
+};
+
+enum class AsyncReadResults
+{
+	SUCCESS,
+	FAIL_OPEN,
+	FAIL_READ,
+	CANCELLED
+};
+
+enum class AsyncFileReaderBackends
+{
+	/**
+	The reader is not running. */
+	NONE,
+
+	/**
+	Reads are issued through a single io_uring. */
+	IO_URING,
+
+	/**
+	Reads are issued by a pool of threads. */
+	THREAD_POOL
+};
+
+struct AsyncReadCompletion
+{
+	/**
+	The id of the read. */
+	AsyncReadId id;
+
+	/**
+	The result of the read. */
+	AsyncReadResults result;
+
+	/**
+	The buffer that was read in to. */
+	void* pBuffer;
+
+	/**
+	The number of bytes read. This is less than the requested size if the end of the file was
+	reached. */
+	size_t uiBytesRead;
+};
+
+struct AsyncReadRequest
+{
+	/**
+	The native path of the file. */
+	std::string sPath;
+
+	/**
+	The offset in the file to start reading from. */
+	std::uint64_t uiOffset;
+
+	/**
+	The buffer to read in to. */
+	void* pBuffer;
+
+	/**
+	The number of bytes to read. */
+	size_t uiSize;
+
+	/**
+	The priority of the read. */
+	AsyncReadPriorities priority;
+
+	/**
+	Called with the completion of the read, on the thread that delivers completions. */
+	std::function<void(const AsyncReadCompletion&)> onComplete;
+
+	/**
+	Constructs an empty request of normal priority. */
+	AsyncReadRequest() :
+		uiOffset(0),
+		pBuffer(nullptr),
+		uiSize(0),
+		priority(AsyncReadPriorities::NORMAL)
+	{
+	}
+};
+
+class AsyncFileReader : public ScheduledItem
+{
+	public:
+		/**
+		Constructs a reader that is not running. */
+		AsyncFileReader();
+
+		/**
+		Destructor. Stops the reader. */
+		~AsyncFileReader();
+
+		AsyncFileReader(const AsyncFileReader& other) = delete;
+		AsyncFileReader& operator=(const AsyncFileReader& other) = delete;
+
+		/**
+		Starts the reader. Does nothing if the reader is already running.
+		@param uiNumThreads The number of threads to use if io_uring is unavailable
+		@param bAllowIoUring True to use io_uring where it is available, false to always use
+		threads
+		@return True if the reader is running, false otherwise */
+		bool start(size_t uiNumThreads = 2, bool bAllowIoUring = true);
+
+		/**
+		Stops the reader. Queued reads are cancelled, reads in progress are finished, and every
+		outstanding completion is delivered before returning. */
+		void stop();
+
+		/**
+		Queries whether the reader is running.
+		@return True if the reader is running, false otherwise */
+		bool isRunning() const;
+
+		/**
+		Retrieves the backend that services reads.
+		@return The backend */
+		AsyncFileReaderBackends getBackend() const;
+
+		/**
+		Pauses the reader. Reads in progress are finished, but no further reads are started until
+		the reader is resumed. Reads may still be submitted and cancelled. */
+		void pause();
+
+		/**
+		Resumes a paused reader. */
+		void resume();
+
+		/**
+		Queries whether the reader is paused.
+		@return True if the reader is paused, false otherwise */
+		bool isPaused() const;
+
+		/**
+		Queues a read.
+		@param request The read
+		@return The id of the read, or 0 if the reader is not running */
+		AsyncReadId submit(const AsyncReadRequest& request);
+
+		/**
+		Queues a batch of reads under a single lock, waking the backend once.
+		@param pRequests The reads
+		@param uiNumRequests The number of reads
+		@param pIds Filled with the id of each read if not a nullptr
+		@return The number of reads queued, which is 0 if the reader is not running */
+		size_t submitBatch(const AsyncReadRequest* pRequests, size_t uiNumRequests,
+			AsyncReadId* pIds = nullptr);
+
+		/**
+		Cancels a read that has not yet started. The read still completes, with a result of
+		CANCELLED.
+		@param id The id of the read
+		@return True if the read was cancelled, false if it has started or already finished */
+		bool cancel(AsyncReadId id);
+
+		/**
+		Calls the completion callback of every read that has finished since the last call.
+		@return The number of completions delivered */
+		size_t deliverCompletions();
+
+		/**
+		Retrieves the number of reads that have been submitted but not yet delivered.
+		@return The number of reads */
+		size_t getNumPending() const;
+
+		/**
+		Reserves room to hold the completions of the given number of reads, so that delivering
+		them each frame does not allocate.
+		@param uiNumReads The number of reads */
+		void reserve(size_t uiNumReads);
+
+		/**
+		Delivers completions.
+		@param info The time info */
+		void onUpdate(const SchedulerTimeInfo& info) override;
+
+	protected:
+
+	private:
+		/**
+		Orders queued reads by descending priority, then by ascending id. */
+		typedef std::pair<int, AsyncReadId> QueueKey;
+
+		struct FinishedRead
+		{
+			AsyncReadCompletion completion;
+			std::function<void(const AsyncReadCompletion&)> onComplete;
+		};
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::map<QueueKey, AsyncReadRequest> m_queue;
+		std::unordered_map<AsyncReadId, QueueKey> m_queueKeys;
+		std::vector<FinishedRead> m_finished;
+		std::vector<FinishedRead> m_delivering;
+		size_t m_uiNumUndelivered;
+		AsyncReadId m_uiNextId;
+		bool m_bStopping;
+		bool m_bPaused;
+		AsyncFileReaderBackends m_backend;
+		std::vector<std::thread> m_threads;
+		IoUring m_ring;
+
+		/**
+		Queues a read. The mutex must be held.
+		@param request The read
+		@return The id of the read */
+		AsyncReadId enqueue(const AsyncReadRequest& request);
+
+		/**
+		Takes the highest priority read from the queue.
+		@param id Set to the id of the read
+		@param request Set to the read
+		@param bWait True to wait for a read to be queued, false to return immediately
+		@return True if a read was taken, false if none is available or the reader is stopping */
+		bool take(AsyncReadId& id, AsyncReadRequest& request, bool bWait);
+
+		/**
+		Records a finished read for delivery. The mutex must be held.
+		@param id The id of the read
+		@param request The read
+		@param result The result of the read
+		@param uiBytesRead The number of bytes read */
+		void finish(AsyncReadId id, AsyncReadRequest& request, AsyncReadResults result,
+			size_t uiBytesRead);
+
+		/**
+		Services reads with blocking reads until the reader stops. */
+		void runWorker();
+
+		/**
+		Services reads through the ring until the reader stops. */
+		void runRing();
+
+		/**
+		Reads a range of a file, blocking until it is done.
+		@param request The read
+		@param uiBytesRead Set to the number of bytes read
+		@return The result of the read */
+		static AsyncReadResults readBlocking(const AsyncReadRequest& request,
+			size_t& uiBytesRead);
+};
+
+#endif
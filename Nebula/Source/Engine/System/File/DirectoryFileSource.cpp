@@ -0,0 +1,154 @@
+#include "Engine/System/File/DirectoryFileSource.h"
+
+#include <fstream>
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+#else
+	#include <dirent.h>
+	#include <sys/stat.h>
+#endif
+
+DirectoryFileSource::DirectoryFileSource(const std::string& sRoot) :
+	m_sRoot(sRoot)
+{
+	if (m_sRoot.empty())
+	{
+		m_sRoot = "./";
+	}
+	else if (m_sRoot.back() != '/' && m_sRoot.back() != '\\')
+	{
+		m_sRoot += '/';
+	}
+}
+
+void DirectoryFileSource::listFiles(std::vector<std::string>& files) const
+{
+	listDirectory("", files);
+}
+
+bool DirectoryFileSource::read(const std::string& sPath, std::vector<unsigned char>& data) const
+{
+	std::ifstream file(getNativePath(sPath), std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		return false;
+	}
+
+	const std::streamoff uiSize = file.tellg();
+	if (uiSize < 0)
+	{
+		return false;
+	}
+
+	data.resize((size_t)uiSize);
+	file.seekg(0, std::ios::beg);
+	if (uiSize > 0 && !file.read(reinterpret_cast<char*>(data.data()), uiSize))
+	{
+		data.clear();
+		return false;
+	}
+
+	return true;
+}
+
+std::string DirectoryFileSource::getNativePath(const std::string& sPath) const
+{
+	return m_sRoot + sPath;
+}
+
+const std::string& DirectoryFileSource::getRoot() const
+{
+	return m_sRoot;
+}
+
+void DirectoryFileSource::listDirectory(const std::string& sDirectory,
+	std::vector<std::string>& files) const
+{
+#ifdef _WIN32
+	WIN32_FIND_DATAA findData;
+	HANDLE hFind = FindFirstFileA((m_sRoot + sDirectory + "*").c_str(), &findData);
+	if (hFind == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	do
+	{
+		const std::string sName(findData.cFileName);
+		if (sName == "." || sName == "..")
+		{
+			continue;
+		}
+
+		// Linked directories are not followed, as a link to a parent would list forever
+		if ((findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+		{
+			if ((findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) == 0)
+			{
+				listDirectory(sDirectory + sName + "/", files);
+			}
+		}
+		else
+		{
+			files.push_back(sDirectory + sName);
+		}
+	}
+	while (FindNextFileA(hFind, &findData));
+
+	FindClose(hFind);
+#else
+	DIR* pDirectory = opendir((m_sRoot + sDirectory).c_str());
+	if (pDirectory == nullptr)
+	{
+		return;
+	}
+
+	while (dirent* pEntry = readdir(pDirectory))
+	{
+		const std::string sName(pEntry->d_name);
+		if (sName == "." || sName == "..")
+		{
+			continue;
+		}
+
+		bool bIsDirectory = pEntry->d_type == DT_DIR;
+		bool bIsFile = pEntry->d_type == DT_REG;
+
+		// Not every file system reports the type, in which case ask for it. Links to files are
+		// listed, but linked directories are not followed, as a link to a parent would list
+		// forever
+		if (pEntry->d_type == DT_UNKNOWN || pEntry->d_type == DT_LNK)
+		{
+			const std::string sPath = m_sRoot + sDirectory + sName;
+			struct stat status;
+			if (lstat(sPath.c_str(), &status) == 0)
+			{
+				bIsDirectory = S_ISDIR(status.st_mode);
+				bIsFile = S_ISREG(status.st_mode) ||
+					(S_ISLNK(status.st_mode) && stat(sPath.c_str(), &status) == 0 &&
+					S_ISREG(status.st_mode));
+			}
+		}
+
+		if (bIsDirectory)
+		{
+			listDirectory(sDirectory + sName + "/", files);
+		}
+		else if (bIsFile)
+		{
+			files.push_back(sDirectory + sName);
+		}
+	}
+
+	closedir(pDirectory);
+#endif
+}
@@ -0,0 +1,63 @@
+/**
+A directory file source provides the files beneath a directory on disk, such as the loose data
+directory or a mod folder. The directory is walked when the source is listed and files are read
+directly from disk.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef DIRECTORY_FILE_SOURCE_H
+#define DIRECTORY_FILE_SOURCE_H
+
+#include <string>
+#include <vector>
+
+#include "Engine/System/File/VirtualFileSource.h"
+
+class DirectoryFileSource : public VirtualFileSource
+{
+	public:
+		/**
+		Constructs a source for the given directory.
+		@param sRoot The directory */
+		DirectoryFileSource(const std::string& sRoot);
+
+		/**
+		Lists every file beneath the directory, including those in sub-directories. Links to files
+		are listed, but links to directories are not followed.
+		@param files Appended with the path of each file */
+		void listFiles(std::vector<std::string>& files) const override;
+
+		/**
+		Reads the whole of a file.
+		@param sPath The path of the file
+		@param data Replaced with the contents of the file
+		@return True if the file was read, false otherwise */
+		bool read(const std::string& sPath, std::vector<unsigned char>& data) const override;
+
+		/**
+		Retrieves the path of a file on disk.
+		@param sPath The path of the file within the source
+		@return The path on disk */
+		std::string getNativePath(const std::string& sPath) const;
+
+		/**
+		Retrieves the directory.
+		@return The directory, with a trailing separator */
+		const std::string& getRoot() const;
+
+	protected:
+
+	private:
+		std::string m_sRoot;
+
+		/**
+		Lists the files beneath a sub-directory.
+		@param sDirectory The sub-directory relative to the root, empty or with a trailing '/'
+		@param files Appended with the path of each file */
+		void listDirectory(const std::string& sDirectory, std::vector<std::string>& files) const;
+};
+
+#endif
@@ -0,0 +1,69 @@
+/**
+A file change describes a change to a file beneath a watched directory, as reported by a file
+watcher.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef FILE_CHANGE_H
+#define FILE_CHANGE_H
+
+#include <string>
+
+#include "Engine/System/Tools/IndexedVector.h"
+
+typedef IndexedVectorId FileWatchId;
+
+enum class FileChangeTypes
+{
+	/**
+	The file was created, or moved in to the watched directory. */
+	ADDED,
+
+	/**
+	The file's contents changed, or it was replaced. */
+	MODIFIED,
+
+	/**
+	The file was deleted, or moved out of the watched directory. A directory that is moved out
+	is reported as a single removal of the directory's path. */
+	REMOVED,
+
+	/**
+	Changes were lost, so anything beneath the path may have changed. The path is empty when the
+	whole watch is affected. */
+	UNKNOWN
+};
+
+struct FileChange
+{
+	/**
+	The watch that observed the change. */
+	FileWatchId watchId;
+
+	/**
+	The path of the file relative to the watched directory, using '/' as the separator. */
+	std::string sPath;
+
+	/**
+	The type of the change. */
+	FileChangeTypes type;
+
+	FileChange() :
+		watchId(),
+		sPath(),
+		type(FileChangeTypes::MODIFIED)
+	{
+	}
+
+	FileChange(const FileWatchId& watchId, const std::string& sPath, FileChangeTypes type) :
+		watchId(watchId),
+		sPath(sPath),
+		type(type)
+	{
+	}
+};
+
+#endif
@@ -0,0 +1,32 @@
+/**
+A file watch listener is an interface class that defines the necessary functionality for a class
+to be able to register to listen for file changes.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef FILE_WATCH_LISTENER_H
+#define FILE_WATCH_LISTENER_H
+
+#include <vector>
+
+#include "Engine/System/File/FileChange.h"
+
+class FileWatchListener
+{
+	public:
+		/**
+		This function is called once per frame with every change that has settled since the
+		previous call. Each file appears at most once.
+		@param changes The changes */
+		virtual void onFilesChanged(const std::vector<FileChange>& changes) = 0;
+
+	protected:
+
+	private:
+
+};
+
+#endif
@@ -0,0 +1,714 @@
+#include "Engine/System/File/FileWatcher.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include "Engine/System/File/DirectoryFileSource.h"
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+#else
+	#include <sys/stat.h>
+
+	#ifdef __linux__
+		#define NEB_HAS_INOTIFY
+
+		#include <cerrno>
+
+		#include <dirent.h>
+		#include <sys/inotify.h>
+		#include <unistd.h>
+	#endif
+#endif
+
+namespace
+{
+	struct FileStamp
+	{
+		std::uint64_t uiModified;
+		std::uint64_t uiSize;
+
+		bool operator!=(const FileStamp& other) const
+		{
+			return uiModified != other.uiModified || uiSize != other.uiSize;
+		}
+	};
+
+	bool isDirectory(const std::string& sPath)
+	{
+#ifdef _WIN32
+		const DWORD uiAttributes = GetFileAttributesA(sPath.c_str());
+		return uiAttributes != INVALID_FILE_ATTRIBUTES &&
+			(uiAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+		struct stat info;
+		return stat(sPath.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+#endif
+	}
+
+	bool stampFile(const std::string& sPath, FileStamp& stamp)
+	{
+#ifdef _WIN32
+		WIN32_FILE_ATTRIBUTE_DATA data;
+		if (!GetFileAttributesExA(sPath.c_str(), GetFileExInfoStandard, &data))
+		{
+			return false;
+		}
+
+		stamp.uiModified = ((std::uint64_t)data.ftLastWriteTime.dwHighDateTime << 32) |
+			data.ftLastWriteTime.dwLowDateTime;
+		stamp.uiSize = ((std::uint64_t)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+#else
+		struct stat info;
+		if (stat(sPath.c_str(), &info) != 0)
+		{
+			return false;
+		}
+
+		stamp.uiModified = (std::uint64_t)info.st_mtime * 1000000000ull;
+	#ifdef __linux__
+		stamp.uiModified += (std::uint64_t)info.st_mtim.tv_nsec;
+	#endif
+		stamp.uiSize = (std::uint64_t)info.st_size;
+#endif
+
+		return true;
+	}
+
+	/**
+	Merges a change in to the pending change to the same file.
+	@param pending The pending change
+	@param type The new change
+	@param bCancelled Set to true if the changes cancel each other out
+	@return The merged change */
+	FileChangeTypes mergeChanges(FileChangeTypes pending, FileChangeTypes type, bool& bCancelled)
+	{
+		bCancelled = pending == FileChangeTypes::ADDED && type == FileChangeTypes::REMOVED;
+		if (pending == FileChangeTypes::UNKNOWN || type == FileChangeTypes::UNKNOWN)
+		{
+			return FileChangeTypes::UNKNOWN;
+		}
+		else if (pending == FileChangeTypes::ADDED || type == FileChangeTypes::REMOVED)
+		{
+			return type == FileChangeTypes::REMOVED ? type : pending;
+		}
+
+		// A file that was removed and then replaced has been modified
+		return FileChangeTypes::MODIFIED;
+	}
+
+#ifdef NEB_HAS_INOTIFY
+	const std::uint32_t uiInotifyMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE |
+		IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+#endif
+}
+
+FileWatcher::FileWatcher() :
+	m_debounceTime(100),
+	m_backend(FileWatcherBackends::NONE),
+	m_iInotify(-1),
+	m_pollInterval(500),
+	m_bStopping(false)
+{
+}
+
+FileWatcher::~FileWatcher()
+{
+	stop();
+}
+
+bool FileWatcher::start(bool bAllowNative)
+{
+	if (m_backend != FileWatcherBackends::NONE)
+	{
+		return true;
+	}
+
+#ifdef NEB_HAS_INOTIFY
+	if (bAllowNative)
+	{
+		m_iInotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	}
+
+	if (m_iInotify >= 0)
+	{
+		m_eventBuffer.resize(64 * 1024);
+		m_backend = FileWatcherBackends::INOTIFY;
+		return true;
+	}
+#else
+	(void)bAllowNative;
+#endif
+
+	m_bStopping = false;
+	m_backend = FileWatcherBackends::POLLING;
+	m_pollThread = std::thread(&FileWatcher::runPolling, this);
+	return true;
+}
+
+void FileWatcher::stop()
+{
+	if (m_backend == FileWatcherBackends::NONE)
+	{
+		return;
+	}
+
+	if (m_pollThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_bStopping = true;
+		}
+
+		m_condition.notify_all();
+		m_pollThread.join();
+	}
+
+#ifdef NEB_HAS_INOTIFY
+	if (m_iInotify >= 0)
+	{
+		close(m_iInotify);
+		m_iInotify = -1;
+	}
+#endif
+
+	m_directories.clear();
+	m_knownFiles.clear();
+	m_watches.clear();
+	m_pending.clear();
+	m_polled.clear();
+	m_backend = FileWatcherBackends::NONE;
+}
+
+bool FileWatcher::isRunning() const
+{
+	return m_backend != FileWatcherBackends::NONE;
+}
+
+FileWatcherBackends FileWatcher::getBackend() const
+{
+	return m_backend;
+}
+
+FileWatchId FileWatcher::watch(const std::string& sDirectory, bool bRecursive)
+{
+	if (m_backend == FileWatcherBackends::NONE || !isDirectory(sDirectory))
+	{
+		return FileWatchId();
+	}
+
+	Watch watch;
+	watch.sDirectory = sDirectory;
+	watch.bRecursive = bRecursive;
+	if (watch.sDirectory.back() != '/' && watch.sDirectory.back() != '\\')
+	{
+		watch.sDirectory += '/';
+	}
+
+	FileWatchId id;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		id = m_watches.push(watch);
+		m_watches.find(id)->id = id;
+	}
+
+	if (m_backend == FileWatcherBackends::INOTIFY)
+	{
+		if (!addDirectory(id, ""))
+		{
+			unwatch(id);
+			return FileWatchId();
+		}
+
+		std::vector<std::string> files;
+		listKnownFiles(id, "", files);
+	}
+
+	return id;
+}
+
+void FileWatcher::unwatch(const FileWatchId& id)
+{
+	if (m_watches.find(id) == m_watches.end())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_watches.remove(id);
+	}
+
+	for (PendingChanges::iterator it = m_pending.begin(); it != m_pending.end();)
+	{
+		it = it->second.watchId == id ? m_pending.erase(it) : std::next(it);
+	}
+
+	forgetDirectories(id, "");
+
+	std::vector<std::string> files;
+	forgetKnownFiles(id, "", files);
+}
+
+bool FileWatcher::watchExists(const FileWatchId& id) const
+{
+	return m_watches.find(id) != m_watches.end();
+}
+
+std::string FileWatcher::getDirectory(const FileWatchId& id) const
+{
+	const IndexedVector<Watch>::Iterator it = m_watches.find(id);
+	return it != m_watches.end() ? it->sDirectory : std::string();
+}
+
+void FileWatcher::setDebounceTime(std::chrono::milliseconds debounceTime)
+{
+	m_debounceTime = debounceTime;
+}
+
+std::chrono::milliseconds FileWatcher::getDebounceTime() const
+{
+	return m_debounceTime;
+}
+
+void FileWatcher::setPollInterval(std::chrono::milliseconds pollInterval)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pollInterval = pollInterval;
+	}
+
+	m_condition.notify_all();
+}
+
+void FileWatcher::addListener(FileWatchListener* const pListener)
+{
+	if (pListener != nullptr && !listenerExists(pListener))
+	{
+		m_listeners.push_back(pListener);
+	}
+}
+
+void FileWatcher::removeListener(FileWatchListener* const pListener)
+{
+	m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), pListener),
+		m_listeners.end());
+}
+
+bool FileWatcher::listenerExists(FileWatchListener* const pListener) const
+{
+	return std::find(m_listeners.begin(), m_listeners.end(), pListener) != m_listeners.end();
+}
+
+size_t FileWatcher::update()
+{
+	const Clock::time_point timeNow = Clock::now();
+	if (m_backend == FileWatcherBackends::INOTIFY)
+	{
+		readEvents(timeNow);
+	}
+	else if (m_backend == FileWatcherBackends::POLLING)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (const FileChange& change : m_polled)
+		{
+			record(change.watchId, change.sPath, change.type, timeNow);
+		}
+
+		m_polled.clear();
+	}
+
+	// Deliver every change that has settled as one batch
+	m_batch.clear();
+	for (PendingChanges::iterator it = m_pending.begin(); it != m_pending.end();)
+	{
+		if (timeNow - it->second.timeLastChanged >= m_debounceTime)
+		{
+			m_batch.emplace_back(it->second.watchId, it->first.second, it->second.type);
+			it = m_pending.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	if (!m_batch.empty())
+	{
+		// Listeners may add or remove listeners while handling the batch
+		for (size_t i = 0; i < m_listeners.size(); ++i)
+		{
+			m_listeners[i]->onFilesChanged(m_batch);
+		}
+	}
+
+	return m_batch.size();
+}
+
+void FileWatcher::reserve(size_t uiNumChanges)
+{
+	m_batch.reserve(uiNumChanges);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_polled.reserve(uiNumChanges);
+}
+
+void FileWatcher::onUpdate(const SchedulerTimeInfo& info)
+{
+	update();
+}
+
+void FileWatcher::record(const FileWatchId& watchId, const std::string& sPath,
+	FileChangeTypes type, Clock::time_point time)
+{
+	if (!watchExists(watchId))
+	{
+		return;
+	}
+
+	PendingChange change;
+	change.watchId = watchId;
+	change.type = type;
+	change.timeLastChanged = time;
+
+	const std::pair<PendingChanges::iterator, bool> inserted =
+		m_pending.emplace(std::make_pair(watchId.getIndex(), sPath), change);
+	if (!inserted.second)
+	{
+		bool bCancelled;
+		PendingChange& pending = inserted.first->second;
+		pending.type = mergeChanges(pending.type, type, bCancelled);
+		pending.timeLastChanged = time;
+		if (bCancelled)
+		{
+			// The file came and went, so there is nothing to report
+			m_pending.erase(inserted.first);
+		}
+	}
+}
+
+bool FileWatcher::addDirectory(const FileWatchId& watchId, const std::string& sRelative)
+{
+#ifdef NEB_HAS_INOTIFY
+	const IndexedVector<Watch>::Iterator watch = m_watches.find(watchId);
+	const std::string sPath = watch->sDirectory + sRelative;
+	const int iDescriptor = inotify_add_watch(m_iInotify, sPath.c_str(), uiInotifyMask);
+	if (iDescriptor < 0)
+	{
+		return false;
+	}
+
+	WatchedDirectory directory;
+	directory.watchId = watchId;
+	directory.sRelative = sRelative;
+	m_directories[iDescriptor].push_back(directory);
+
+	if (watch->bRecursive)
+	{
+		DIR* pDirectory = opendir(sPath.c_str());
+		if (pDirectory != nullptr)
+		{
+			// Linked directories are not followed, matching DirectoryFileSource
+			std::vector<std::string> subdirectories;
+			while (const dirent* pEntry = readdir(pDirectory))
+			{
+				const std::string sName = pEntry->d_name;
+				struct stat info;
+				if (sName != "." && sName != ".." && (pEntry->d_type == DT_DIR ||
+					(pEntry->d_type == DT_UNKNOWN && lstat((sPath + sName).c_str(), &info) == 0 &&
+					S_ISDIR(info.st_mode))))
+				{
+					subdirectories.push_back(sRelative + sName + '/');
+				}
+			}
+
+			closedir(pDirectory);
+			for (const std::string& sSubdirectory : subdirectories)
+			{
+				addDirectory(watchId, sSubdirectory);
+			}
+		}
+	}
+
+	return true;
+#else
+	(void)watchId;
+	(void)sRelative;
+	return false;
+#endif
+}
+
+void FileWatcher::forgetDirectories(const FileWatchId& watchId, const std::string& sPrefix)
+{
+#ifdef NEB_HAS_INOTIFY
+	for (auto it = m_directories.begin(); it != m_directories.end();)
+	{
+		std::vector<WatchedDirectory>& watchers = it->second;
+		watchers.erase(std::remove_if(watchers.begin(), watchers.end(),
+			[&](const WatchedDirectory& directory)
+		{
+			return directory.watchId == watchId &&
+				directory.sRelative.compare(0, sPrefix.size(), sPrefix) == 0;
+		}), watchers.end());
+
+		if (watchers.empty())
+		{
+			inotify_rm_watch(m_iInotify, it->first);
+			it = m_directories.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+#else
+	(void)watchId;
+	(void)sPrefix;
+#endif
+}
+
+void FileWatcher::listKnownFiles(const FileWatchId& watchId, const std::string& sRelative,
+	std::vector<std::string>& files)
+{
+	const IndexedVector<Watch>::Iterator watch = m_watches.find(watchId);
+	std::vector<std::string> found;
+	DirectoryFileSource(watch->sDirectory + sRelative).listFiles(found);
+
+	files.clear();
+	for (const std::string& sFile : found)
+	{
+		const std::string sPath = sRelative + sFile;
+		if (watch->bRecursive || sPath.find('/') == std::string::npos)
+		{
+			m_knownFiles.emplace(watchId.getIndex(), sPath);
+			files.push_back(sPath);
+		}
+	}
+}
+
+void FileWatcher::forgetKnownFiles(const FileWatchId& watchId, const std::string& sPrefix,
+	std::vector<std::string>& files)
+{
+	files.clear();
+	auto it = m_knownFiles.lower_bound(std::make_pair(watchId.getIndex(), sPrefix));
+	while (it != m_knownFiles.end() && it->first == watchId.getIndex() &&
+		it->second.compare(0, sPrefix.size(), sPrefix) == 0)
+	{
+		files.push_back(it->second);
+		it = m_knownFiles.erase(it);
+	}
+}
+
+void FileWatcher::readEvents(Clock::time_point timeNow)
+{
+#ifdef NEB_HAS_INOTIFY
+	while (true)
+	{
+		const ssize_t iRead = read(m_iInotify, m_eventBuffer.data(), m_eventBuffer.size());
+		if (iRead <= 0)
+		{
+			if (iRead < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			return;
+		}
+
+		for (ssize_t iOffset = 0; iOffset < iRead;)
+		{
+			inotify_event event;
+			std::memcpy(&event, m_eventBuffer.data() + iOffset, sizeof(event));
+			const char* pName = m_eventBuffer.data() + iOffset + sizeof(event);
+			iOffset += sizeof(event) + event.len;
+
+			if (event.mask & IN_Q_OVERFLOW)
+			{
+				// Events were lost, so the remembered files are listed again
+				std::vector<std::string> files;
+				m_watches.forEachInRange(0, m_watches.capacity(), [&](const Watch& watch)
+				{
+					forgetKnownFiles(watch.id, "", files);
+					listKnownFiles(watch.id, "", files);
+					record(watch.id, "", FileChangeTypes::UNKNOWN, timeNow);
+				});
+
+				continue;
+			}
+
+			const auto it = m_directories.find(event.wd);
+			if (it == m_directories.end())
+			{
+				continue;
+			}
+			else if (event.mask & IN_IGNORED)
+			{
+				m_directories.erase(it);
+				continue;
+			}
+
+			// Copied as watching a new directory may rehash the directories
+			const std::vector<WatchedDirectory> watchers = it->second;
+			const std::string sName = event.len > 0 ? std::string(pName) : std::string();
+			for (const WatchedDirectory& directory : watchers)
+			{
+				const std::string sPath = directory.sRelative + sName;
+				if (event.mask & IN_ISDIR)
+				{
+					if ((event.mask & (IN_CREATE | IN_MOVED_TO)) &&
+						m_watches.find(directory.watchId)->bRecursive)
+					{
+						// Files may have appeared before the new directory was watched
+						addDirectory(directory.watchId, sPath + '/');
+
+						std::vector<std::string> files;
+						listKnownFiles(directory.watchId, sPath + '/', files);
+						for (const std::string& sFile : files)
+						{
+							record(directory.watchId, sFile, FileChangeTypes::ADDED, timeNow);
+						}
+					}
+					else if (event.mask & IN_MOVED_FROM)
+					{
+						// The directory keeps its watch descriptors wherever it is moved to, and
+						// can no longer be listed, so its remembered files are reported instead
+						forgetDirectories(directory.watchId, sPath + '/');
+
+						std::vector<std::string> files;
+						forgetKnownFiles(directory.watchId, sPath + '/', files);
+						for (const std::string& sFile : files)
+						{
+							record(directory.watchId, sFile, FileChangeTypes::REMOVED, timeNow);
+						}
+					}
+				}
+				else if (event.mask & (IN_CREATE | IN_MOVED_TO))
+				{
+					m_knownFiles.emplace(directory.watchId.getIndex(), sPath);
+					record(directory.watchId, sPath, FileChangeTypes::ADDED, timeNow);
+				}
+				else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+				{
+					m_knownFiles.erase(std::make_pair(directory.watchId.getIndex(), sPath));
+					record(directory.watchId, sPath, FileChangeTypes::REMOVED, timeNow);
+				}
+				else if (event.mask & (IN_MODIFY | IN_CLOSE_WRITE))
+				{
+					record(directory.watchId, sPath, FileChangeTypes::MODIFIED, timeNow);
+				}
+			}
+		}
+	}
+#else
+	(void)timeNow;
+#endif
+}
+
+void FileWatcher::runPolling()
+{
+	struct PolledWatch
+	{
+		Watch watch;
+		bool bScanned;
+		std::unordered_map<std::string, FileStamp> files;
+	};
+
+	std::vector<PolledWatch> polled;
+	std::vector<PolledWatch> scanned;
+	std::vector<FileChange> changes;
+	std::vector<std::string> files;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (!m_bStopping)
+	{
+		// Pick up new watches, and carry over what was found last time for existing ones
+		scanned.clear();
+		m_watches.forEachInRange(0, m_watches.capacity(), [&](const Watch& watch)
+		{
+			PolledWatch polledWatch;
+			polledWatch.watch = watch;
+			polledWatch.bScanned = false;
+			for (PolledWatch& previous : polled)
+			{
+				if (previous.watch.id == watch.id)
+				{
+					polledWatch.bScanned = previous.bScanned;
+					polledWatch.files.swap(previous.files);
+				}
+			}
+
+			scanned.push_back(std::move(polledWatch));
+		});
+
+		lock.unlock();
+
+		// The first scan of a watch only records what is there
+		changes.clear();
+		for (PolledWatch& polledWatch : scanned)
+		{
+			const bool bReport = polledWatch.bScanned;
+			polledWatch.bScanned = true;
+
+			files.clear();
+			DirectoryFileSource(polledWatch.watch.sDirectory).listFiles(files);
+
+			std::unordered_map<std::string, FileStamp> stamps;
+			stamps.reserve(files.size());
+			for (const std::string& sFile : files)
+			{
+				FileStamp stamp;
+				if ((!polledWatch.watch.bRecursive && sFile.find('/') != std::string::npos) ||
+					!stampFile(polledWatch.watch.sDirectory + sFile, stamp))
+				{
+					continue;
+				}
+
+				stamps.emplace(sFile, stamp);
+				if (!bReport)
+				{
+					continue;
+				}
+
+				const auto previous = polledWatch.files.find(sFile);
+				if (previous == polledWatch.files.end())
+				{
+					changes.emplace_back(polledWatch.watch.id, sFile, FileChangeTypes::ADDED);
+				}
+				else if (previous->second != stamp)
+				{
+					changes.emplace_back(polledWatch.watch.id, sFile, FileChangeTypes::MODIFIED);
+				}
+			}
+
+			for (const std::pair<const std::string, FileStamp>& previous : polledWatch.files)
+			{
+				if (bReport && stamps.find(previous.first) == stamps.end())
+				{
+					changes.emplace_back(polledWatch.watch.id, previous.first,
+						FileChangeTypes::REMOVED);
+				}
+			}
+
+			polledWatch.files.swap(stamps);
+		}
+
+		polled.swap(scanned);
+
+		lock.lock();
+		m_polled.insert(m_polled.end(), changes.begin(), changes.end());
+		m_condition.wait_for(lock, m_pollInterval, [this]()
+		{
+			return m_bStopping;
+		});
+	}
+}
@@ -0,0 +1,284 @@
+/**
+The file watcher reports changes to files beneath watched directories so that assets and scripts
+can be reloaded while the engine runs.
+
+On Linux changes are observed through inotify. Elsewhere, or where inotify is unavailable, a
+background thread polls the watched directories for changes to file sizes and modification
+times instead. Both report changes to files only: a directory that is moved in to or out of a
+watch is reported as each of its files being added or removed.
+
+Editors and build tools tend to touch a file several times when saving it. Changes are therefore
+debounced: a file is only reported once no further change to it has been observed for the
+debounce time, and the changes it went through in the meantime are merged in to one. Settled
+changes are delivered to the listeners as a single batch per frame, on the thread that calls
+update. The watcher calls update itself each frame once it is registered with a scheduler.
+
+The file watcher is not thread-safe.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef FILE_WATCHER_H
+#define FILE_WATCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Engine/System/File/FileChange.h"
+#include "Engine/System/File/FileWatchListener.h"
+#include "Engine/System/Schedule/ScheduledItem.h"
+#include "Engine/System/Tools/IndexedVector.h"
+
+enum class FileWatcherBackends
+{
+	/**
+	The watcher is not running. */
+	NONE,
+
+	/**
+	Changes are observed through inotify. */
+	INOTIFY,
+
+	/**
+	Changes are found by polling the watched directories. */
+	POLLING
+};
+
+class FileWatcher : public ScheduledItem
+{
+	public:
+		/**
+		Constructs a watcher that is not running, with a debounce time of 100ms and a poll
+		interval of 500ms. */
+		FileWatcher();
+
+		/**
+		Destructor. Stops the watcher. */
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher& other) = delete;
+		FileWatcher& operator=(const FileWatcher& other) = delete;
+
+		/**
+		Starts the watcher. Does nothing if the watcher is already running.
+		@param bAllowNative True to use inotify where it is available, false to always poll
+		@return True if the watcher is running, false otherwise */
+		bool start(bool bAllowNative = true);
+
+		/**
+		Stops the watcher. Every watch is removed and changes that have not yet been delivered are
+		discarded. */
+		void stop();
+
+		/**
+		Queries whether the watcher is running.
+		@return True if the watcher is running, false otherwise */
+		bool isRunning() const;
+
+		/**
+		Retrieves the backend that observes changes.
+		@return The backend */
+		FileWatcherBackends getBackend() const;
+
+		/**
+		Watches a directory.
+		@param sDirectory The native path of the directory
+		@param bRecursive True to also watch every sub-directory, including those created later
+		@return The id of the watch, or a default id if the watcher is not running or the
+		directory could not be watched */
+		FileWatchId watch(const std::string& sDirectory, bool bRecursive = true);
+
+		/**
+		Stops watching a directory. Changes that have not yet been delivered are discarded. If the
+		watch did not exist, no action is taken.
+		@param id The id of the watch */
+		void unwatch(const FileWatchId& id);
+
+		/**
+		Queries the existence of a watch.
+		@param id The id of the watch
+		@return True if the watch existed, false if it did not */
+		bool watchExists(const FileWatchId& id) const;
+
+		/**
+		Retrieves the directory of a watch.
+		@param id The id of the watch
+		@return The directory with a trailing separator, or an empty string if the watch did not
+		exist */
+		std::string getDirectory(const FileWatchId& id) const;
+
+		/**
+		Sets how long a file must go without changing before its change is delivered.
+		@param debounceTime The debounce time */
+		void setDebounceTime(std::chrono::milliseconds debounceTime);
+
+		/**
+		Retrieves the debounce time.
+		@return The debounce time */
+		std::chrono::milliseconds getDebounceTime() const;
+
+		/**
+		Sets how often the watched directories are scanned when polling.
+		@param pollInterval The poll interval */
+		void setPollInterval(std::chrono::milliseconds pollInterval);
+
+		/**
+		Adds a listener.
+		@param pListener A pointer to the listener to add */
+		void addListener(FileWatchListener* const pListener);
+
+		/**
+		Removes a listener.
+		@param pListener A pointer to the listener to remove */
+		void removeListener(FileWatchListener* const pListener);
+
+		/**
+		Queries the existence of a listener.
+		@param pListener The listener to search for
+		@return True if the listener existed, false if it did not */
+		bool listenerExists(FileWatchListener* const pListener) const;
+
+		/**
+		Collects any new changes and delivers those that have settled to the listeners.
+		@return The number of changes delivered */
+		size_t update();
+
+		/**
+		Reserves room for the given number of changes, so that collecting and delivering them
+		each frame does not allocate.
+		@param uiNumChanges The number of changes */
+		void reserve(size_t uiNumChanges);
+
+		/**
+		Calls update.
+		@param info The time info */
+		void onUpdate(const SchedulerTimeInfo& info) override;
+
+	protected:
+
+	private:
+		typedef std::chrono::steady_clock Clock;
+
+		struct Watch
+		{
+			FileWatchId id;
+
+			/**
+			The directory, with a trailing separator. */
+			std::string sDirectory;
+
+			bool bRecursive;
+
+			Watch() :
+				id(),
+				sDirectory(),
+				bRecursive(true)
+			{
+			}
+		};
+
+		struct PendingChange
+		{
+			FileWatchId watchId;
+			FileChangeTypes type;
+			Clock::time_point timeLastChanged;
+		};
+
+		/**
+		A directory observed by an inotify watch descriptor, relative to the watch that added it.
+		Several watches may observe the same directory. */
+		struct WatchedDirectory
+		{
+			FileWatchId watchId;
+			std::string sRelative;
+		};
+
+		/**
+		Pending changes, keyed by the index of their watch and their path. */
+		typedef std::map<std::pair<size_t, std::string>, PendingChange> PendingChanges;
+
+		IndexedVector<Watch> m_watches;
+		std::vector<FileWatchListener*> m_listeners;
+		PendingChanges m_pending;
+		std::vector<FileChange> m_batch;
+		std::chrono::milliseconds m_debounceTime;
+		FileWatcherBackends m_backend;
+
+		int m_iInotify;
+		std::unordered_map<int, std::vector<WatchedDirectory>> m_directories;
+
+		/**
+		The files beneath inotify watches, keyed by the index of their watch and their path, so
+		that the files of a directory moved out of a watch can still be reported. */
+		std::set<std::pair<size_t, std::string>> m_knownFiles;
+		std::vector<char> m_eventBuffer;
+
+		/**
+		Guards the watches and the polled changes while polling. */
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::chrono::milliseconds m_pollInterval;
+		bool m_bStopping;
+		std::thread m_pollThread;
+		std::vector<FileChange> m_polled;
+
+		/**
+		Records a change, merging it with any pending change to the same file.
+		@param watchId The watch that observed the change
+		@param sPath The path of the file relative to the watch
+		@param type The type of the change
+		@param time The time of the change */
+		void record(const FileWatchId& watchId, const std::string& sPath, FileChangeTypes type,
+			Clock::time_point time);
+
+		/**
+		Adds inotify watches for a directory and, if the watch is recursive, its sub-directories.
+		@param watchId The watch
+		@param sRelative The directory relative to the watch, empty or with a trailing '/'
+		@return True if the directory itself was watched, false otherwise */
+		bool addDirectory(const FileWatchId& watchId, const std::string& sRelative);
+
+		/**
+		Removes the inotify watches a watch holds on a directory and its sub-directories.
+		@param watchId The watch
+		@param sPrefix The directory relative to the watch, empty for every directory */
+		void forgetDirectories(const FileWatchId& watchId, const std::string& sPrefix);
+
+		/**
+		Lists the files beneath a directory of an inotify watch and remembers them.
+		@param watchId The watch
+		@param sRelative The directory relative to the watch, empty or with a trailing '/'
+		@param files Replaced with the path of each file relative to the watch */
+		void listKnownFiles(const FileWatchId& watchId, const std::string& sRelative,
+			std::vector<std::string>& files);
+
+		/**
+		Forgets the remembered files beneath a directory of an inotify watch.
+		@param watchId The watch
+		@param sPrefix The directory relative to the watch, empty for every file
+		@param files Replaced with the path of each forgotten file relative to the watch */
+		void forgetKnownFiles(const FileWatchId& watchId, const std::string& sPrefix,
+			std::vector<std::string>& files);
+
+		/**
+		Reads and records every queued inotify event.
+		@param timeNow The time to record the events at */
+		void readEvents(Clock::time_point timeNow);
+
+		/**
+		Scans the watched directories for changes until the watcher stops. */
+		void runPolling();
+};
+
+#endif
@@ -0,0 +1,331 @@
+#include "Engine/System/File/IoUring.h"
+
+#if defined(__linux__) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <linux/io_uring.h>
+		#include <sys/syscall.h>
+
+		#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+			#define NEB_HAS_IO_URING
+		#endif
+	#endif
+#endif
+
+#ifdef NEB_HAS_IO_URING
+	#include <algorithm>
+	#include <cerrno>
+	#include <cstring>
+	#include <vector>
+
+	#include <sys/mman.h>
+	#include <sys/uio.h>
+	#include <unistd.h>
+
+struct IoUring::State
+{
+	int iRing;
+	unsigned int uiNumEntries;
+
+	void* pSubmissionRing;
+	size_t uiSubmissionRingSize;
+	void* pCompletionRing;
+	size_t uiCompletionRingSize;
+	io_uring_sqe* pSubmissionEntries;
+	size_t uiSubmissionEntriesSize;
+
+	unsigned int* pSubmissionHead;
+	unsigned int* pSubmissionTail;
+	unsigned int* pSubmissionMask;
+	unsigned int* pSubmissionArray;
+	unsigned int* pCompletionHead;
+	unsigned int* pCompletionTail;
+	unsigned int* pCompletionMask;
+	io_uring_cqe* pCompletionEntries;
+
+	/**
+	The number of reads queued since the last submit. */
+	unsigned int uiNumQueued;
+
+	/**
+	The buffer of each slot. These must outlive the submission of their read. */
+	std::vector<iovec> vectors;
+
+	State() :
+		iRing(-1),
+		uiNumEntries(0),
+		pSubmissionRing(MAP_FAILED),
+		uiSubmissionRingSize(0),
+		pCompletionRing(MAP_FAILED),
+		uiCompletionRingSize(0),
+		pSubmissionEntries(static_cast<io_uring_sqe*>(MAP_FAILED)),
+		uiSubmissionEntriesSize(0),
+		pSubmissionHead(nullptr),
+		pSubmissionTail(nullptr),
+		pSubmissionMask(nullptr),
+		pSubmissionArray(nullptr),
+		pCompletionHead(nullptr),
+		pCompletionTail(nullptr),
+		pCompletionMask(nullptr),
+		pCompletionEntries(nullptr),
+		uiNumQueued(0)
+	{
+	}
+
+	~State()
+	{
+		if (pSubmissionEntries != MAP_FAILED)
+		{
+			munmap(pSubmissionEntries, uiSubmissionEntriesSize);
+		}
+		if (pCompletionRing != MAP_FAILED && pCompletionRing != pSubmissionRing)
+		{
+			munmap(pCompletionRing, uiCompletionRingSize);
+		}
+		if (pSubmissionRing != MAP_FAILED)
+		{
+			munmap(pSubmissionRing, uiSubmissionRingSize);
+		}
+		if (iRing >= 0)
+		{
+			::close(iRing);
+		}
+	}
+};
+
+namespace
+{
+	template <typename Type>
+	Type* ringField(void* pRing, std::uint32_t uiOffset)
+	{
+		return reinterpret_cast<Type*>(static_cast<unsigned char*>(pRing) + uiOffset);
+	}
+
+	int enterRing(int iRing, unsigned int uiToSubmit, unsigned int uiMinComplete,
+		unsigned int uiFlags)
+	{
+		return (int)syscall(__NR_io_uring_enter, iRing, uiToSubmit, uiMinComplete, uiFlags,
+			nullptr, 0);
+	}
+}
+
+#else
+
+struct IoUring::State
+{
+};
+
+#endif
+
+IoUring::IoUring()
+{
+}
+
+IoUring::~IoUring()
+{
+	close();
+}
+
+bool IoUring::open(unsigned int uiNumEntries)
+{
+	close();
+
+#ifdef NEB_HAS_IO_URING
+	std::unique_ptr<State> pState(new State());
+
+	io_uring_params params;
+	std::memset(&params, 0, sizeof(params));
+	pState->iRing = (int)syscall(__NR_io_uring_setup, uiNumEntries, &params);
+	if (pState->iRing < 0)
+	{
+		return false;
+	}
+
+	pState->uiNumEntries = params.sq_entries;
+	pState->uiSubmissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+	pState->uiCompletionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	pState->uiSubmissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+	// Newer kernels share a single mapping between both rings
+	const bool bSingleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (bSingleMapping)
+	{
+		pState->uiSubmissionRingSize =
+			std::max(pState->uiSubmissionRingSize, pState->uiCompletionRingSize);
+		pState->uiCompletionRingSize = pState->uiSubmissionRingSize;
+	}
+
+	pState->pSubmissionRing = mmap(nullptr, pState->uiSubmissionRingSize,
+		PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, pState->iRing, IORING_OFF_SQ_RING);
+	if (pState->pSubmissionRing == MAP_FAILED)
+	{
+		return false;
+	}
+
+	pState->pCompletionRing = bSingleMapping ? pState->pSubmissionRing :
+		mmap(nullptr, pState->uiCompletionRingSize, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, pState->iRing, IORING_OFF_CQ_RING);
+	if (pState->pCompletionRing == MAP_FAILED)
+	{
+		return false;
+	}
+
+	pState->pSubmissionEntries = static_cast<io_uring_sqe*>(mmap(nullptr,
+		pState->uiSubmissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		pState->iRing, IORING_OFF_SQES));
+	if (pState->pSubmissionEntries == MAP_FAILED)
+	{
+		return false;
+	}
+
+	void* pSq = pState->pSubmissionRing;
+	void* pCq = pState->pCompletionRing;
+	pState->pSubmissionHead = ringField<unsigned int>(pSq, params.sq_off.head);
+	pState->pSubmissionTail = ringField<unsigned int>(pSq, params.sq_off.tail);
+	pState->pSubmissionMask = ringField<unsigned int>(pSq, params.sq_off.ring_mask);
+	pState->pSubmissionArray = ringField<unsigned int>(pSq, params.sq_off.array);
+	pState->pCompletionHead = ringField<unsigned int>(pCq, params.cq_off.head);
+	pState->pCompletionTail = ringField<unsigned int>(pCq, params.cq_off.tail);
+	pState->pCompletionMask = ringField<unsigned int>(pCq, params.cq_off.ring_mask);
+	pState->pCompletionEntries = ringField<io_uring_cqe>(pCq, params.cq_off.cqes);
+	pState->vectors.resize(pState->uiNumEntries);
+
+	m_pState = std::move(pState);
+	return true;
+#else
+	(void)uiNumEntries;
+	return false;
+#endif
+}
+
+void IoUring::close()
+{
+	m_pState.reset();
+}
+
+bool IoUring::isOpen() const
+{
+	return m_pState != nullptr;
+}
+
+unsigned int IoUring::getNumEntries() const
+{
+#ifdef NEB_HAS_IO_URING
+	return m_pState != nullptr ? m_pState->uiNumEntries : 0;
+#else
+	return 0;
+#endif
+}
+
+bool IoUring::queueRead(unsigned int uiSlot, int iFile, void* pBuffer, size_t uiSize,
+	std::uint64_t uiOffset)
+{
+#ifdef NEB_HAS_IO_URING
+	if (m_pState == nullptr || uiSlot >= m_pState->uiNumEntries)
+	{
+		return false;
+	}
+
+	State& state = *m_pState;
+	const unsigned int uiTail = *state.pSubmissionTail;
+	const unsigned int uiHead = __atomic_load_n(state.pSubmissionHead, __ATOMIC_ACQUIRE);
+	if (uiTail - uiHead >= state.uiNumEntries)
+	{
+		return false;
+	}
+
+	state.vectors[uiSlot].iov_base = pBuffer;
+	state.vectors[uiSlot].iov_len = uiSize;
+
+	const unsigned int uiIndex = uiTail & *state.pSubmissionMask;
+	io_uring_sqe& entry = state.pSubmissionEntries[uiIndex];
+	std::memset(&entry, 0, sizeof(entry));
+	entry.opcode = IORING_OP_READV;
+	entry.fd = iFile;
+	entry.off = uiOffset;
+	entry.addr = reinterpret_cast<std::uint64_t>(&state.vectors[uiSlot]);
+	entry.len = 1;
+	entry.user_data = uiSlot;
+
+	state.pSubmissionArray[uiIndex] = uiIndex;
+	__atomic_store_n(state.pSubmissionTail, uiTail + 1, __ATOMIC_RELEASE);
+	++state.uiNumQueued;
+	return true;
+#else
+	(void)uiSlot;
+	(void)iFile;
+	(void)pBuffer;
+	(void)uiSize;
+	(void)uiOffset;
+	return false;
+#endif
+}
+
+bool IoUring::submit()
+{
+#ifdef NEB_HAS_IO_URING
+	if (m_pState == nullptr)
+	{
+		return false;
+	}
+
+	while (m_pState->uiNumQueued > 0)
+	{
+		const int iSubmitted = enterRing(m_pState->iRing, m_pState->uiNumQueued, 0, 0);
+		if (iSubmitted < 0)
+		{
+			if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+			{
+				continue;
+			}
+
+			return false;
+		}
+
+		m_pState->uiNumQueued -= std::min((unsigned int)iSubmitted, m_pState->uiNumQueued);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool IoUring::reap(unsigned int& uiSlot, int& iResult, bool bWait)
+{
+#ifdef NEB_HAS_IO_URING
+	if (m_pState == nullptr)
+	{
+		return false;
+	}
+
+	State& state = *m_pState;
+	while (true)
+	{
+		const unsigned int uiHead = *state.pCompletionHead;
+		const unsigned int uiTail = __atomic_load_n(state.pCompletionTail, __ATOMIC_ACQUIRE);
+		if (uiHead != uiTail)
+		{
+			const io_uring_cqe& entry = state.pCompletionEntries[uiHead & *state.pCompletionMask];
+			uiSlot = (unsigned int)entry.user_data;
+			iResult = entry.res;
+			__atomic_store_n(state.pCompletionHead, uiHead + 1, __ATOMIC_RELEASE);
+			return true;
+		}
+
+		if (!bWait)
+		{
+			return false;
+		}
+
+		if (enterRing(state.iRing, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+		{
+			return false;
+		}
+	}
+#else
+	(void)uiSlot;
+	(void)iResult;
+	(void)bWait;
+	return false;
+#endif
+}
@@ -0,0 +1,95 @@
+/**
+A minimal io_uring submission and completion ring, driven through raw system calls so that no
+external library is needed. Only positioned reads are supported.
+
+Each read is identified by a slot number chosen by the caller, which is handed back with its
+completion. Slots must be less than the number of entries in the ring, and a slot must not be
+reused until its previous read has completed.
+
+io_uring is only available on Linux, and may be disabled by the kernel or by a sandbox. Opening
+the ring fails wherever it is unavailable, and callers are expected to fall back to blocking
+reads.
+
+The ring is not thread-safe. Submission and completion must happen on a single thread.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef IO_URING_H
+#define IO_URING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class IoUring
+{
+	public:
+		/**
+		Constructs a closed ring. */
+		IoUring();
+
+		/**
+		Destructor. Closes the ring. */
+		~IoUring();
+
+		IoUring(const IoUring& other) = delete;
+		IoUring& operator=(const IoUring& other) = delete;
+
+		/**
+		Opens the ring. Any previously opened ring is closed first.
+		@param uiNumEntries The number of reads that can be in flight at once. The kernel may
+		round this up
+		@return True if the ring was opened, false if io_uring is unavailable */
+		bool open(unsigned int uiNumEntries);
+
+		/**
+		Closes the ring. Reads that are still in flight are abandoned, so their buffers must not
+		be released until the ring is closed. */
+		void close();
+
+		/**
+		Queries whether the ring is open.
+		@return True if the ring is open, false otherwise */
+		bool isOpen() const;
+
+		/**
+		Retrieves the number of entries in the ring.
+		@return The number of entries, or 0 if the ring is not open */
+		unsigned int getNumEntries() const;
+
+		/**
+		Queues a read. The read is not started until submit is called.
+		@param uiSlot The slot identifying the read
+		@param iFile The file descriptor to read from
+		@param pBuffer The buffer to read in to
+		@param uiSize The number of bytes to read
+		@param uiOffset The offset in the file to read from
+		@return True if the read was queued, false if the submission queue is full */
+		bool queueRead(unsigned int uiSlot, int iFile, void* pBuffer, size_t uiSize,
+			std::uint64_t uiOffset);
+
+		/**
+		Starts every queued read.
+		@return True if the reads were submitted, false otherwise */
+		bool submit();
+
+		/**
+		Retrieves the completion of a read.
+		@param uiSlot Set to the slot of the completed read
+		@param iResult Set to the number of bytes read, or a negated errno value on failure
+		@param bWait True to block until a read completes, false to return immediately
+		@return True if a completion was retrieved, false otherwise */
+		bool reap(unsigned int& uiSlot, int& iResult, bool bWait);
+
+	protected:
+
+	private:
+		struct State;
+
+		std::unique_ptr<State> m_pState;
+};
+
+#endif
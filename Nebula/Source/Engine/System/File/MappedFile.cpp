@@ -0,0 +1,184 @@
+#include "Engine/System/File/MappedFile.h"
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() :
+	m_pData(nullptr),
+	m_uiSize(0)
+#ifdef _WIN32
+	,
+	m_hFile(nullptr),
+	m_hMapping(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) :
+	m_pData(other.m_pData),
+	m_uiSize(other.m_uiSize)
+#ifdef _WIN32
+	,
+	m_hFile(other.m_hFile),
+	m_hMapping(other.m_hMapping)
+#endif
+{
+	other.m_pData = nullptr;
+	other.m_uiSize = 0;
+
+#ifdef _WIN32
+	other.m_hFile = nullptr;
+	other.m_hMapping = nullptr;
+#endif
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+	if (this != &other)
+	{
+		close();
+
+		m_pData = other.m_pData;
+		m_uiSize = other.m_uiSize;
+		other.m_pData = nullptr;
+		other.m_uiSize = 0;
+
+#ifdef _WIN32
+		m_hFile = other.m_hFile;
+		m_hMapping = other.m_hMapping;
+		other.m_hFile = nullptr;
+		other.m_hMapping = nullptr;
+#endif
+	}
+
+	return *this;
+}
+
+bool MappedFile::open(const std::string& sPath, MappedFileModes mode)
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE hFile = CreateFileA(sPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(hFile, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(hFile);
+		return false;
+	}
+
+	const bool bCopyOnWrite = mode == MappedFileModes::COPY_ON_WRITE;
+	HANDLE hMapping = CreateFileMappingA(hFile, nullptr,
+		bCopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+	if (hMapping == nullptr)
+	{
+		CloseHandle(hFile);
+		return false;
+	}
+
+	void* pData = MapViewOfFile(hMapping, bCopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+	if (pData == nullptr)
+	{
+		CloseHandle(hMapping);
+		CloseHandle(hFile);
+		return false;
+	}
+
+	m_hFile = hFile;
+	m_hMapping = hMapping;
+	m_pData = pData;
+	m_uiSize = (size_t)size.QuadPart;
+#else
+	const int iFile = ::open(sPath.c_str(), O_RDONLY);
+	if (iFile < 0)
+	{
+		return false;
+	}
+
+	struct stat status;
+	if (fstat(iFile, &status) != 0 || status.st_size <= 0)
+	{
+		::close(iFile);
+		return false;
+	}
+
+	const bool bCopyOnWrite = mode == MappedFileModes::COPY_ON_WRITE;
+	void* pData = mmap(nullptr, (size_t)status.st_size,
+		bCopyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_PRIVATE, iFile, 0);
+
+	// The mapping keeps its own reference to the file
+	::close(iFile);
+
+	if (pData == MAP_FAILED)
+	{
+		return false;
+	}
+
+	m_pData = pData;
+	m_uiSize = (size_t)status.st_size;
+#endif
+
+	return true;
+}
+
+void MappedFile::close()
+{
+	if (m_pData == nullptr)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_pData);
+	CloseHandle(m_hMapping);
+	CloseHandle(m_hFile);
+
+	m_hFile = nullptr;
+	m_hMapping = nullptr;
+#else
+	munmap(m_pData, m_uiSize);
+#endif
+
+	m_pData = nullptr;
+	m_uiSize = 0;
+}
+
+bool MappedFile::isOpen() const
+{
+	return m_pData != nullptr;
+}
+
+void* MappedFile::getData() const
+{
+	return m_pData;
+}
+
+size_t MappedFile::getSize() const
+{
+	return m_uiSize;
+}
@@ -0,0 +1,97 @@
+/**
+A mapped file maps the contents of a file into memory. Pages are loaded by the operating system on
+first access, so opening even a very large file is cheap and no copy is made.
+
+The mapping is either read-only or copy-on-write. Writes to a copy-on-write mapping are private to
+the process and are never written back to the file. Copy-on-write mappings are suitable for
+adopting snapshot images (see IndexedSnapshot.h).
+
+The mapping is page aligned.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+enum class MappedFileModes
+{
+	/**
+	The mapped memory may only be read. */
+	READ_ONLY,
+
+	/**
+	The mapped memory may be read and written. Writes are not written back to the file. */
+	COPY_ON_WRITE
+};
+
+class MappedFile
+{
+	public:
+		/**
+		Constructs a mapped file that does not map anything. */
+		MappedFile();
+
+		/**
+		Destructor. Unmaps the file. */
+		~MappedFile();
+
+		MappedFile(const MappedFile& other) = delete;
+		MappedFile& operator=(const MappedFile& other) = delete;
+
+		/**
+		Move-copy constructor. The other mapped file is left closed.
+		@param other The mapped file to move from */
+		MappedFile(MappedFile&& other);
+
+		/**
+		Move-assignment operator. Closes this mapped file first. The other mapped file is left
+		closed.
+		@param other The mapped file to move from
+		@return A reference to this mapped file */
+		MappedFile& operator=(MappedFile&& other);
+
+		/**
+		Maps a file. Any previously mapped file is closed first. Empty files cannot be mapped.
+		@param sPath The path of the file
+		@param mode The mapping mode
+		@return True if the file was mapped, false otherwise */
+		bool open(const std::string& sPath, MappedFileModes mode = MappedFileModes::READ_ONLY);
+
+		/**
+		Unmaps the file. Any pointers in to the mapping become invalid. */
+		void close();
+
+		/**
+		Queries whether a file is mapped.
+		@return True if a file is mapped, false otherwise */
+		bool isOpen() const;
+
+		/**
+		Retrieves the mapped memory.
+		@return The mapped memory, or a nullptr if no file is mapped */
+		void* getData() const;
+
+		/**
+		Retrieves the size of the mapping.
+		@return The size in bytes, or 0 if no file is mapped */
+		size_t getSize() const;
+
+	protected:
+
+	private:
+		void* m_pData;
+		size_t m_uiSize;
+
+#ifdef _WIN32
+		void* m_hFile;
+		void* m_hMapping;
+#endif
+};
+
+#endif
@@ -0,0 +1,240 @@
+#include "Engine/System/File/PackArchive.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Engine/System/File/PackCodec.h"
+#include "Engine/System/File/VirtualFileSystem.h"
+
+namespace
+{
+	std::uint64_t hashPath(const std::string& sPath)
+	{
+		return packContentHash(reinterpret_cast<const unsigned char*>(sPath.data()),
+			sPath.size());
+	}
+}
+
+PackArchive::PackArchive() :
+	m_pData(nullptr),
+	m_pHeader(nullptr),
+	m_pEntries(nullptr),
+	m_pStrings(nullptr)
+{
+}
+
+PackResults PackArchive::open(const std::string& sPath)
+{
+	close();
+
+	if (!m_file.open(sPath, MappedFileModes::READ_ONLY))
+	{
+		return PackResults::FAIL_IO;
+	}
+
+	m_pData = static_cast<const unsigned char*>(m_file.getData());
+	const PackResults result = validate();
+	if (result != PackResults::SUCCESS)
+	{
+		close();
+		return result;
+	}
+
+	m_pHeader = reinterpret_cast<const PackHeader*>(m_pData);
+	m_pEntries = reinterpret_cast<const PackEntry*>(m_pData + PackHeader::uiTableOffset);
+	m_pStrings = reinterpret_cast<const char*>(m_pData + m_pHeader->uiStringsOffset);
+	return PackResults::SUCCESS;
+}
+
+void PackArchive::close()
+{
+	m_file.close();
+	m_pData = nullptr;
+	m_pHeader = nullptr;
+	m_pEntries = nullptr;
+	m_pStrings = nullptr;
+}
+
+bool PackArchive::isOpen() const
+{
+	return m_pHeader != nullptr;
+}
+
+const PackEntry* PackArchive::find(const std::string& sPath) const
+{
+	if (!isOpen())
+	{
+		return nullptr;
+	}
+
+	const std::string sNormalised = VirtualFileSystem::normalisePath(sPath);
+	const std::uint64_t uiPathHash = hashPath(sNormalised);
+	for (const PackEntry* pEntry = lowerBound(uiPathHash);
+		pEntry != entriesEnd() && pEntry->uiPathHash == uiPathHash; ++pEntry)
+	{
+		if (pEntry->uiPathLength == sNormalised.size() &&
+			std::memcmp(m_pStrings + pEntry->uiPathOffset, sNormalised.data(),
+			sNormalised.size()) == 0)
+		{
+			return pEntry;
+		}
+	}
+
+	return nullptr;
+}
+
+const PackEntry* PackArchive::find(const char* sPath) const
+{
+	return find(std::string(sPath));
+}
+
+const PackEntry* PackArchive::find(const StringId& pathId) const
+{
+	if (!isOpen())
+	{
+		return nullptr;
+	}
+
+	const PackEntry* pEntry = lowerBound(pathId.getHash());
+	return pEntry != entriesEnd() && pEntry->uiPathHash == pathId.getHash() ? pEntry : nullptr;
+}
+
+std::string PackArchive::getPath(const PackEntry& entry) const
+{
+	return std::string(m_pStrings + entry.uiPathOffset, entry.uiPathLength);
+}
+
+bool PackArchive::getView(const PackEntry& entry, VirtualFileView& view) const
+{
+	if (entry.uiCompression != (std::uint32_t)PackCompressions::NONE)
+	{
+		return false;
+	}
+
+	view.pData = m_pData + entry.uiDataOffset;
+	view.uiSize = (size_t)entry.uiSize;
+	return true;
+}
+
+bool PackArchive::read(const PackEntry& entry, std::vector<unsigned char>& data) const
+{
+	const unsigned char* pStored = m_pData + entry.uiDataOffset;
+	if (entry.uiCompression == (std::uint32_t)PackCompressions::NONE)
+	{
+		data.assign(pStored, pStored + entry.uiSize);
+		return true;
+	}
+
+	data.resize((size_t)entry.uiSize);
+	if (!packDecompress(pStored, (size_t)entry.uiStoredSize, data.data(), data.size()))
+	{
+		data.clear();
+		return false;
+	}
+
+	return true;
+}
+
+bool PackArchive::verify(const PackEntry& entry) const
+{
+	VirtualFileView view;
+	if (getView(entry, view))
+	{
+		return packContentHash(static_cast<const unsigned char*>(view.pData), view.uiSize) ==
+			entry.uiContentHash;
+	}
+
+	std::vector<unsigned char> data;
+	return read(entry, data) && packContentHash(data.data(), data.size()) == entry.uiContentHash;
+}
+
+size_t PackArchive::getNumEntries() const
+{
+	return isOpen() ? m_pHeader->uiNumEntries : 0;
+}
+
+void PackArchive::listFiles(std::vector<std::string>& files) const
+{
+	for (const PackEntry* pEntry = m_pEntries; pEntry != entriesEnd(); ++pEntry)
+	{
+		files.push_back(getPath(*pEntry));
+	}
+}
+
+bool PackArchive::read(const std::string& sPath, std::vector<unsigned char>& data) const
+{
+	const PackEntry* pEntry = find(sPath);
+	return pEntry != nullptr && read(*pEntry, data);
+}
+
+bool PackArchive::getView(const std::string& sPath, VirtualFileView& view) const
+{
+	const PackEntry* pEntry = find(sPath);
+	return pEntry != nullptr && getView(*pEntry, view);
+}
+
+PackResults PackArchive::validate() const
+{
+	const std::uint64_t uiSize = m_file.getSize();
+	if (uiSize < PackHeader::uiTableOffset)
+	{
+		return PackResults::FAIL_INVALID_ARCHIVE;
+	}
+
+	const PackHeader& header = *reinterpret_cast<const PackHeader*>(m_pData);
+	if (header.uiMagic != PackHeader::uiPackMagic)
+	{
+		return PackResults::FAIL_INVALID_ARCHIVE;
+	}
+	else if (header.uiFormat > PackHeader::uiPackFormat)
+	{
+		return PackResults::FAIL_UNSUPPORTED_FORMAT;
+	}
+
+	const std::uint64_t uiStringsEnd = header.uiStringsOffset + header.uiStringsSize;
+	if (header.uiFileSize > uiSize || header.uiAlignment == 0 ||
+		(header.uiAlignment & (header.uiAlignment - 1)) != 0 ||
+		header.uiStringsOffset != PackHeader::uiTableOffset +
+		(std::uint64_t)header.uiNumEntries * sizeof(PackEntry) ||
+		uiStringsEnd < header.uiStringsOffset || uiStringsEnd > header.uiDataOffset ||
+		header.uiDataOffset > header.uiFileSize)
+	{
+		return PackResults::FAIL_INVALID_ARCHIVE;
+	}
+
+	const PackEntry* pEntries =
+		reinterpret_cast<const PackEntry*>(m_pData + PackHeader::uiTableOffset);
+	for (std::uint32_t i = 0; i < header.uiNumEntries; ++i)
+	{
+		const PackEntry& entry = pEntries[i];
+		const std::uint64_t uiDataEnd = entry.uiDataOffset + entry.uiStoredSize;
+		const bool bIsSorted = i == 0 || pEntries[i - 1].uiPathHash <= entry.uiPathHash;
+		const bool bIsCompressed = entry.uiCompression == (std::uint32_t)PackCompressions::LZ;
+		const bool bIsStored = entry.uiCompression == (std::uint32_t)PackCompressions::NONE;
+
+		if (!bIsSorted || (!bIsCompressed && !bIsStored) ||
+			(bIsStored && entry.uiStoredSize != entry.uiSize) ||
+			entry.uiDataOffset < header.uiDataOffset || uiDataEnd < entry.uiDataOffset ||
+			uiDataEnd > header.uiFileSize ||
+			(std::uint64_t)entry.uiPathOffset + entry.uiPathLength > header.uiStringsSize)
+		{
+			return PackResults::FAIL_INVALID_ARCHIVE;
+		}
+	}
+
+	return PackResults::SUCCESS;
+}
+
+const PackEntry* PackArchive::lowerBound(std::uint64_t uiPathHash) const
+{
+	return std::lower_bound(m_pEntries, entriesEnd(), uiPathHash,
+		[](const PackEntry& entry, std::uint64_t uiHash)
+	{
+		return entry.uiPathHash < uiHash;
+	});
+}
+
+const PackEntry* PackArchive::entriesEnd() const
+{
+	return m_pEntries != nullptr ? m_pEntries + m_pHeader->uiNumEntries : nullptr;
+}
@@ -0,0 +1,151 @@
+/**
+A pack archive provides read access to a pack file (see PackFormat.h). The pack is memory mapped,
+so opening it costs a handful of system calls however many files it holds, and pages are only
+loaded as they are touched. Uncompressed files are handed out as views straight in to the mapping
+without any copy.
+
+Files are found by binary searching the table of contents by path hash. A pack archive is a
+virtual file source, so it can be mounted in to the virtual file system alongside, or overriding,
+loose directories.
+
+The table of contents is validated when the pack is opened. File contents are only checked
+against their hashes on request, see verify.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PACK_ARCHIVE_H
+#define PACK_ARCHIVE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Engine/System/File/MappedFile.h"
+#include "Engine/System/File/PackFormat.h"
+#include "Engine/System/File/VirtualFileSource.h"
+#include "Engine/System/Tools/StringId.h"
+
+class PackArchive : public VirtualFileSource
+{
+	public:
+		/**
+		Constructs a pack archive with no pack open. */
+		PackArchive();
+
+		PackArchive(const PackArchive& other) = delete;
+		PackArchive& operator=(const PackArchive& other) = delete;
+
+		/**
+		Opens a pack. Any previously opened pack is closed first.
+		@param sPath The path of the pack file
+		@return The result of the operation */
+		PackResults open(const std::string& sPath);
+
+		/**
+		Closes the pack. Any views of its files become invalid. */
+		void close();
+
+		/**
+		Queries whether a pack is open.
+		@return True if a pack is open, false otherwise */
+		bool isOpen() const;
+
+		/**
+		Finds a file.
+		@param sPath The path of the file
+		@return The file's entry, or a nullptr if the pack does not contain the file */
+		const PackEntry* find(const std::string& sPath) const;
+
+		/**
+		Finds a file.
+		@param sPath The null terminated path of the file
+		@return The file's entry, or a nullptr if the pack does not contain the file */
+		const PackEntry* find(const char* sPath) const;
+
+		/**
+		Finds a file by the string id of its path, without comparing the path itself. Should two
+		paths in the pack share an id, the first is returned.
+		@param pathId The string id of the normalised path
+		@return The file's entry, or a nullptr if the pack does not contain the file */
+		const PackEntry* find(const StringId& pathId) const;
+
+		/**
+		Retrieves the path of a file.
+		@param entry The file's entry
+		@return The path */
+		std::string getPath(const PackEntry& entry) const;
+
+		/**
+		Retrieves the contents of an uncompressed file without copying them.
+		@param entry The file's entry
+		@param view Set to the contents of the file
+		@return True if a view was provided, false if the file is compressed */
+		bool getView(const PackEntry& entry, VirtualFileView& view) const;
+
+		/**
+		Reads the whole of a file, decompressing it if needed.
+		@param entry The file's entry
+		@param data Replaced with the contents of the file
+		@return True if the file was read, false if its compressed data was malformed */
+		bool read(const PackEntry& entry, std::vector<unsigned char>& data) const;
+
+		/**
+		Checks a file's contents against its content hash.
+		@param entry The file's entry
+		@return True if the contents match, false otherwise */
+		bool verify(const PackEntry& entry) const;
+
+		/**
+		Retrieves the number of files in the pack.
+		@return The number of files, or 0 if no pack is open */
+		size_t getNumEntries() const;
+
+		/**
+		Lists every file in the pack.
+		@param files Appended with the path of each file */
+		void listFiles(std::vector<std::string>& files) const override;
+
+		/**
+		Reads the whole of a file, decompressing it if needed.
+		@param sPath The path of the file
+		@param data Replaced with the contents of the file
+		@return True if the file was read, false otherwise */
+		bool read(const std::string& sPath, std::vector<unsigned char>& data) const override;
+
+		/**
+		Retrieves the contents of an uncompressed file without copying them.
+		@param sPath The path of the file
+		@param view Set to the contents of the file
+		@return True if a view was provided, false if the file does not exist or is compressed */
+		bool getView(const std::string& sPath, VirtualFileView& view) const override;
+
+	protected:
+
+	private:
+		MappedFile m_file;
+		const unsigned char* m_pData;
+		const PackHeader* m_pHeader;
+		const PackEntry* m_pEntries;
+		const char* m_pStrings;
+
+		/**
+		Checks that the mapped pack is well formed.
+		@return The result of the check */
+		PackResults validate() const;
+
+		/**
+		Finds the first entry with the given path hash.
+		@param uiPathHash The path hash
+		@return The first entry with a path hash not less than the given hash */
+		const PackEntry* lowerBound(std::uint64_t uiPathHash) const;
+
+		/**
+		Retrieves the end of the table of contents.
+		@return A pointer past the last entry */
+		const PackEntry* entriesEnd() const;
+};
+
+#endif
@@ -0,0 +1,213 @@
+#include "Engine/System/File/PackCodec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	/**
+	The shortest match worth encoding. */
+	const size_t uiMinMatch = 4;
+
+	/**
+	The furthest back a match can be, limited by the two byte offset. */
+	const size_t uiMaxOffset = 65535;
+
+	/**
+	The number of bits used to index the match finder's table of recent positions. */
+	const size_t uiHashBits = 14;
+
+	/**
+	The largest length that fits in a token nibble. Longer lengths continue in extra bytes. */
+	const size_t uiNibbleMax = 15;
+
+	const size_t uiNoPosition = (size_t)-1;
+
+	std::uint32_t read32(const unsigned char* pData)
+	{
+		std::uint32_t uiValue;
+		std::memcpy(&uiValue, pData, sizeof(uiValue));
+		return uiValue;
+	}
+
+	void writeExtraLength(std::vector<unsigned char>& out, size_t uiLength)
+	{
+		while (uiLength >= 255)
+		{
+			out.push_back(255);
+			uiLength -= 255;
+		}
+
+		out.push_back((unsigned char)uiLength);
+	}
+
+	bool readExtraLength(const unsigned char*& pIn, const unsigned char* pInEnd, size_t& uiLength)
+	{
+		unsigned char uiByte;
+		do
+		{
+			if (pIn == pInEnd)
+			{
+				return false;
+			}
+
+			uiByte = *pIn++;
+			uiLength += uiByte;
+		}
+		while (uiByte == 255);
+
+		return true;
+	}
+
+	/**
+	Writes a sequence. A match length of zero writes the final, literal only, sequence. */
+	void writeSequence(std::vector<unsigned char>& out, const unsigned char* pLiterals,
+		size_t uiNumLiterals, size_t uiOffset, size_t uiMatchLength)
+	{
+		const size_t uiMatchCode = uiMatchLength != 0 ? uiMatchLength - uiMinMatch : 0;
+		out.push_back((unsigned char)((std::min(uiNumLiterals, uiNibbleMax) << 4) |
+			std::min(uiMatchCode, uiNibbleMax)));
+
+		if (uiNumLiterals >= uiNibbleMax)
+		{
+			writeExtraLength(out, uiNumLiterals - uiNibbleMax);
+		}
+
+		out.insert(out.end(), pLiterals, pLiterals + uiNumLiterals);
+
+		if (uiMatchLength != 0)
+		{
+			out.push_back((unsigned char)(uiOffset & 0xFF));
+			out.push_back((unsigned char)(uiOffset >> 8));
+			if (uiMatchCode >= uiNibbleMax)
+			{
+				writeExtraLength(out, uiMatchCode - uiNibbleMax);
+			}
+		}
+	}
+}
+
+void packCompress(const unsigned char* pSource, size_t uiSourceSize,
+	std::vector<unsigned char>& compressed)
+{
+	compressed.clear();
+	compressed.reserve(uiSourceSize / 2 + 16);
+
+	std::vector<size_t> recentPositions((size_t)1 << uiHashBits, uiNoPosition);
+	size_t uiAnchor = 0;
+	size_t i = 0;
+
+	while (i + uiMinMatch <= uiSourceSize)
+	{
+		const std::uint32_t uiSequence = read32(pSource + i);
+		const size_t uiHash = (size_t)((uiSequence * 2654435761u) >> (32 - uiHashBits));
+		const size_t uiCandidate = recentPositions[uiHash];
+		recentPositions[uiHash] = i;
+
+		if (uiCandidate != uiNoPosition && i - uiCandidate <= uiMaxOffset &&
+			read32(pSource + uiCandidate) == uiSequence)
+		{
+			size_t uiLength = uiMinMatch;
+			while (i + uiLength < uiSourceSize && pSource[uiCandidate + uiLength] ==
+				pSource[i + uiLength])
+			{
+				++uiLength;
+			}
+
+			writeSequence(compressed, pSource + uiAnchor, i - uiAnchor, i - uiCandidate,
+				uiLength);
+			i += uiLength;
+			uiAnchor = i;
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	writeSequence(compressed, pSource + uiAnchor, uiSourceSize - uiAnchor, 0, 0);
+}
+
+bool packDecompress(const unsigned char* pSource, size_t uiSourceSize,
+	unsigned char* pDestination, size_t uiDestinationSize)
+{
+	const unsigned char* pIn = pSource;
+	const unsigned char* const pInEnd = pSource + uiSourceSize;
+	unsigned char* pOut = pDestination;
+	unsigned char* const pOutEnd = pDestination + uiDestinationSize;
+
+	while (pIn < pInEnd)
+	{
+		const unsigned char uiToken = *pIn++;
+
+		size_t uiNumLiterals = uiToken >> 4;
+		if (uiNumLiterals == uiNibbleMax && !readExtraLength(pIn, pInEnd, uiNumLiterals))
+		{
+			return false;
+		}
+		if (uiNumLiterals > (size_t)(pInEnd - pIn) || uiNumLiterals > (size_t)(pOutEnd - pOut))
+		{
+			return false;
+		}
+
+		if (uiNumLiterals != 0)
+		{
+			std::memcpy(pOut, pIn, uiNumLiterals);
+		}
+
+		pIn += uiNumLiterals;
+		pOut += uiNumLiterals;
+
+		// The final sequence has no match
+		if (pIn == pInEnd)
+		{
+			break;
+		}
+
+		if (pInEnd - pIn < 2)
+		{
+			return false;
+		}
+
+		const size_t uiOffset = (size_t)pIn[0] | ((size_t)pIn[1] << 8);
+		pIn += 2;
+		if (uiOffset == 0 || uiOffset > (size_t)(pOut - pDestination))
+		{
+			return false;
+		}
+
+		size_t uiLength = uiToken & 0x0F;
+		if (uiLength == uiNibbleMax && !readExtraLength(pIn, pInEnd, uiLength))
+		{
+			return false;
+		}
+
+		uiLength += uiMinMatch;
+		if (uiLength > (size_t)(pOutEnd - pOut))
+		{
+			return false;
+		}
+
+		// Matches may overlap the bytes they produce, so copy a byte at a time
+		const unsigned char* pMatch = pOut - uiOffset;
+		for (size_t i = 0; i < uiLength; ++i)
+		{
+			pOut[i] = pMatch[i];
+		}
+
+		pOut += uiLength;
+	}
+
+	return pOut == pOutEnd;
+}
+
+std::uint64_t packContentHash(const unsigned char* pData, size_t uiSize)
+{
+	std::uint64_t uiHash = 0xCBF29CE484222325ull;
+	for (size_t i = 0; i < uiSize; ++i)
+	{
+		uiHash = (uiHash ^ pData[i]) * 0x100000001B3ull;
+	}
+
+	return uiHash;
+}
@@ -0,0 +1,48 @@
+/**
+The codec used for pack archive data. Compression is a byte oriented LZ77 scheme in the style of
+LZ4, chosen for decompression speed over ratio. The stream is a series of sequences, each of
+which is a token byte holding the literal and match lengths, any extra literal length bytes, the
+literals, a two byte little endian match offset and any extra match length bytes. The final
+sequence holds literals only.
+
+Content hashes are 64 bit FNV-1a.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PACK_CODEC_H
+#define PACK_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+Compresses data.
+@param pSource The data
+@param uiSourceSize The size of the data in bytes
+@param compressed Replaced with the compressed data. May be larger than the source if the data
+does not compress */
+void packCompress(const unsigned char* pSource, size_t uiSourceSize,
+	std::vector<unsigned char>& compressed);
+
+/**
+Decompresses data. Malformed input is detected rather than read or written out of bounds.
+@param pSource The compressed data
+@param uiSourceSize The size of the compressed data in bytes
+@param pDestination The buffer to decompress to
+@param uiDestinationSize The exact size of the uncompressed data in bytes
+@return True if the data was decompressed, false if it was malformed */
+bool packDecompress(const unsigned char* pSource, size_t uiSourceSize,
+	unsigned char* pDestination, size_t uiDestinationSize);
+
+/**
+Hashes the contents of a file.
+@param pData The data
+@param uiSize The size of the data in bytes
+@return The hash */
+std::uint64_t packContentHash(const unsigned char* pData, size_t uiSize);
+
+#endif
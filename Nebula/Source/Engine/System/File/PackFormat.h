@@ -0,0 +1,123 @@
+/**
+The on-disk layout of a pack archive. A pack is a single file holding many smaller files, so that
+an entire data directory can be opened and mapped with a handful of system calls.
+
+A pack consists of, in order:
+- A fixed size header
+- The table of contents, an array of entries sorted by path hash
+- The string table holding each entry's path, without null terminators
+- The file data. Each file starts on a multiple of the pack's alignment
+
+Path hashes are string ids (see StringId.h) of the normalised path. A file's data is stored either
+verbatim, in which case it can be used straight from the mapped pack, or compressed (see
+PackCodec.h). Every entry records a hash of its uncompressed contents.
+
+Packs are written in the byte order of the writing platform, and only little endian platforms are
+supported.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PACK_FORMAT_H
+#define PACK_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+enum class PackResults
+{
+	/**
+	The operation was successful. */
+	SUCCESS,
+
+	/**
+	The operation failed because a file could not be opened, read or written. */
+	FAIL_IO,
+
+	/**
+	The operation failed because the file is not a pack, or is corrupt. */
+	FAIL_INVALID_ARCHIVE,
+
+	/**
+	The operation failed because the pack was written in a newer format. */
+	FAIL_UNSUPPORTED_FORMAT
+};
+
+enum class PackCompressions : std::uint32_t
+{
+	/**
+	The data is stored verbatim. */
+	NONE,
+
+	/**
+	The data is compressed with the pack codec. */
+	LZ
+};
+
+struct PackHeader
+{
+	/**
+	Identifies a pack. The bytes "NPAK" when read in little endian order. */
+	static const std::uint32_t uiPackMagic = 0x4B41504E;
+
+	/**
+	The current pack format. */
+	static const std::uint32_t uiPackFormat = 1;
+
+	/**
+	The offset of the table of contents from the start of a pack. */
+	static const size_t uiTableOffset = 64;
+
+	std::uint32_t uiMagic;
+	std::uint32_t uiFormat;
+	std::uint32_t uiNumEntries;
+	std::uint32_t uiAlignment;
+	std::uint64_t uiStringsOffset;
+	std::uint64_t uiStringsSize;
+	std::uint64_t uiDataOffset;
+	std::uint64_t uiFileSize;
+};
+
+static_assert(sizeof(PackHeader) <= PackHeader::uiTableOffset,
+	"PackHeader must fit before the table of contents.");
+
+struct PackEntry
+{
+	/**
+	The string id of the entry's path. */
+	std::uint64_t uiPathHash;
+
+	/**
+	The hash of the uncompressed data. */
+	std::uint64_t uiContentHash;
+
+	/**
+	The offset of the data from the start of the pack. */
+	std::uint64_t uiDataOffset;
+
+	/**
+	The size of the data as stored in the pack. */
+	std::uint64_t uiStoredSize;
+
+	/**
+	The size of the data once uncompressed. */
+	std::uint64_t uiSize;
+
+	/**
+	The offset of the path within the string table. */
+	std::uint32_t uiPathOffset;
+
+	/**
+	The length of the path. */
+	std::uint32_t uiPathLength;
+
+	/**
+	How the data is stored. One of PackCompressions. */
+	std::uint32_t uiCompression;
+
+	std::uint32_t uiReserved;
+};
+
+#endif
@@ -0,0 +1,198 @@
+#include "Engine/System/File/PackWriter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "Engine/System/File/PackCodec.h"
+#include "Engine/System/File/VirtualFileSystem.h"
+
+namespace
+{
+	std::uint64_t alignOffset(std::uint64_t uiOffset, std::uint64_t uiAlignment)
+	{
+		return (uiOffset + uiAlignment - 1) & ~(uiAlignment - 1);
+	}
+
+	void writePadding(std::ofstream& file, std::uint64_t uiFrom, std::uint64_t uiTo)
+	{
+		static const char padding[256] = {};
+		while (uiFrom < uiTo)
+		{
+			const std::uint64_t uiCount = std::min<std::uint64_t>(uiTo - uiFrom, sizeof(padding));
+			file.write(padding, (std::streamsize)uiCount);
+			uiFrom += uiCount;
+		}
+	}
+}
+
+PackWriter::PackWriter(size_t uiAlignment) :
+	m_uiAlignment(1)
+{
+	while (m_uiAlignment < uiAlignment)
+	{
+		m_uiAlignment <<= 1;
+	}
+}
+
+void PackWriter::add(const std::string& sPath, const void* pData, size_t uiSize,
+	PackCompressions compression)
+{
+	const unsigned char* pBytes = static_cast<const unsigned char*>(pData);
+
+	File file;
+	file.compression = PackCompressions::NONE;
+	file.uiContentHash = packContentHash(pBytes, uiSize);
+	file.uiSize = uiSize;
+
+	if (compression == PackCompressions::LZ)
+	{
+		packCompress(pBytes, uiSize, file.storedData);
+		if (file.storedData.size() < uiSize)
+		{
+			file.compression = PackCompressions::LZ;
+		}
+	}
+
+	if (file.compression == PackCompressions::NONE)
+	{
+		file.storedData.assign(pBytes, pBytes + uiSize);
+	}
+
+	m_files[VirtualFileSystem::normalisePath(sPath)] = std::move(file);
+}
+
+size_t PackWriter::addSource(const VirtualFileSource& source, PackCompressions compression)
+{
+	std::vector<std::string> paths;
+	source.listFiles(paths);
+
+	size_t uiNumAdded = 0;
+	std::vector<unsigned char> data;
+	for (const std::string& sPath : paths)
+	{
+		if (source.read(sPath, data))
+		{
+			add(sPath, data.data(), data.size(), compression);
+			++uiNumAdded;
+		}
+	}
+
+	return uiNumAdded;
+}
+
+PackResults PackWriter::write(const std::string& sPath) const
+{
+	struct Placement
+	{
+		const std::string* pPath;
+		const File* pFile;
+		PackEntry entry;
+	};
+
+	// Lay out the table of contents, then the string table, then the data
+	std::vector<Placement> placements;
+	placements.reserve(m_files.size());
+
+	std::uint64_t uiStringsSize = 0;
+	for (const std::pair<const std::string, File>& file : m_files)
+	{
+		Placement placement;
+		placement.pPath = &file.first;
+		placement.pFile = &file.second;
+		std::memset(&placement.entry, 0, sizeof(placement.entry));
+		placement.entry.uiPathHash = packContentHash(
+			reinterpret_cast<const unsigned char*>(file.first.data()), file.first.size());
+		placement.entry.uiContentHash = file.second.uiContentHash;
+		placement.entry.uiStoredSize = file.second.storedData.size();
+		placement.entry.uiSize = file.second.uiSize;
+		placement.entry.uiPathOffset = (std::uint32_t)uiStringsSize;
+		placement.entry.uiPathLength = (std::uint32_t)file.first.size();
+		placement.entry.uiCompression = (std::uint32_t)file.second.compression;
+		placements.push_back(placement);
+
+		uiStringsSize += file.first.size();
+	}
+
+	if (uiStringsSize > 0xFFFFFFFFull || placements.size() > 0xFFFFFFFFull)
+	{
+		return PackResults::FAIL_INVALID_ARCHIVE;
+	}
+
+	// Files are found by binary searching their path hash. Paths break ties between hashes
+	std::sort(placements.begin(), placements.end(), [](const Placement& a, const Placement& b)
+	{
+		if (a.entry.uiPathHash != b.entry.uiPathHash)
+		{
+			return a.entry.uiPathHash < b.entry.uiPathHash;
+		}
+
+		return *a.pPath < *b.pPath;
+	});
+
+	const std::uint64_t uiStringsOffset =
+		PackHeader::uiTableOffset + placements.size() * sizeof(PackEntry);
+	const std::uint64_t uiDataOffset = alignOffset(uiStringsOffset + uiStringsSize,
+		m_uiAlignment);
+
+	std::uint64_t uiOffset = uiDataOffset;
+	for (Placement& placement : placements)
+	{
+		uiOffset = alignOffset(uiOffset, m_uiAlignment);
+		placement.entry.uiDataOffset = uiOffset;
+		uiOffset += placement.entry.uiStoredSize;
+	}
+
+	PackHeader header;
+	std::memset(&header, 0, sizeof(header));
+	header.uiMagic = PackHeader::uiPackMagic;
+	header.uiFormat = PackHeader::uiPackFormat;
+	header.uiNumEntries = (std::uint32_t)placements.size();
+	header.uiAlignment = (std::uint32_t)m_uiAlignment;
+	header.uiStringsOffset = uiStringsOffset;
+	header.uiStringsSize = uiStringsSize;
+	header.uiDataOffset = uiDataOffset;
+	header.uiFileSize = uiOffset;
+
+	std::ofstream file(sPath, std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		return PackResults::FAIL_IO;
+	}
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	writePadding(file, sizeof(header), PackHeader::uiTableOffset);
+
+	for (const Placement& placement : placements)
+	{
+		file.write(reinterpret_cast<const char*>(&placement.entry), sizeof(PackEntry));
+	}
+
+	// The string table is in path order, matching the path offsets assigned above
+	for (const std::pair<const std::string, File>& entry : m_files)
+	{
+		file.write(entry.first.data(), (std::streamsize)entry.first.size());
+	}
+
+	uiOffset = uiStringsOffset + uiStringsSize;
+	for (const Placement& placement : placements)
+	{
+		writePadding(file, uiOffset, placement.entry.uiDataOffset);
+		file.write(reinterpret_cast<const char*>(placement.pFile->storedData.data()),
+			(std::streamsize)placement.entry.uiStoredSize);
+		uiOffset = placement.entry.uiDataOffset + placement.entry.uiStoredSize;
+	}
+
+	writePadding(file, uiOffset, header.uiFileSize);
+	return file.good() ? PackResults::SUCCESS : PackResults::FAIL_IO;
+}
+
+void PackWriter::clear()
+{
+	m_files.clear();
+}
+
+size_t PackWriter::getNumFiles() const
+{
+	return m_files.size();
+}
@@ -0,0 +1,79 @@
+/**
+A pack writer gathers files in memory and writes them out as a pack archive (see PackFormat.h).
+Files are compressed as they are added, and are stored uncompressed instead whenever compression
+would not make them smaller.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PACK_WRITER_H
+#define PACK_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Engine/System/File/PackFormat.h"
+#include "Engine/System/File/VirtualFileSource.h"
+
+class PackWriter
+{
+	public:
+		/**
+		Constructs an empty pack writer.
+		@param uiAlignment The alignment of each file's data within the pack. Rounded up to a
+		power of two */
+		PackWriter(size_t uiAlignment = 64);
+
+		/**
+		Adds a file. Overwrites if a file with the same path was already added.
+		@param sPath The path of the file within the pack
+		@param pData The contents of the file
+		@param uiSize The size of the file in bytes
+		@param compression How the file should be stored */
+		void add(const std::string& sPath, const void* pData, size_t uiSize,
+			PackCompressions compression = PackCompressions::NONE);
+
+		/**
+		Adds every file provided by a source, such as a loose data directory.
+		@param source The source
+		@param compression How the files should be stored
+		@return The number of files added */
+		size_t addSource(const VirtualFileSource& source,
+			PackCompressions compression = PackCompressions::NONE);
+
+		/**
+		Writes the pack.
+		@param sPath The path of the pack file
+		@return The result of the operation */
+		PackResults write(const std::string& sPath) const;
+
+		/**
+		Removes every file. */
+		void clear();
+
+		/**
+		Retrieves the number of files.
+		@return The number of files */
+		size_t getNumFiles() const;
+
+	protected:
+
+	private:
+		struct File
+		{
+			PackCompressions compression;
+			std::uint64_t uiContentHash;
+			std::uint64_t uiSize;
+			std::vector<unsigned char> storedData;
+		};
+
+		size_t m_uiAlignment;
+		std::map<std::string, File> m_files;
+};
+
+#endif
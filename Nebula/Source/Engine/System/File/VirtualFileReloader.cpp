@@ -0,0 +1,159 @@
+#include "Engine/System/File/VirtualFileReloader.h"
+
+#include <algorithm>
+
+VirtualFileReloader::VirtualFileReloader(VirtualFileSystem& fileSystem, FileWatcher& watcher) :
+	m_fileSystem(fileSystem),
+	m_watcher(watcher)
+{
+	m_watcher.addListener(this);
+}
+
+VirtualFileReloader::~VirtualFileReloader()
+{
+	m_watcher.removeListener(this);
+	for (const WatchedMount& mount : m_mounts)
+	{
+		m_watcher.unwatch(mount.watchId);
+	}
+}
+
+VirtualFileSystem::MountId VirtualFileReloader::mount(const std::string& sMountPoint,
+	std::shared_ptr<DirectoryFileSource> pSource, int iPriority)
+{
+	if (pSource == nullptr)
+	{
+		return VirtualFileSystem::MountId();
+	}
+
+	WatchedMount mount;
+	mount.watchId = m_watcher.watch(pSource->getRoot());
+	mount.sMountPoint = VirtualFileSystem::normalisePath(sMountPoint);
+	mount.pSource = pSource.get();
+	mount.mountId = m_fileSystem.mount(sMountPoint, std::move(pSource), iPriority);
+
+	if (m_watcher.watchExists(mount.watchId))
+	{
+		m_mounts.push_back(mount);
+	}
+
+	return mount.mountId;
+}
+
+void VirtualFileReloader::unmount(const VirtualFileSystem::MountId& id)
+{
+	for (std::vector<WatchedMount>::iterator it = m_mounts.begin(); it != m_mounts.end(); ++it)
+	{
+		if (it->mountId == id)
+		{
+			m_watcher.unwatch(it->watchId);
+			m_mounts.erase(it);
+			break;
+		}
+	}
+
+	m_fileSystem.unmount(id);
+}
+
+bool VirtualFileReloader::isWatched(const VirtualFileSystem::MountId& id) const
+{
+	return std::any_of(m_mounts.begin(), m_mounts.end(), [&id](const WatchedMount& mount)
+	{
+		return mount.mountId == id;
+	});
+}
+
+void VirtualFileReloader::addListener(FileWatchListener* const pListener)
+{
+	if (pListener != nullptr && !listenerExists(pListener))
+	{
+		m_listeners.push_back(pListener);
+	}
+}
+
+void VirtualFileReloader::removeListener(FileWatchListener* const pListener)
+{
+	m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), pListener),
+		m_listeners.end());
+}
+
+bool VirtualFileReloader::listenerExists(FileWatchListener* const pListener) const
+{
+	return std::find(m_listeners.begin(), m_listeners.end(), pListener) != m_listeners.end();
+}
+
+void VirtualFileReloader::onFilesChanged(const std::vector<FileChange>& changes)
+{
+	m_changes.clear();
+	for (const WatchedMount& mount : m_mounts)
+	{
+		// Note which source provided each changed file before the mount is listed again
+		const size_t uiFirstChange = m_changes.size();
+		m_previousSources.clear();
+		for (const FileChange& change : changes)
+		{
+			if (change.watchId == mount.watchId)
+			{
+				const std::string sVirtualPath =
+					VirtualFileSystem::normalisePath(mount.sMountPoint + '/' + change.sPath);
+				m_previousSources.push_back(findSource(sVirtualPath));
+				m_changes.emplace_back(change.watchId, sVirtualPath, change.type);
+			}
+		}
+
+		if (m_changes.size() == uiFirstChange)
+		{
+			continue;
+		}
+
+		m_fileSystem.refresh(mount.mountId);
+
+		size_t uiKept = uiFirstChange;
+		for (size_t i = uiFirstChange; i < m_changes.size(); ++i)
+		{
+			FileChange& change = m_changes[i];
+			const VirtualFileSource* pPrevious = m_previousSources[i - uiFirstChange];
+			const VirtualFileSource* pCurrent = findSource(change.sPath);
+
+			if (change.type != FileChangeTypes::UNKNOWN)
+			{
+				if (pPrevious != mount.pSource && pCurrent != mount.pSource)
+				{
+					// Hidden by a higher priority mount before and after
+					continue;
+				}
+				else if (change.type == FileChangeTypes::REMOVED && pCurrent != nullptr)
+				{
+					change.type = FileChangeTypes::MODIFIED;
+				}
+				else if (change.type == FileChangeTypes::ADDED && pPrevious != nullptr)
+				{
+					change.type = FileChangeTypes::MODIFIED;
+				}
+			}
+
+			if (uiKept != i)
+			{
+				m_changes[uiKept] = std::move(change);
+			}
+
+			++uiKept;
+		}
+
+		m_changes.resize(uiKept);
+	}
+
+	if (!m_changes.empty())
+	{
+		for (size_t i = 0; i < m_listeners.size(); ++i)
+		{
+			m_listeners[i]->onFilesChanged(m_changes);
+		}
+	}
+}
+
+const VirtualFileSource* VirtualFileReloader::findSource(const std::string& sVirtualPath) const
+{
+	const VirtualFileLocation* pLocation = m_fileSystem.resolve(sVirtualPath);
+	return pLocation != nullptr ? pLocation->pSource : nullptr;
+}
@@ -0,0 +1,112 @@
+/**
+The virtual file reloader keeps a virtual file system up to date as the directories mounted in to
+it change on disk, and tells the owners of resources which virtual files to reload.
+
+Directories mounted through the reloader are also watched with a file watcher. When a batch of
+changes arrives, each affected mount is listed again once and the listeners are passed the
+changes with their paths translated in to virtual paths. Changes that are hidden by a higher
+priority mount are not passed on. A file that is removed but is still provided by a lower
+priority mount is reported as modified, as is a new file that overrides one.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef VIRTUAL_FILE_RELOADER_H
+#define VIRTUAL_FILE_RELOADER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Engine/System/File/DirectoryFileSource.h"
+#include "Engine/System/File/FileWatcher.h"
+#include "Engine/System/File/VirtualFileSystem.h"
+
+class VirtualFileReloader : public FileWatchListener
+{
+	public:
+		/**
+		Constructs a reloader and registers it with the watcher.
+		@param fileSystem The virtual file system to keep up to date
+		@param watcher The watcher to observe changes with */
+		VirtualFileReloader(VirtualFileSystem& fileSystem, FileWatcher& watcher);
+
+		/**
+		Destructor. Stops watching every directory mounted through the reloader. The directories
+		remain mounted. */
+		~VirtualFileReloader();
+
+		VirtualFileReloader(const VirtualFileReloader& other) = delete;
+		VirtualFileReloader& operator=(const VirtualFileReloader& other) = delete;
+
+		/**
+		Mounts and watches a directory. If the watcher cannot watch the directory, it is still
+		mounted but is not kept up to date.
+		@param sMountPoint The virtual directory the directory's files appear under
+		@param pSource The directory
+		@param iPriority The priority of the mount
+		@return The id of the mount, or a default id if the source was a nullptr */
+		VirtualFileSystem::MountId mount(const std::string& sMountPoint,
+			std::shared_ptr<DirectoryFileSource> pSource, int iPriority = 0);
+
+		/**
+		Unmounts a directory and stops watching it. If the mount did not exist, no action is
+		taken.
+		@param id The id of the mount */
+		void unmount(const VirtualFileSystem::MountId& id);
+
+		/**
+		Queries whether a mount is being watched.
+		@param id The id of the mount
+		@return True if the mount is watched, false otherwise */
+		bool isWatched(const VirtualFileSystem::MountId& id) const;
+
+		/**
+		Adds a listener. Listeners receive changes with virtual paths.
+		@param pListener A pointer to the listener to add */
+		void addListener(FileWatchListener* const pListener);
+
+		/**
+		Removes a listener.
+		@param pListener A pointer to the listener to remove */
+		void removeListener(FileWatchListener* const pListener);
+
+		/**
+		Queries the existence of a listener.
+		@param pListener The listener to search for
+		@return True if the listener existed, false if it did not */
+		bool listenerExists(FileWatchListener* const pListener) const;
+
+		/**
+		Refreshes the mounts affected by the changes and passes the changes on to the listeners.
+		@param changes The changes */
+		void onFilesChanged(const std::vector<FileChange>& changes) override;
+
+	protected:
+
+	private:
+		struct WatchedMount
+		{
+			VirtualFileSystem::MountId mountId;
+			FileWatchId watchId;
+			std::string sMountPoint;
+			const VirtualFileSource* pSource;
+		};
+
+		VirtualFileSystem& m_fileSystem;
+		FileWatcher& m_watcher;
+		std::vector<WatchedMount> m_mounts;
+		std::vector<FileWatchListener*> m_listeners;
+		std::vector<FileChange> m_changes;
+		std::vector<const VirtualFileSource*> m_previousSources;
+
+		/**
+		Retrieves the source that provides a virtual path.
+		@param sVirtualPath The virtual path
+		@return The source, or a nullptr if no source provides the path */
+		const VirtualFileSource* findSource(const std::string& sVirtualPath) const;
+};
+
+#endif
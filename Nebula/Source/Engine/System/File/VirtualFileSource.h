@@ -0,0 +1,80 @@
+/**
+A virtual file source is an interface class for anything that can provide files to the virtual
+file system, such as a loose directory, a mod folder or a pack archive.
+
+Paths given to and returned by a source are relative to the root of the source and always use '/'
+as the separator.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef VIRTUAL_FILE_SOURCE_H
+#define VIRTUAL_FILE_SOURCE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+struct VirtualFileView
+{
+	/**
+	The contents of the file. */
+	const void* pData;
+
+	/**
+	The size of the file in bytes. */
+	size_t uiSize;
+
+	VirtualFileView() :
+		pData(nullptr),
+		uiSize(0)
+	{
+	}
+};
+
+class VirtualFileSource
+{
+	public:
+		/**
+		Destructor. */
+		virtual ~VirtualFileSource()
+		{
+		}
+
+		/**
+		Lists every file the source provides. This is only called when the source is mounted or
+		refreshed, so it may be slow.
+		@param files Appended with the path of each file */
+		virtual void listFiles(std::vector<std::string>& files) const = 0;
+
+		/**
+		Reads the whole of a file.
+		@param sPath The path of the file
+		@param data Replaced with the contents of the file
+		@return True if the file was read, false otherwise */
+		virtual bool read(const std::string& sPath, std::vector<unsigned char>& data) const = 0;
+
+		/**
+		Retrieves the contents of a file without copying them. Only sources that hold their files
+		in memory, such as a mapped pack archive, can provide views. The view remains valid for as
+		long as the source does.
+		@param sPath The path of the file
+		@param view Set to the contents of the file
+		@return True if a view was provided, false if the file does not exist or the source cannot
+		provide a view of it */
+		virtual bool getView(const std::string& sPath, VirtualFileView& view) const
+		{
+			(void)sPath;
+			(void)view;
+			return false;
+		}
+
+	protected:
+
+	private:
+
+};
+
+#endif
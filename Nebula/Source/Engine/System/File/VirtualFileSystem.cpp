@@ -0,0 +1,189 @@
+#include "Engine/System/File/VirtualFileSystem.h"
+
+#include <algorithm>
+
+VirtualFileSystem::VirtualFileSystem() :
+	m_uiNextSequence(0)
+{
+}
+
+VirtualFileSystem::MountId VirtualFileSystem::mount(const std::string& sMountPoint,
+	std::shared_ptr<VirtualFileSource> pSource, int iPriority)
+{
+	if (pSource == nullptr)
+	{
+		return MountId();
+	}
+
+	Mount mount;
+	mount.sMountPoint = normalisePath(sMountPoint);
+	if (!mount.sMountPoint.empty())
+	{
+		mount.sMountPoint += '/';
+	}
+
+	mount.pSource = std::move(pSource);
+	mount.iPriority = iPriority;
+	mount.uiSequence = m_uiNextSequence++;
+	mount.pSource->listFiles(mount.files);
+
+	const MountId id = m_mounts.push(std::move(mount));
+	rebuild();
+	return id;
+}
+
+void VirtualFileSystem::unmount(const MountId& id)
+{
+	if (m_mounts.find(id) != m_mounts.end())
+	{
+		m_mounts.remove(id);
+		rebuild();
+	}
+}
+
+void VirtualFileSystem::unmountAll()
+{
+	m_mounts.clear();
+	m_resolutions.clear();
+}
+
+void VirtualFileSystem::refresh()
+{
+	m_mounts.forEachInRange(0, m_mounts.capacity(), [](Mount& mount)
+	{
+		mount.files.clear();
+		mount.pSource->listFiles(mount.files);
+	});
+
+	rebuild();
+}
+
+void VirtualFileSystem::refresh(const MountId& id)
+{
+	const IndexedVector<Mount>::Iterator mount = m_mounts.find(id);
+	if (mount != m_mounts.end())
+	{
+		mount->files.clear();
+		mount->pSource->listFiles(mount->files);
+		rebuild();
+	}
+}
+
+const VirtualFileLocation* VirtualFileSystem::resolve(const std::string& sVirtualPath) const
+{
+	auto it = m_resolutions.find(normalisePath(sVirtualPath));
+	return it != m_resolutions.end() ? &it->second : nullptr;
+}
+
+bool VirtualFileSystem::exists(const std::string& sVirtualPath) const
+{
+	return resolve(sVirtualPath) != nullptr;
+}
+
+bool VirtualFileSystem::read(const std::string& sVirtualPath,
+	std::vector<unsigned char>& data) const
+{
+	const VirtualFileLocation* pLocation = resolve(sVirtualPath);
+	if (pLocation == nullptr)
+	{
+		return false;
+	}
+
+	return pLocation->pSource->read(pLocation->sSourcePath, data);
+}
+
+bool VirtualFileSystem::getView(const std::string& sVirtualPath, VirtualFileView& view) const
+{
+	const VirtualFileLocation* pLocation = resolve(sVirtualPath);
+	if (pLocation == nullptr)
+	{
+		return false;
+	}
+
+	return pLocation->pSource->getView(pLocation->sSourcePath, view);
+}
+
+size_t VirtualFileSystem::getNumFiles() const
+{
+	return m_resolutions.size();
+}
+
+std::string VirtualFileSystem::normalisePath(const std::string& sPath)
+{
+	std::string sNormalised;
+	sNormalised.reserve(sPath.size());
+
+	size_t i = 0;
+	while (i < sPath.size())
+	{
+		const char c = sPath[i] == '\\' ? '/' : sPath[i];
+
+		// Drop "./" segments and empty segments
+		if (c == '/' && (sNormalised.empty() || sNormalised.back() == '/'))
+		{
+			++i;
+			continue;
+		}
+		if (c == '.' && (sNormalised.empty() || sNormalised.back() == '/') &&
+			(i + 1 == sPath.size() || sPath[i + 1] == '/' || sPath[i + 1] == '\\'))
+		{
+			++i;
+			continue;
+		}
+
+		sNormalised += c;
+		++i;
+	}
+
+	if (!sNormalised.empty() && sNormalised.back() == '/')
+	{
+		sNormalised.pop_back();
+	}
+
+	return sNormalised;
+}
+
+std::string VirtualFileSystem::joinPath(const std::string& sDirectory, const std::string& sPath)
+{
+	return sDirectory + "/" + sPath;
+}
+
+void VirtualFileSystem::rebuild()
+{
+	std::vector<Mount*> mounts;
+	mounts.reserve(m_mounts.size());
+	m_mounts.forEachInRange(0, m_mounts.capacity(), [&mounts](Mount& mount)
+	{
+		mounts.push_back(&mount);
+	});
+
+	// Apply mounts from lowest to highest precedence, so later mounts overwrite earlier ones
+	std::sort(mounts.begin(), mounts.end(), [](const Mount* pA, const Mount* pB)
+	{
+		if (pA->iPriority != pB->iPriority)
+		{
+			return pA->iPriority < pB->iPriority;
+		}
+
+		return pA->uiSequence < pB->uiSequence;
+	});
+
+	size_t uiNumFiles = 0;
+	for (const Mount* pMount : mounts)
+	{
+		uiNumFiles += pMount->files.size();
+	}
+
+	m_resolutions.clear();
+	m_resolutions.reserve(uiNumFiles);
+	for (const Mount* pMount : mounts)
+	{
+		for (const std::string& sFile : pMount->files)
+		{
+			VirtualFileLocation& location =
+				m_resolutions[normalisePath(pMount->sMountPoint + sFile)];
+			location.pSource = pMount->pSource.get();
+			location.sSourcePath = sFile;
+		}
+	}
+}
@@ -0,0 +1,192 @@
+/**
+The virtual file system overlays a number of file sources, such as loose directories, mod folders
+and pack archives, in to a single tree of virtual paths. Each source is mounted at a virtual
+directory with a priority. When several sources provide the same virtual path, the source with
+the highest priority wins, and of those the most recently mounted.
+
+Sources are listed once when they are mounted, and the merged resolution table is only rebuilt
+when the set of mounts changes. Resolving or opening a file is a single hash lookup and never
+queries the disk to find which source a file comes from. Call refresh to pick up files that were
+added to or removed from a source after it was mounted.
+
+Virtual paths are relative, use '/' as the separator and are case sensitive. Backslashes, a
+leading "./" or "/" and repeated separators are normalised away.
+
+The virtual file system is not thread-safe.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef VIRTUAL_FILE_SYSTEM_H
+#define VIRTUAL_FILE_SYSTEM_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/System/File/VirtualFileSource.h"
+#include "Engine/System/Tools/DirectoryListing.h"
+#include "Engine/System/Tools/IndexedVector.h"
+
+struct VirtualFileLocation
+{
+	/**
+	The source that provides the file. */
+	VirtualFileSource* pSource;
+
+	/**
+	The path of the file within the source. */
+	std::string sSourcePath;
+
+	VirtualFileLocation() :
+		pSource(nullptr),
+		sSourcePath()
+	{
+	}
+};
+
+class VirtualFileSystem
+{
+	public:
+		typedef IndexedVectorId MountId;
+
+		/**
+		Constructs a virtual file system with nothing mounted. */
+		VirtualFileSystem();
+
+		/**
+		Mounts a source. The source is listed immediately.
+		@param sMountPoint The virtual directory the source's files appear under. Empty for the
+		root
+		@param pSource The source
+		@param iPriority The priority. Sources with a higher priority override those with a
+		lower priority
+		@return The id of the mount, or a default id if the source was a nullptr */
+		MountId mount(const std::string& sMountPoint, std::shared_ptr<VirtualFileSource> pSource,
+			int iPriority = 0);
+
+		/**
+		Unmounts a source. If the mount did not exist, no action is taken.
+		@param id The id of the mount */
+		void unmount(const MountId& id);
+
+		/**
+		Unmounts every source. */
+		void unmountAll();
+
+		/**
+		Lists every mounted source again and rebuilds the resolution table. */
+		void refresh();
+
+		/**
+		Lists a single mounted source again and rebuilds the resolution table. If the mount did
+		not exist, no action is taken.
+		@param id The id of the mount */
+		void refresh(const MountId& id);
+
+		/**
+		Resolves a virtual path to the source that provides it.
+		@param sVirtualPath The virtual path
+		@return The location of the file, or a nullptr if no source provides it */
+		const VirtualFileLocation* resolve(const std::string& sVirtualPath) const;
+
+		/**
+		Resolves a file within a directory taken from a directory listing. The directory is
+		treated as a virtual directory.
+		@param listing The directory listing
+		@param key The key of the directory
+		@param sFile The path of the file within the directory
+		@return The location of the file, or a nullptr if the key was not in the listing or no
+		source provides the file */
+		template <typename KeyType, typename Hash>
+		const VirtualFileLocation* resolve(const DirectoryListing<KeyType, Hash>& listing,
+			const KeyType& key, const std::string& sFile) const
+		{
+			const DirectoryListingSearchResult result = listing.find(key);
+			if (!result.bFound)
+			{
+				return nullptr;
+			}
+
+			return resolve(joinPath(result.sDirectory, sFile));
+		}
+
+		/**
+		Queries whether a virtual path is provided by any source.
+		@param sVirtualPath The virtual path
+		@return True if the file exists, false otherwise */
+		bool exists(const std::string& sVirtualPath) const;
+
+		/**
+		Reads the whole of a file.
+		@param sVirtualPath The virtual path
+		@param data Replaced with the contents of the file
+		@return True if the file was read, false otherwise */
+		bool read(const std::string& sVirtualPath, std::vector<unsigned char>& data) const;
+
+		/**
+		Retrieves the contents of a file without copying them, if the source that provides the
+		file supports it (see VirtualFileSource::getView).
+		@param sVirtualPath The virtual path
+		@param view Set to the contents of the file
+		@return True if a view was provided, false otherwise */
+		bool getView(const std::string& sVirtualPath, VirtualFileView& view) const;
+
+		/**
+		Retrieves the number of files visible through the virtual file system.
+		@return The number of files */
+		size_t getNumFiles() const;
+
+		/**
+		Normalises a virtual path.
+		@param sPath The path
+		@return The normalised path */
+		static std::string normalisePath(const std::string& sPath);
+
+	protected:
+
+	private:
+		struct Mount
+		{
+			std::string sMountPoint;
+			std::shared_ptr<VirtualFileSource> pSource;
+			int iPriority;
+
+			/**
+			Orders mounts with equal priorities by the order they were mounted in. */
+			size_t uiSequence;
+
+			/**
+			The files the source provided when it was last listed. */
+			std::vector<std::string> files;
+
+			Mount() :
+				sMountPoint(),
+				pSource(),
+				iPriority(0),
+				uiSequence(0),
+				files()
+			{
+			}
+		};
+
+		IndexedVector<Mount> m_mounts;
+		size_t m_uiNextSequence;
+		std::unordered_map<std::string, VirtualFileLocation> m_resolutions;
+
+		/**
+		Joins a directory and a path in to a single virtual path.
+		@param sDirectory The directory
+		@param sPath The path
+		@return The joined path */
+		static std::string joinPath(const std::string& sDirectory, const std::string& sPath);
+
+		/**
+		Rebuilds the resolution table from the file lists of the mounted sources. */
+		void rebuild();
+};
+
+#endif
@@ -0,0 +1,142 @@
+#include "Engine/System/Memory/AllocationCounter.h"
+
+#include "Engine/EngineBuildConfig.h"
+
+#ifdef NEB_USE_STAT_TRACKING
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	thread_local std::uint64_t t_uiAllocations = 0;
+	thread_local std::uint64_t t_uiAllocatedBytes = 0;
+
+	/**
+	Allocates memory the way the default operator new does, counting the allocation.
+	@param uiSize The number of bytes
+	@return The memory, or nullptr if it could not be allocated and there is no new handler */
+	void* allocateCounted(size_t uiSize)
+	{
+		if (uiSize == 0)
+		{
+			uiSize = 1;
+		}
+
+		for (;;)
+		{
+			void* pMemory = std::malloc(uiSize);
+			if (pMemory != nullptr)
+			{
+				++t_uiAllocations;
+				t_uiAllocatedBytes += uiSize;
+				return pMemory;
+			}
+
+			const std::new_handler handler = std::get_new_handler();
+			if (handler == nullptr)
+			{
+				return nullptr;
+			}
+
+			handler();
+		}
+	}
+}
+
+void* operator new(size_t uiSize)
+{
+	void* pMemory = allocateCounted(uiSize);
+	if (pMemory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return pMemory;
+}
+
+void* operator new[](size_t uiSize)
+{
+	return operator new(uiSize);
+}
+
+void* operator new(size_t uiSize, const std::nothrow_t&) noexcept
+{
+	try
+	{
+		return allocateCounted(uiSize);
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+void* operator new[](size_t uiSize, const std::nothrow_t& nothrow) noexcept
+{
+	return operator new(uiSize, nothrow);
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete[](void* pMemory, size_t) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept
+{
+	std::free(pMemory);
+}
+
+bool AllocationCounter::isEnabled()
+{
+	return true;
+}
+
+std::uint64_t AllocationCounter::getThreadAllocations()
+{
+	return t_uiAllocations;
+}
+
+std::uint64_t AllocationCounter::getThreadAllocatedBytes()
+{
+	return t_uiAllocatedBytes;
+}
+
+#else
+
+bool AllocationCounter::isEnabled()
+{
+	return false;
+}
+
+std::uint64_t AllocationCounter::getThreadAllocations()
+{
+	return 0;
+}
+
+std::uint64_t AllocationCounter::getThreadAllocatedBytes()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,45 @@
+/**
+The allocation counter counts heap allocations made through the global operator new, for each
+thread. Counts only ever grow, so the allocations made by a piece of code are the difference
+between the counts taken before and after it runs on the same thread.
+
+Counting replaces the global operator new and delete, and is only compiled in when stat tracking
+is enabled (NEB_USE_STAT_TRACKING). Otherwise every count reads as zero. Allocations made
+directly through malloc are not counted.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+class AllocationCounter
+{
+	public:
+		/**
+		Queries whether allocations are being counted.
+		@return True if allocations are counted, false if every count reads as zero */
+		static bool isEnabled();
+
+		/**
+		Retrieves the number of allocations the calling thread has made.
+		@return The number of allocations */
+		static std::uint64_t getThreadAllocations();
+
+		/**
+		Retrieves the number of bytes the calling thread has allocated. Freed bytes are not
+		subtracted.
+		@return The number of bytes */
+		static std::uint64_t getThreadAllocatedBytes();
+
+	protected:
+
+	private:
+		AllocationCounter() = delete;
+};
+
+#endif
@@ -0,0 +1,87 @@
+/**
+An allocator that serves allocations from a linear arena. Deallocation is a no-op; the memory is
+reclaimed when the arena is reset. Copies of an arena allocator share the same arena.
+
+Unlike std::allocator, allocate returns a nullptr instead of throwing when the arena is exhausted.
+The indexed containers treat a nullptr as a failure to grow.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef ARENA_ALLOCATOR_H
+#define ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+
+#include "Engine/System/Memory/LinearArena.h"
+
+template <typename T>
+class ArenaAllocator
+{
+	public:
+		typedef T value_type;
+
+		/**
+		Constructs an allocator that allocates from the given arena.
+		@param arena The arena. Must outlive the allocator and all of its allocations */
+		ArenaAllocator(LinearArena& arena) :
+			m_pArena(&arena)
+		{
+		}
+
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) :
+			m_pArena(other.getArena())
+		{
+		}
+
+		/**
+		Allocates memory for a number of objects.
+		@param uiCount The number of objects
+		@return A pointer to the memory, or a nullptr if the arena is exhausted */
+		T* allocate(size_t uiCount)
+		{
+			if (uiCount > std::numeric_limits<size_t>::max() / sizeof(T))
+			{
+				return nullptr;
+			}
+
+			return static_cast<T*>(m_pArena->allocate(uiCount * sizeof(T), alignof(T)));
+		}
+
+		/**
+		Does nothing. Arena memory is reclaimed by resetting the arena. */
+		void deallocate(T*, size_t)
+		{
+		}
+
+		/**
+		Retrieves the arena the allocator allocates from.
+		@return The arena */
+		LinearArena* getArena() const
+		{
+			return m_pArena;
+		}
+
+		template <typename U>
+		bool operator==(const ArenaAllocator<U>& other) const
+		{
+			return m_pArena == other.getArena();
+		}
+
+		template <typename U>
+		bool operator!=(const ArenaAllocator<U>& other) const
+		{
+			return m_pArena != other.getArena();
+		}
+
+	protected:
+
+	private:
+		LinearArena* m_pArena;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include "Engine/System/Memory/BlockPool.h"
+
+#include <functional>
+
+BlockPool::BlockPool(size_t uiBlockSize, size_t uiNumBlocks) :
+	m_pBuffer(nullptr),
+	m_pFreeList(nullptr),
+	m_pTag(nullptr),
+	m_uiBlockSize(0),
+	m_uiNumBlocks(uiNumBlocks),
+	m_uiNumFreeBlocks(uiNumBlocks)
+{
+	// Every block must be able to hold the free list link and stay aligned
+	const size_t uiAlignment = alignof(std::max_align_t);
+	if (uiBlockSize < sizeof(void*))
+	{
+		uiBlockSize = sizeof(void*);
+	}
+
+	m_uiBlockSize = (uiBlockSize + uiAlignment - 1) & ~(uiAlignment - 1);
+	m_pBuffer = static_cast<unsigned char*>(::operator new(m_uiBlockSize * m_uiNumBlocks));
+
+	// Thread the free list through the blocks in address order
+	for (size_t i = m_uiNumBlocks; i > 0; --i)
+	{
+		void* pBlock = m_pBuffer + (i - 1) * m_uiBlockSize;
+		*static_cast<void**>(pBlock) = m_pFreeList;
+		m_pFreeList = pBlock;
+	}
+}
+
+BlockPool::~BlockPool()
+{
+	::operator delete(m_pBuffer);
+}
+
+void* BlockPool::allocate()
+{
+	if (m_pFreeList == nullptr)
+	{
+		return nullptr;
+	}
+
+	void* pBlock = m_pFreeList;
+	m_pFreeList = *static_cast<void**>(pBlock);
+	--m_uiNumFreeBlocks;
+
+	if (m_pTag != nullptr)
+	{
+		m_pTag->recordAllocation(m_uiBlockSize);
+	}
+
+	return pBlock;
+}
+
+void BlockPool::deallocate(void* pBlock)
+{
+	if (pBlock != nullptr)
+	{
+		*static_cast<void**>(pBlock) = m_pFreeList;
+		m_pFreeList = pBlock;
+		++m_uiNumFreeBlocks;
+
+		if (m_pTag != nullptr)
+		{
+			m_pTag->recordDeallocation(m_uiBlockSize);
+		}
+	}
+}
+
+void BlockPool::setTag(MemoryTag* pTag)
+{
+	m_pTag = pTag;
+}
+
+bool BlockPool::owns(const void* pMemory) const
+{
+	std::less<const void*> less;
+	return !less(pMemory, m_pBuffer) &&
+		less(pMemory, m_pBuffer + m_uiBlockSize * m_uiNumBlocks);
+}
+
+size_t BlockPool::getBlockSize() const
+{
+	return m_uiBlockSize;
+}
+
+size_t BlockPool::getNumBlocks() const
+{
+	return m_uiNumBlocks;
+}
+
+size_t BlockPool::getNumFreeBlocks() const
+{
+	return m_uiNumFreeBlocks;
+}
@@ -0,0 +1,99 @@
+/**
+An allocator that serves allocations from a frame arena, so that standard containers built during
+a frame allocate nothing from the heap. Deallocation is a no-op; the memory is reclaimed when the
+arena releases its frame. Copies of a frame allocator share the same arena.
+
+A container using a frame allocator must not outlive the frames its arena keeps memory for.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef FRAME_ALLOCATOR_H
+#define FRAME_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Engine/System/Memory/FrameArena.h"
+
+template <typename T>
+class FrameAllocator
+{
+	public:
+		typedef T value_type;
+
+		/**
+		Constructs an allocator that allocates from the given arena.
+		@param arena The arena. Must outlive the allocator */
+		FrameAllocator(FrameArena& arena) :
+			m_pArena(&arena)
+		{
+		}
+
+		template <typename U>
+		FrameAllocator(const FrameAllocator<U>& other) :
+			m_pArena(other.getArena())
+		{
+		}
+
+		/**
+		Allocates memory for a number of objects.
+		@param uiCount The number of objects
+		@return A pointer to the memory. Throws std::bad_alloc if the memory cannot be allocated */
+		T* allocate(size_t uiCount)
+		{
+			if (uiCount > std::numeric_limits<size_t>::max() / sizeof(T))
+			{
+				throw std::bad_alloc();
+			}
+
+			return static_cast<T*>(m_pArena->allocate(uiCount * sizeof(T), alignof(T)));
+		}
+
+		/**
+		Does nothing. Frame memory is reclaimed when the arena releases its frame. */
+		void deallocate(T*, size_t)
+		{
+		}
+
+		/**
+		Retrieves the arena the allocator allocates from.
+		@return The arena */
+		FrameArena* getArena() const
+		{
+			return m_pArena;
+		}
+
+		template <typename U>
+		bool operator==(const FrameAllocator<U>& other) const
+		{
+			return m_pArena == other.getArena();
+		}
+
+		template <typename U>
+		bool operator!=(const FrameAllocator<U>& other) const
+		{
+			return m_pArena != other.getArena();
+		}
+
+	protected:
+
+	private:
+		FrameArena* m_pArena;
+};
+
+/**
+A vector whose storage lives in a frame arena. */
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+/**
+A string whose storage lives in a frame arena. */
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
+
+#endif
@@ -0,0 +1,131 @@
+#include "Engine/System/Memory/FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+FrameArena::FrameArena() :
+	m_pTag(nullptr),
+	m_uiCurrent(0),
+	m_uiPeakUsed(0)
+{
+	reserve(0, 1);
+}
+
+FrameArena::FrameArena(size_t uiCapacity, size_t uiNumFrames) :
+	m_pTag(nullptr),
+	m_uiCurrent(0),
+	m_uiPeakUsed(0)
+{
+	reserve(uiCapacity, uiNumFrames);
+}
+
+void FrameArena::reserve(size_t uiCapacity, size_t uiNumFrames)
+{
+	MemoryTag* pTag = m_pTag;
+	setTag(nullptr);
+
+	m_frames.clear();
+	m_frames.resize(std::max<size_t>(uiNumFrames, 1));
+	for (Frame& frame : m_frames)
+	{
+		frame.arena.reset(new LinearArena(uiCapacity));
+		frame.uiOverflowBytes = 0;
+	}
+
+	setTag(pTag);
+
+	m_uiCurrent = 0;
+	m_uiPeakUsed = 0;
+}
+
+void* FrameArena::allocate(size_t uiSize, size_t uiAlignment)
+{
+	Frame& frame = m_frames[m_uiCurrent];
+	void* pMemory = frame.arena->allocate(uiSize, uiAlignment);
+	if (pMemory != nullptr)
+	{
+		return pMemory;
+	}
+
+	// Over allocate so that the memory can be aligned within the block
+	const size_t uiBlockSize = uiSize + uiAlignment - 1;
+	if (uiBlockSize < uiSize)
+	{
+		throw std::bad_alloc();
+	}
+
+	frame.overflow.emplace_back(new unsigned char[uiBlockSize]);
+	frame.uiOverflowBytes += uiBlockSize;
+
+	if (m_pTag != nullptr)
+	{
+		m_pTag->recordAllocation(uiBlockSize);
+	}
+
+	const std::uintptr_t uiMask = (std::uintptr_t)uiAlignment - 1;
+	const std::uintptr_t uiAddress = reinterpret_cast<std::uintptr_t>(frame.overflow.back().get());
+	return reinterpret_cast<void*>((uiAddress + uiMask) & ~uiMask);
+}
+
+void FrameArena::endFrame()
+{
+	m_uiPeakUsed = std::max(m_uiPeakUsed, getUsed());
+
+	m_uiCurrent = (m_uiCurrent + 1) % m_frames.size();
+	Frame& frame = m_frames[m_uiCurrent];
+	if (m_pTag != nullptr)
+	{
+		m_pTag->recordDeallocation(frame.uiOverflowBytes, frame.overflow.size());
+	}
+
+	frame.arena->reset();
+	frame.overflow.clear();
+	frame.uiOverflowBytes = 0;
+}
+
+void FrameArena::setTag(MemoryTag* pTag)
+{
+	for (const Frame& frame : m_frames)
+	{
+		const size_t uiBytes = frame.arena->getCapacity() + frame.uiOverflowBytes;
+		const size_t uiNumAllocations = frame.overflow.size() + 1;
+		if (m_pTag != nullptr)
+		{
+			m_pTag->recordDeallocation(uiBytes, uiNumAllocations);
+		}
+
+		if (pTag != nullptr)
+		{
+			pTag->recordAllocation(uiBytes, uiNumAllocations);
+		}
+	}
+
+	m_pTag = pTag;
+}
+
+size_t FrameArena::getUsed() const
+{
+	const Frame& frame = m_frames[m_uiCurrent];
+	return frame.arena->getUsed() + frame.uiOverflowBytes;
+}
+
+size_t FrameArena::getPeakUsed() const
+{
+	return std::max(m_uiPeakUsed, getUsed());
+}
+
+size_t FrameArena::getOverflowBytes() const
+{
+	return m_frames[m_uiCurrent].uiOverflowBytes;
+}
+
+size_t FrameArena::getCapacity() const
+{
+	return m_frames[m_uiCurrent].arena->getCapacity();
+}
+
+size_t FrameArena::getNumFrames() const
+{
+	return m_frames.size();
+}
@@ -0,0 +1,116 @@
+/**
+A frame arena hands out scratch memory that lives for a fixed number of scheduler frames, for the
+temporary vectors and strings built while updating. Allocating bumps an offset in a linear arena,
+and ending a frame releases everything allocated that many frames ago in one step.
+
+An arena that lives for one frame has a single block, released at the end of every frame. One
+that lives for two frames alternates between two blocks, so data built during a frame may still
+be read during the next.
+
+Running out of room never fails. Allocations that do not fit are taken from the heap and freed
+with the rest of their frame, and the peak usage shows how large the arena needs to be.
+
+An arena may be given a memory tag, which is charged for the arena's blocks and for the memory
+taken from the heap. Giving the tag a budget of the reserved room warns whenever the arena runs
+out of room.
+
+The frame arena is not thread-safe. Worker threads should use thread frame arenas.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Engine/System/Memory/LinearArena.h"
+#include "Engine/System/Memory/MemoryTag.h"
+
+class FrameArena
+{
+	public:
+		/**
+		Constructs an arena without any room. Every allocation comes from the heap until room is
+		reserved. */
+		FrameArena();
+
+		/**
+		Constructs an arena.
+		@param uiCapacity The number of bytes each frame may allocate before using the heap
+		@param uiNumFrames The number of frames allocations live for, at least 1 */
+		FrameArena(size_t uiCapacity, size_t uiNumFrames = 1);
+
+		FrameArena(const FrameArena& other) = delete;
+		FrameArena& operator=(const FrameArena& other) = delete;
+
+		/**
+		Replaces the arena's blocks, releasing every allocation and the peak usage.
+		@param uiCapacity The number of bytes each frame may allocate before using the heap
+		@param uiNumFrames The number of frames allocations live for, at least 1 */
+		void reserve(size_t uiCapacity, size_t uiNumFrames = 1);
+
+		/**
+		Allocates memory that lives until the arena's number of frames have ended.
+		@param uiSize The number of bytes to allocate
+		@param uiAlignment The alignment of the allocation. Must be a power of 2
+		@return A pointer to the memory. Throws std::bad_alloc if the heap is also exhausted */
+		void* allocate(size_t uiSize, size_t uiAlignment = alignof(std::max_align_t));
+
+		/**
+		Ends the current frame, releasing the memory allocated the arena's number of frames ago. */
+		void endFrame();
+
+		/**
+		Sets the tag charged for the arena's memory, moving the charge for memory already held
+		from the previous tag.
+		@param pTag The tag, or a nullptr for none. Must outlive the arena */
+		void setTag(MemoryTag* pTag);
+
+		/**
+		Retrieves the number of bytes allocated during the current frame, including alignment
+		padding and any taken from the heap.
+		@return The number of bytes used */
+		size_t getUsed() const;
+
+		/**
+		Retrieves the most bytes used during a single frame since room was reserved.
+		@return The number of bytes */
+		size_t getPeakUsed() const;
+
+		/**
+		Retrieves the number of bytes taken from the heap during the current frame.
+		@return The number of bytes */
+		size_t getOverflowBytes() const;
+
+		/**
+		Retrieves the number of bytes each frame may allocate before using the heap.
+		@return The capacity in bytes */
+		size_t getCapacity() const;
+
+		/**
+		Retrieves the number of frames allocations live for.
+		@return The number of frames */
+		size_t getNumFrames() const;
+
+	protected:
+
+	private:
+		struct Frame
+		{
+			std::unique_ptr<LinearArena> arena;
+			std::vector<std::unique_ptr<unsigned char[]>> overflow;
+			size_t uiOverflowBytes;
+		};
+
+		std::vector<Frame> m_frames;
+		MemoryTag* m_pTag;
+		size_t m_uiCurrent;
+		size_t m_uiPeakUsed;
+};
+
+#endif
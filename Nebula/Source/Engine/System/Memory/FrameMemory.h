@@ -0,0 +1,63 @@
+/**
+Frame memory gathers the scratch arenas handed to scheduled items each frame. The scheduler ends
+the frame of each arena once every item has been updated.
+
+Any of the arenas may be a nullptr if the owner of the scheduler does not provide it.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef FRAME_MEMORY_H
+#define FRAME_MEMORY_H
+
+#include "Engine/System/Memory/FrameArena.h"
+#include "Engine/System/Memory/ThreadFrameArenas.h"
+
+struct FrameMemory
+{
+	/**
+	Scratch memory released at the end of the frame. Only for use on the scheduler's thread. */
+	FrameArena* pFrameArena;
+
+	/**
+	Scratch memory released at the end of the next frame, for data that is read a frame after it
+	is built. Only for use on the scheduler's thread. */
+	FrameArena* pTwoFrameArena;
+
+	/**
+	Scratch memory for worker threads, released at the end of the frame. */
+	ThreadFrameArenas* pThreadArenas;
+
+	/**
+	Constructs frame memory without any arenas. */
+	FrameMemory() :
+		pFrameArena(nullptr),
+		pTwoFrameArena(nullptr),
+		pThreadArenas(nullptr)
+	{
+	}
+
+	/**
+	Ends the current frame of every arena. */
+	void endFrame()
+	{
+		if (pFrameArena != nullptr)
+		{
+			pFrameArena->endFrame();
+		}
+
+		if (pTwoFrameArena != nullptr)
+		{
+			pTwoFrameArena->endFrame();
+		}
+
+		if (pThreadArenas != nullptr)
+		{
+			pThreadArenas->endFrame();
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,59 @@
+#include "Engine/System/Memory/LinearArena.h"
+
+#include <cstdint>
+
+LinearArena::LinearArena(size_t uiCapacity) :
+	m_pBuffer(new unsigned char[uiCapacity]),
+	m_uiCapacity(uiCapacity),
+	m_uiOffset(0),
+	m_bOwnsBuffer(true)
+{
+}
+
+LinearArena::LinearArena(void* pBuffer, size_t uiCapacity) :
+	m_pBuffer(static_cast<unsigned char*>(pBuffer)),
+	m_uiCapacity(uiCapacity),
+	m_uiOffset(0),
+	m_bOwnsBuffer(false)
+{
+}
+
+LinearArena::~LinearArena()
+{
+	if (m_bOwnsBuffer)
+	{
+		delete[] m_pBuffer;
+	}
+}
+
+void* LinearArena::allocate(size_t uiSize, size_t uiAlignment)
+{
+	const std::uintptr_t uiAddress = reinterpret_cast<std::uintptr_t>(m_pBuffer) + m_uiOffset;
+	const size_t uiPadding = (size_t)((uiAlignment - (uiAddress & (uiAlignment - 1))) &
+		(uiAlignment - 1));
+
+	if (uiPadding > m_uiCapacity - m_uiOffset || uiSize > m_uiCapacity - m_uiOffset - uiPadding)
+	{
+		return nullptr;
+	}
+
+	void* pMemory = m_pBuffer + m_uiOffset + uiPadding;
+	m_uiOffset += uiPadding + uiSize;
+
+	return pMemory;
+}
+
+void LinearArena::reset()
+{
+	m_uiOffset = 0;
+}
+
+size_t LinearArena::getUsed() const
+{
+	return m_uiOffset;
+}
+
+size_t LinearArena::getCapacity() const
+{
+	return m_uiCapacity;
+}
@@ -0,0 +1,72 @@
+/**
+A linear arena hands out memory from a single contiguous block by bumping an offset. Individual
+allocations are never freed. The whole arena is released at once by resetting it, which makes
+allocation and release constant time and free of any heap traffic.
+
+The block is either allocated once when the arena is constructed or supplied by the caller.
+
+The linear arena is not thread-safe.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef LINEAR_ARENA_H
+#define LINEAR_ARENA_H
+
+#include <cstddef>
+
+class LinearArena
+{
+	public:
+		/**
+		Constructs an arena that owns a block of the given size.
+		@param uiCapacity The size of the block in bytes */
+		explicit LinearArena(size_t uiCapacity);
+
+		/**
+		Constructs an arena that allocates from the given buffer. The buffer must outlive the
+		arena.
+		@param pBuffer The buffer
+		@param uiCapacity The size of the buffer in bytes */
+		LinearArena(void* pBuffer, size_t uiCapacity);
+
+		/**
+		Destructor. Releases the block if the arena owns it. */
+		~LinearArena();
+
+		LinearArena(const LinearArena& other) = delete;
+		LinearArena& operator=(const LinearArena& other) = delete;
+
+		/**
+		Allocates memory from the arena.
+		@param uiSize The number of bytes to allocate
+		@param uiAlignment The alignment of the allocation. Must be a power of 2
+		@return A pointer to the memory, or a nullptr if the arena does not have enough space */
+		void* allocate(size_t uiSize, size_t uiAlignment = alignof(std::max_align_t));
+
+		/**
+		Releases every allocation made from the arena. */
+		void reset();
+
+		/**
+		Retrieves the number of bytes allocated from the arena, including alignment padding.
+		@return The number of bytes used */
+		size_t getUsed() const;
+
+		/**
+		Retrieves the size of the arenas block.
+		@return The capacity in bytes */
+		size_t getCapacity() const;
+
+	protected:
+
+	private:
+		unsigned char* m_pBuffer;
+		size_t m_uiCapacity;
+		size_t m_uiOffset;
+		bool m_bOwnsBuffer;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "Engine/System/Memory/MemoryTag.h"
+
+MemoryTag::MemoryTag(const std::string& sName, size_t uiBudget) :
+	m_sName(sName),
+	m_uiBudget(uiBudget),
+	m_uiUsed(0),
+	m_uiPeakUsed(0),
+	m_uiNumAllocations(0),
+	m_uiNumBudgetWarnings(0)
+{
+}
+
+void MemoryTag::recordAllocation(size_t uiBytes, size_t uiNumAllocations)
+{
+	const size_t uiUsed = m_uiUsed.fetch_add(uiBytes, std::memory_order_relaxed) + uiBytes;
+	m_uiNumAllocations.fetch_add(uiNumAllocations, std::memory_order_relaxed);
+
+	size_t uiPeakUsed = m_uiPeakUsed.load(std::memory_order_relaxed);
+	while (uiPeakUsed < uiUsed &&
+		!m_uiPeakUsed.compare_exchange_weak(uiPeakUsed, uiUsed, std::memory_order_relaxed))
+	{
+	}
+
+	// Only the allocation that crosses the budget warns
+	if (m_uiBudget != 0 && uiUsed > m_uiBudget && uiUsed - uiBytes <= m_uiBudget)
+	{
+		m_uiNumBudgetWarnings.fetch_add(1, std::memory_order_relaxed);
+		if (m_budgetListener)
+		{
+			m_budgetListener(*this);
+		}
+	}
+}
+
+void MemoryTag::recordDeallocation(size_t uiBytes, size_t uiNumAllocations)
+{
+	m_uiUsed.fetch_sub(uiBytes, std::memory_order_relaxed);
+	m_uiNumAllocations.fetch_sub(uiNumAllocations, std::memory_order_relaxed);
+}
+
+void MemoryTag::setBudgetListener(const BudgetListener& listener)
+{
+	m_budgetListener = listener;
+}
+
+const std::string& MemoryTag::getName() const
+{
+	return m_sName;
+}
+
+size_t MemoryTag::getBudget() const
+{
+	return m_uiBudget;
+}
+
+size_t MemoryTag::getUsed() const
+{
+	return m_uiUsed.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTag::getPeakUsed() const
+{
+	return m_uiPeakUsed.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTag::getNumAllocations() const
+{
+	return m_uiNumAllocations.load(std::memory_order_relaxed);
+}
+
+size_t MemoryTag::getNumBudgetWarnings() const
+{
+	return m_uiNumBudgetWarnings.load(std::memory_order_relaxed);
+}
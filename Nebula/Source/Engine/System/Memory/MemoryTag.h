@@ -0,0 +1,99 @@
+/**
+A memory tag accounts for the memory used by one subsystem. Pools and heaps given a tag record
+every block they hand out and take back, so the tag knows how many bytes its subsystem is using,
+the most it has ever used and whether it has gone over its budget.
+
+A tag warns its budget listener each time its usage rises above its budget. It does not warn
+again until its usage has fallen back within the budget.
+
+Recording is thread-safe and lock free. The budget listener is called on the thread whose
+allocation went over the budget.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef MEMORY_TAG_H
+#define MEMORY_TAG_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+class MemoryTag
+{
+	public:
+		typedef std::function<void(const MemoryTag&)> BudgetListener;
+
+		/**
+		Constructs a tag.
+		@param sName The name of the subsystem the tag accounts for
+		@param uiBudget The number of bytes the subsystem may use, or 0 for no budget */
+		MemoryTag(const std::string& sName, size_t uiBudget = 0);
+
+		MemoryTag(const MemoryTag& other) = delete;
+		MemoryTag& operator=(const MemoryTag& other) = delete;
+
+		/**
+		Records an allocation, warning the budget listener if it takes the tag over its budget.
+		@param uiBytes The size of the allocation
+		@param uiNumAllocations The number of allocations the bytes were made in */
+		void recordAllocation(size_t uiBytes, size_t uiNumAllocations = 1);
+
+		/**
+		Records the release of an allocation.
+		@param uiBytes The size of the allocation
+		@param uiNumAllocations The number of allocations the bytes were made in */
+		void recordDeallocation(size_t uiBytes, size_t uiNumAllocations = 1);
+
+		/**
+		Sets the listener warned when the tag goes over its budget. Must not be called while the
+		tag is recording allocations.
+		@param listener The listener, or an empty function for none */
+		void setBudgetListener(const BudgetListener& listener);
+
+		/**
+		Retrieves the name of the subsystem the tag accounts for.
+		@return The name */
+		const std::string& getName() const;
+
+		/**
+		Retrieves the number of bytes the subsystem may use.
+		@return The budget in bytes, or 0 if there is no budget */
+		size_t getBudget() const;
+
+		/**
+		Retrieves the number of bytes currently allocated.
+		@return The number of bytes */
+		size_t getUsed() const;
+
+		/**
+		Retrieves the most bytes that have been allocated at once.
+		@return The number of bytes */
+		size_t getPeakUsed() const;
+
+		/**
+		Retrieves the number of allocations currently live.
+		@return The number of allocations */
+		size_t getNumAllocations() const;
+
+		/**
+		Retrieves the number of times the tag has gone over its budget.
+		@return The number of warnings */
+		size_t getNumBudgetWarnings() const;
+
+	protected:
+
+	private:
+		std::string m_sName;
+		size_t m_uiBudget;
+		BudgetListener m_budgetListener;
+		std::atomic<size_t> m_uiUsed;
+		std::atomic<size_t> m_uiPeakUsed;
+		std::atomic<size_t> m_uiNumAllocations;
+		std::atomic<size_t> m_uiNumBudgetWarnings;
+};
+
+#endif
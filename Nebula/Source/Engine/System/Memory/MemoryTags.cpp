@@ -0,0 +1,102 @@
+#include "Engine/System/Memory/MemoryTags.h"
+
+#include <algorithm>
+#include <iomanip>
+
+MemoryTags::MemoryTags()
+{
+}
+
+MemoryTag& MemoryTags::add(const std::string& sName, size_t uiBudget)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (const std::unique_ptr<MemoryTag>& pTag : m_tags)
+	{
+		if (pTag->getName() == sName)
+		{
+			return *pTag;
+		}
+	}
+
+	m_tags.emplace_back(new MemoryTag(sName, uiBudget));
+	m_tags.back()->setBudgetListener(m_budgetListener);
+	return *m_tags.back();
+}
+
+MemoryTag* MemoryTags::find(const std::string& sName) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (const std::unique_ptr<MemoryTag>& pTag : m_tags)
+	{
+		if (pTag->getName() == sName)
+		{
+			return pTag.get();
+		}
+	}
+
+	return nullptr;
+}
+
+void MemoryTags::setBudgetListener(const MemoryTag::BudgetListener& listener)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_budgetListener = listener;
+	for (const std::unique_ptr<MemoryTag>& pTag : m_tags)
+	{
+		pTag->setBudgetListener(listener);
+	}
+}
+
+size_t MemoryTags::getNumTags() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_tags.size();
+}
+
+void MemoryTags::writeReport(std::ostream& stream) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	size_t uiNameWidth = 3;
+	for (const std::unique_ptr<MemoryTag>& pTag : m_tags)
+	{
+		uiNameWidth = std::max(uiNameWidth, pTag->getName().size());
+	}
+
+	std::ios format(nullptr);
+	format.copyfmt(stream);
+
+	const int iNameWidth = (int)uiNameWidth + 2;
+	stream << std::left << std::setw(iNameWidth) << "Tag" << std::right << std::setw(12) <<
+		"Used KB" << std::setw(12) << "Peak KB" << std::setw(12) << "Budget KB" << std::setw(10) <<
+		"Allocs" << std::setw(10) << "Warnings" << '\n';
+
+	stream << std::fixed << std::setprecision(1);
+	for (const std::unique_ptr<MemoryTag>& pTag : m_tags)
+	{
+		stream << std::left << std::setw(iNameWidth) << pTag->getName() << std::right <<
+			std::setw(12) << (double)pTag->getUsed() / 1024.0 << std::setw(12) <<
+			(double)pTag->getPeakUsed() / 1024.0 << std::setw(12);
+
+		if (pTag->getBudget() != 0)
+		{
+			stream << (double)pTag->getBudget() / 1024.0;
+		}
+		else
+		{
+			stream << "-";
+		}
+
+		stream << std::setw(10) << pTag->getNumAllocations() << std::setw(10) <<
+			pTag->getNumBudgetWarnings();
+
+		if (pTag->getNumBudgetWarnings() != 0)
+		{
+			stream << "  OVER BUDGET";
+		}
+
+		stream << '\n';
+	}
+
+	stream.copyfmt(format);
+}
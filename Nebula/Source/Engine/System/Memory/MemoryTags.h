@@ -0,0 +1,76 @@
+/**
+Memory tags gathers the memory tags of the engine's subsystems, so the memory each subsystem uses
+can be reported in one place. Tags are never removed, so a reference to a tag stays valid for the
+life of the set.
+
+Every tag shares the set's budget listener, which by default does nothing. Over budget tags are
+also counted in the report.
+
+Adding tags and writing the report are thread-safe.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef MEMORY_TAGS_H
+#define MEMORY_TAGS_H
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Engine/System/Memory/MemoryTag.h"
+
+class MemoryTags
+{
+	public:
+		/**
+		Constructs an empty set of tags. */
+		MemoryTags();
+
+		MemoryTags(const MemoryTags& other) = delete;
+		MemoryTags& operator=(const MemoryTags& other) = delete;
+
+		/**
+		Adds a tag. If a tag with the same name exists it is returned instead, and its budget is
+		left unchanged.
+		@param sName The name of the subsystem the tag accounts for
+		@param uiBudget The number of bytes the subsystem may use, or 0 for no budget
+		@return The tag */
+		MemoryTag& add(const std::string& sName, size_t uiBudget = 0);
+
+		/**
+		Finds a tag by name.
+		@param sName The name of the tag
+		@return The tag, or a nullptr if there is no tag with the name */
+		MemoryTag* find(const std::string& sName) const;
+
+		/**
+		Sets the listener warned when any tag goes over its budget, including tags added later.
+		Must not be called while any tag is recording allocations.
+		@param listener The listener, or an empty function for none */
+		void setBudgetListener(const MemoryTag::BudgetListener& listener);
+
+		/**
+		Retrieves the number of tags.
+		@return The number of tags */
+		size_t getNumTags() const;
+
+		/**
+		Writes the usage, peak usage and budget of every tag as a plain text report. Tags that
+		have gone over their budget are marked.
+		@param stream The stream to write to */
+		void writeReport(std::ostream& stream) const;
+
+	protected:
+
+	private:
+		mutable std::mutex m_mutex;
+		std::vector<std::unique_ptr<MemoryTag>> m_tags;
+		MemoryTag::BudgetListener m_budgetListener;
+};
+
+#endif
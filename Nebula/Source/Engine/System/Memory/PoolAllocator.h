@@ -0,0 +1,93 @@
+/**
+An allocator that serves allocations from a block pool. Every allocation occupies one block, so
+the pools block size must be large enough for the largest allocation. This suits containers that
+allocate their whole storage at once, such as the indexed containers. Copies of a pool allocator
+share the same pool.
+
+Unlike std::allocator, allocate returns a nullptr instead of throwing when the pool is exhausted
+or the allocation does not fit in a block. The indexed containers treat a nullptr as a failure to
+grow.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <cstddef>
+
+#include "Engine/System/Memory/BlockPool.h"
+
+template <typename T>
+class PoolAllocator
+{
+	public:
+		typedef T value_type;
+
+		/**
+		Constructs an allocator that allocates from the given pool.
+		@param pool The pool. Must outlive the allocator and all of its allocations */
+		PoolAllocator(BlockPool& pool) :
+			m_pPool(&pool)
+		{
+		}
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U>& other) :
+			m_pPool(other.getPool())
+		{
+		}
+
+		/**
+		Allocates a block for a number of objects.
+		@param uiCount The number of objects
+		@return A pointer to the memory, or a nullptr if the objects do not fit in a block or the
+		pool is exhausted */
+		T* allocate(size_t uiCount)
+		{
+			if (alignof(T) > alignof(std::max_align_t) ||
+				uiCount > m_pPool->getBlockSize() / sizeof(T))
+			{
+				return nullptr;
+			}
+
+			return static_cast<T*>(m_pPool->allocate());
+		}
+
+		/**
+		Returns a block to the pool.
+		@param pMemory The memory to release */
+		void deallocate(T* pMemory, size_t)
+		{
+			m_pPool->deallocate(pMemory);
+		}
+
+		/**
+		Retrieves the pool the allocator allocates from.
+		@return The pool */
+		BlockPool* getPool() const
+		{
+			return m_pPool;
+		}
+
+		template <typename U>
+		bool operator==(const PoolAllocator<U>& other) const
+		{
+			return m_pPool == other.getPool();
+		}
+
+		template <typename U>
+		bool operator!=(const PoolAllocator<U>& other) const
+		{
+			return m_pPool != other.getPool();
+		}
+
+	protected:
+
+	private:
+		BlockPool* m_pPool;
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "Engine/System/Memory/ThreadFrameArenas.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+	std::atomic<std::uint64_t> g_uiNextId(1);
+
+	/**
+	The set and arena the calling thread last asked for. */
+	thread_local std::uint64_t t_uiCachedId = 0;
+	thread_local FrameArena* t_pCachedArena = nullptr;
+}
+
+ThreadFrameArenas::ThreadFrameArenas() :
+	m_uiId(g_uiNextId++),
+	m_pTag(nullptr),
+	m_uiCapacity(0),
+	m_uiNumFrames(1)
+{
+}
+
+void ThreadFrameArenas::reserve(size_t uiCapacity, size_t uiNumFrames)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_uiCapacity = uiCapacity;
+	m_uiNumFrames = uiNumFrames;
+	for (std::pair<std::thread::id, std::unique_ptr<FrameArena>>& arena : m_arenas)
+	{
+		arena.second->reserve(uiCapacity, uiNumFrames);
+	}
+}
+
+void ThreadFrameArenas::setTag(MemoryTag* pTag)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_pTag = pTag;
+	for (std::pair<std::thread::id, std::unique_ptr<FrameArena>>& arena : m_arenas)
+	{
+		arena.second->setTag(pTag);
+	}
+}
+
+FrameArena& ThreadFrameArenas::local()
+{
+	if (t_uiCachedId == m_uiId)
+	{
+		return *t_pCachedArena;
+	}
+
+	const std::thread::id thread = std::this_thread::get_id();
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::vector<std::pair<std::thread::id, std::unique_ptr<FrameArena>>>::iterator it =
+		std::find_if(m_arenas.begin(), m_arenas.end(),
+		[thread](const std::pair<std::thread::id, std::unique_ptr<FrameArena>>& arena)
+	{
+		return arena.first == thread;
+	});
+
+	if (it == m_arenas.end())
+	{
+		m_arenas.emplace_back(thread, std::unique_ptr<FrameArena>(
+			new FrameArena(m_uiCapacity, m_uiNumFrames)));
+		it = m_arenas.end() - 1;
+		it->second->setTag(m_pTag);
+	}
+
+	t_uiCachedId = m_uiId;
+	t_pCachedArena = it->second.get();
+	return *t_pCachedArena;
+}
+
+void ThreadFrameArenas::endFrame()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (std::pair<std::thread::id, std::unique_ptr<FrameArena>>& arena : m_arenas)
+	{
+		arena.second->endFrame();
+	}
+}
+
+size_t ThreadFrameArenas::getNumArenas() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_arenas.size();
+}
+
+size_t ThreadFrameArenas::getPeakUsed() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	size_t uiPeakUsed = 0;
+	for (const std::pair<std::thread::id, std::unique_ptr<FrameArena>>& arena : m_arenas)
+	{
+		uiPeakUsed = std::max(uiPeakUsed, arena.second->getPeakUsed());
+	}
+
+	return uiPeakUsed;
+}
@@ -0,0 +1,84 @@
+/**
+Thread frame arenas give every thread that asks its own frame arena, so worker threads can build
+scratch data during a frame without locking or sharing an arena. A thread's arena is created the
+first time it asks, and found again through a thread local cache, so later requests take no lock.
+
+Every arena is charged to the same memory tag, if one is given. Every arena ends its frame
+together. Frames must only be ended while no other thread is using its
+arena, such as between scheduler frames once all work for the frame has finished.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef THREAD_FRAME_ARENAS_H
+#define THREAD_FRAME_ARENAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Engine/System/Memory/FrameArena.h"
+
+class ThreadFrameArenas
+{
+	public:
+		/**
+		Constructs a set of arenas without any room. Every allocation comes from the heap until
+		room is reserved. */
+		ThreadFrameArenas();
+
+		ThreadFrameArenas(const ThreadFrameArenas& other) = delete;
+		ThreadFrameArenas& operator=(const ThreadFrameArenas& other) = delete;
+
+		/**
+		Sets the room each thread's arena reserves, replacing the blocks of existing arenas and
+		releasing their allocations.
+		@param uiCapacity The number of bytes each frame may allocate before using the heap
+		@param uiNumFrames The number of frames allocations live for, at least 1 */
+		void reserve(size_t uiCapacity, size_t uiNumFrames = 1);
+
+		/**
+		Sets the tag charged for the memory of every arena, including those created later.
+		@param pTag The tag, or a nullptr for none. Must outlive the arenas */
+		void setTag(MemoryTag* pTag);
+
+		/**
+		Retrieves the calling thread's arena, creating it if this is the thread's first request.
+		@return The arena */
+		FrameArena& local();
+
+		/**
+		Ends the current frame of every arena. */
+		void endFrame();
+
+		/**
+		Retrieves the number of threads that have an arena.
+		@return The number of arenas */
+		size_t getNumArenas() const;
+
+		/**
+		Retrieves the most bytes any thread used during a single frame.
+		@return The number of bytes */
+		size_t getPeakUsed() const;
+
+	protected:
+
+	private:
+		/**
+		Identifies the set in thread local caches. Unlike its address, it is never reused. */
+		std::uint64_t m_uiId;
+
+		mutable std::mutex m_mutex;
+		std::vector<std::pair<std::thread::id, std::unique_ptr<FrameArena>>> m_arenas;
+		MemoryTag* m_pTag;
+		size_t m_uiCapacity;
+		size_t m_uiNumFrames;
+};
+
+#endif
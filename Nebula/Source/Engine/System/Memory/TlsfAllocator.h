@@ -0,0 +1,90 @@
+/**
+An allocator that serves allocations from a TLSF heap, so containers can grow and shrink in
+bounded time. Copies of a TLSF allocator share the same heap.
+
+Unlike std::allocator, allocate returns a nullptr instead of throwing when the heap has no free
+block large enough. The indexed containers treat a nullptr as a failure to grow.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef TLSF_ALLOCATOR_H
+#define TLSF_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+
+#include "Engine/System/Memory/TlsfHeap.h"
+
+template <typename T>
+class TlsfAllocator
+{
+	public:
+		typedef T value_type;
+
+		/**
+		Constructs an allocator that allocates from the given heap.
+		@param heap The heap. Must outlive the allocator and all of its allocations */
+		TlsfAllocator(TlsfHeap& heap) :
+			m_pHeap(&heap)
+		{
+		}
+
+		template <typename U>
+		TlsfAllocator(const TlsfAllocator<U>& other) :
+			m_pHeap(other.getHeap())
+		{
+		}
+
+		/**
+		Allocates memory for a number of objects.
+		@param uiCount The number of objects
+		@return A pointer to the memory, or a nullptr if the heap has no free block large
+		enough */
+		T* allocate(size_t uiCount)
+		{
+			if (uiCount > std::numeric_limits<size_t>::max() / sizeof(T))
+			{
+				return nullptr;
+			}
+
+			return static_cast<T*>(m_pHeap->allocate(uiCount * sizeof(T), alignof(T)));
+		}
+
+		/**
+		Returns memory to the heap.
+		@param pMemory The memory to release */
+		void deallocate(T* pMemory, size_t)
+		{
+			m_pHeap->deallocate(pMemory);
+		}
+
+		/**
+		Retrieves the heap the allocator allocates from.
+		@return The heap */
+		TlsfHeap* getHeap() const
+		{
+			return m_pHeap;
+		}
+
+		template <typename U>
+		bool operator==(const TlsfAllocator<U>& other) const
+		{
+			return m_pHeap == other.getHeap();
+		}
+
+		template <typename U>
+		bool operator!=(const TlsfAllocator<U>& other) const
+		{
+			return m_pHeap != other.getHeap();
+		}
+
+	protected:
+
+	private:
+		TlsfHeap* m_pHeap;
+};
+
+#endif
@@ -0,0 +1,371 @@
+#include "Engine/System/Memory/TlsfHeap.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+	const size_t g_uiAlignment = alignof(std::max_align_t);
+	const size_t g_uiFreeBit = 1;
+
+	/**
+	Rounds a size up to a multiple of a power of two.
+	@param uiSize The size
+	@param uiAlignment The power of two
+	@return The rounded size */
+	size_t alignUp(size_t uiSize, size_t uiAlignment)
+	{
+		return (uiSize + uiAlignment - 1) & ~(uiAlignment - 1);
+	}
+
+	/**
+	Finds the highest set bit of a value.
+	@param uiValue The value. Must not be 0
+	@return The index of the bit */
+	size_t findLastSet(size_t uiValue)
+	{
+#ifdef _MSC_VER
+		unsigned long ulIndex = 0;
+#ifdef _WIN64
+		_BitScanReverse64(&ulIndex, uiValue);
+#else
+		_BitScanReverse(&ulIndex, uiValue);
+#endif
+		return ulIndex;
+#else
+		return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(uiValue);
+#endif
+	}
+
+	/**
+	Finds the lowest set bit of a value.
+	@param uiValue The value. Must not be 0
+	@return The index of the bit */
+	size_t findFirstSet(size_t uiValue)
+	{
+#ifdef _MSC_VER
+		unsigned long ulIndex = 0;
+#ifdef _WIN64
+		_BitScanForward64(&ulIndex, uiValue);
+#else
+		_BitScanForward(&ulIndex, uiValue);
+#endif
+		return ulIndex;
+#else
+		return __builtin_ctzll(uiValue);
+#endif
+	}
+
+	/**
+	The header is padded so that the memory following it keeps the heaps alignment, and a free
+	block must have room for its free list links. */
+	const size_t g_uiHeaderSize = alignUp(2 * sizeof(void*), g_uiAlignment);
+	const size_t g_uiMinBlockSize = alignUp(2 * sizeof(void*), g_uiAlignment);
+
+	/**
+	Sizes below the first power of two range are split linearly into the second level classes
+	of the first level 0. */
+	const size_t g_uiSecondLevelBits = 4;
+	const size_t g_uiFirstLevelShift = g_uiSecondLevelBits + findLastSet(g_uiAlignment);
+	const size_t g_uiSmallSize = (size_t)1 << g_uiFirstLevelShift;
+
+	/**
+	Finds the size class a block belongs to.
+	@param uiSize The size of the block
+	@param uiFirstLevel Set to the first level of the class
+	@param uiSecondLevel Set to the second level of the class */
+	void findSizeClass(size_t uiSize, size_t& uiFirstLevel, size_t& uiSecondLevel)
+	{
+		if (uiSize < g_uiSmallSize)
+		{
+			uiFirstLevel = 0;
+			uiSecondLevel = uiSize / g_uiAlignment;
+		}
+		else
+		{
+			const size_t uiLastSet = findLastSet(uiSize);
+			uiFirstLevel = uiLastSet - g_uiFirstLevelShift + 1;
+			uiSecondLevel = (uiSize >> (uiLastSet - g_uiSecondLevelBits)) ^
+				((size_t)1 << g_uiSecondLevelBits);
+		}
+	}
+}
+
+TlsfHeap::TlsfHeap(size_t uiCapacity) :
+	m_pBuffer(nullptr),
+	m_pTag(nullptr),
+	m_uiCapacity(uiCapacity),
+	m_uiUsed(0),
+	m_uiPeakUsed(0),
+	m_uiNumAllocations(0),
+	m_uiFirstLevelMap(0)
+{
+	std::fill_n(m_uiSecondLevelMaps, m_uiNumFirstLevels, 0u);
+	std::fill_n(&m_pFreeLists[0][0], m_uiNumFirstLevels * m_uiNumSecondLevels, nullptr);
+
+	m_pBuffer = static_cast<unsigned char*>(::operator new(m_uiCapacity));
+	if (m_uiCapacity < 2 * g_uiHeaderSize + g_uiMinBlockSize)
+	{
+		return;
+	}
+
+	// The whole buffer starts as one free block, followed by an empty block that is always in
+	// use so that merging never runs off the end of the buffer
+	Block* pBlock = reinterpret_cast<Block*>(m_pBuffer);
+	pBlock->pPrevPhysical = nullptr;
+	pBlock->uiSize = (m_uiCapacity - 2 * g_uiHeaderSize) & ~(g_uiAlignment - 1);
+
+	Block* pEnd = reinterpret_cast<Block*>(m_pBuffer + g_uiHeaderSize + pBlock->uiSize);
+	pEnd->pPrevPhysical = pBlock;
+	pEnd->uiSize = 0;
+
+	insertFreeBlock(pBlock);
+}
+
+TlsfHeap::~TlsfHeap()
+{
+	::operator delete(m_pBuffer);
+}
+
+void* TlsfHeap::allocate(size_t uiSize, size_t uiAlignment)
+{
+	if (uiAlignment == 0 || (uiAlignment & (uiAlignment - 1)) != 0 ||
+		uiSize > m_uiCapacity || uiAlignment > m_uiCapacity)
+	{
+		return nullptr;
+	}
+
+	const size_t uiBlockSize = alignUp(std::max(uiSize, g_uiMinBlockSize), g_uiAlignment);
+
+	// Over allocate so that the block can be aligned, leaving room for a free block before it
+	size_t uiSearchSize = uiBlockSize;
+	if (uiAlignment > g_uiAlignment)
+	{
+		uiSearchSize += uiAlignment + g_uiHeaderSize + g_uiMinBlockSize;
+	}
+
+	// Round up to the next size class, so that every block in the class found is large enough
+	if (uiSearchSize >= g_uiSmallSize)
+	{
+		uiSearchSize += ((size_t)1 << (findLastSet(uiSearchSize) - g_uiSecondLevelBits)) - 1;
+	}
+
+	size_t uiFirstLevel = 0;
+	size_t uiSecondLevel = 0;
+	findSizeClass(uiSearchSize, uiFirstLevel, uiSecondLevel);
+
+	Block* pBlock = findFreeBlock(uiFirstLevel, uiSecondLevel);
+	if (pBlock == nullptr)
+	{
+		return nullptr;
+	}
+
+	removeFreeBlock(pBlock);
+	pBlock->uiSize &= ~g_uiFreeBit;
+
+	if (uiAlignment > g_uiAlignment)
+	{
+		const std::uintptr_t uiMemory = reinterpret_cast<std::uintptr_t>(pBlock) + g_uiHeaderSize;
+		const std::uintptr_t uiMask = (std::uintptr_t)uiAlignment - 1;
+		std::uintptr_t uiAligned = (uiMemory + uiMask) & ~uiMask;
+		if (uiAligned != uiMemory && uiAligned - uiMemory < g_uiHeaderSize + g_uiMinBlockSize)
+		{
+			uiAligned = (uiMemory + g_uiHeaderSize + g_uiMinBlockSize + uiMask) & ~uiMask;
+		}
+
+		// Split the space before the aligned memory off as a free block. The block before it is
+		// in use, or it would have been merged with this one
+		const size_t uiGap = (size_t)(uiAligned - uiMemory);
+		if (uiGap != 0)
+		{
+			Block* pAligned = reinterpret_cast<Block*>(uiAligned - g_uiHeaderSize);
+			pAligned->pPrevPhysical = pBlock;
+			pAligned->uiSize = pBlock->uiSize - uiGap;
+			reinterpret_cast<Block*>(uiAligned + pAligned->uiSize)->pPrevPhysical = pAligned;
+
+			pBlock->uiSize = uiGap - g_uiHeaderSize;
+			insertFreeBlock(pBlock);
+			pBlock = pAligned;
+		}
+	}
+
+	// Split the space after the allocation off as a free block if it is large enough. The block
+	// after it is in use, or it would have been merged with this one
+	unsigned char* pMemory = reinterpret_cast<unsigned char*>(pBlock) + g_uiHeaderSize;
+	if (pBlock->uiSize >= uiBlockSize + g_uiHeaderSize + g_uiMinBlockSize)
+	{
+		Block* pRest = reinterpret_cast<Block*>(pMemory + uiBlockSize);
+		pRest->pPrevPhysical = pBlock;
+		pRest->uiSize = pBlock->uiSize - uiBlockSize - g_uiHeaderSize;
+		reinterpret_cast<Block*>(reinterpret_cast<unsigned char*>(pRest) + g_uiHeaderSize +
+			pRest->uiSize)->pPrevPhysical = pRest;
+
+		pBlock->uiSize = uiBlockSize;
+		insertFreeBlock(pRest);
+	}
+
+	m_uiUsed += pBlock->uiSize;
+	m_uiPeakUsed = std::max(m_uiPeakUsed, m_uiUsed);
+	++m_uiNumAllocations;
+
+	if (m_pTag != nullptr)
+	{
+		m_pTag->recordAllocation(pBlock->uiSize);
+	}
+
+	return pMemory;
+}
+
+void TlsfHeap::deallocate(void* pMemory)
+{
+	if (pMemory == nullptr)
+	{
+		return;
+	}
+
+	Block* pBlock = reinterpret_cast<Block*>(static_cast<unsigned char*>(pMemory) -
+		g_uiHeaderSize);
+
+	m_uiUsed -= pBlock->uiSize;
+	--m_uiNumAllocations;
+
+	if (m_pTag != nullptr)
+	{
+		m_pTag->recordDeallocation(pBlock->uiSize);
+	}
+
+	// Merge with the free neighbours, so that no two free blocks are ever adjacent
+	Block* pPrev = pBlock->pPrevPhysical;
+	if (pPrev != nullptr && (pPrev->uiSize & g_uiFreeBit) != 0)
+	{
+		removeFreeBlock(pPrev);
+		pPrev->uiSize = (pPrev->uiSize & ~g_uiFreeBit) + g_uiHeaderSize + pBlock->uiSize;
+		pBlock = pPrev;
+	}
+
+	Block* pNext = reinterpret_cast<Block*>(reinterpret_cast<unsigned char*>(pBlock) +
+		g_uiHeaderSize + pBlock->uiSize);
+	if ((pNext->uiSize & g_uiFreeBit) != 0)
+	{
+		removeFreeBlock(pNext);
+		pBlock->uiSize += g_uiHeaderSize + (pNext->uiSize & ~g_uiFreeBit);
+		pNext = reinterpret_cast<Block*>(reinterpret_cast<unsigned char*>(pBlock) +
+			g_uiHeaderSize + pBlock->uiSize);
+	}
+
+	pNext->pPrevPhysical = pBlock;
+	insertFreeBlock(pBlock);
+}
+
+void TlsfHeap::setTag(MemoryTag* pTag)
+{
+	m_pTag = pTag;
+}
+
+bool TlsfHeap::owns(const void* pMemory) const
+{
+	std::less<const void*> less;
+	return !less(pMemory, m_pBuffer) && less(pMemory, m_pBuffer + m_uiCapacity);
+}
+
+size_t TlsfHeap::getCapacity() const
+{
+	return m_uiCapacity;
+}
+
+size_t TlsfHeap::getUsed() const
+{
+	return m_uiUsed;
+}
+
+size_t TlsfHeap::getPeakUsed() const
+{
+	return m_uiPeakUsed;
+}
+
+size_t TlsfHeap::getNumAllocations() const
+{
+	return m_uiNumAllocations;
+}
+
+void TlsfHeap::insertFreeBlock(Block* pBlock)
+{
+	size_t uiFirstLevel = 0;
+	size_t uiSecondLevel = 0;
+	findSizeClass(pBlock->uiSize, uiFirstLevel, uiSecondLevel);
+
+	pBlock->uiSize |= g_uiFreeBit;
+	pBlock->pPrevFree = nullptr;
+	pBlock->pNextFree = m_pFreeLists[uiFirstLevel][uiSecondLevel];
+	if (pBlock->pNextFree != nullptr)
+	{
+		pBlock->pNextFree->pPrevFree = pBlock;
+	}
+
+	m_pFreeLists[uiFirstLevel][uiSecondLevel] = pBlock;
+	m_uiFirstLevelMap |= (size_t)1 << uiFirstLevel;
+	m_uiSecondLevelMaps[uiFirstLevel] |= (std::uint32_t)1 << uiSecondLevel;
+}
+
+void TlsfHeap::removeFreeBlock(Block* pBlock)
+{
+	size_t uiFirstLevel = 0;
+	size_t uiSecondLevel = 0;
+	findSizeClass(pBlock->uiSize & ~g_uiFreeBit, uiFirstLevel, uiSecondLevel);
+
+	if (pBlock->pNextFree != nullptr)
+	{
+		pBlock->pNextFree->pPrevFree = pBlock->pPrevFree;
+	}
+
+	if (pBlock->pPrevFree != nullptr)
+	{
+		pBlock->pPrevFree->pNextFree = pBlock->pNextFree;
+		return;
+	}
+
+	// The block headed its list
+	m_pFreeLists[uiFirstLevel][uiSecondLevel] = pBlock->pNextFree;
+	if (pBlock->pNextFree == nullptr)
+	{
+		m_uiSecondLevelMaps[uiFirstLevel] &= ~((std::uint32_t)1 << uiSecondLevel);
+		if (m_uiSecondLevelMaps[uiFirstLevel] == 0)
+		{
+			m_uiFirstLevelMap &= ~((size_t)1 << uiFirstLevel);
+		}
+	}
+}
+
+TlsfHeap::Block* TlsfHeap::findFreeBlock(size_t& uiFirstLevel, size_t& uiSecondLevel) const
+{
+	if (uiFirstLevel >= m_uiNumFirstLevels)
+	{
+		return nullptr;
+	}
+
+	std::uint32_t uiSecondLevelMap = m_uiSecondLevelMaps[uiFirstLevel] &
+		(std::numeric_limits<std::uint32_t>::max() << uiSecondLevel);
+
+	if (uiSecondLevelMap == 0)
+	{
+		// Take the smallest class of the next first level with a free block
+		const size_t uiFirstLevelMap = uiFirstLevel + 1 < m_uiNumFirstLevels ?
+			m_uiFirstLevelMap & (std::numeric_limits<size_t>::max() << (uiFirstLevel + 1)) : 0;
+
+		if (uiFirstLevelMap == 0)
+		{
+			return nullptr;
+		}
+
+		uiFirstLevel = findFirstSet(uiFirstLevelMap);
+		uiSecondLevelMap = m_uiSecondLevelMaps[uiFirstLevel];
+	}
+
+	uiSecondLevel = findFirstSet(uiSecondLevelMap);
+	return m_pFreeLists[uiFirstLevel][uiSecondLevel];
+}
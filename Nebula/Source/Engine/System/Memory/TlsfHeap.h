@@ -0,0 +1,137 @@
+/**
+A TLSF heap is a general purpose allocator over a single contiguous buffer, using the two level
+segregated fit scheme. Free blocks are kept in lists by size class, found through two levels of
+bitmaps, and merged with their free neighbours as they are released. Allocating and releasing
+memory therefore take constant time whatever the size of the allocation or the state of the heap,
+which makes the heap safe to use from real time code.
+
+Each power of two range of sizes is split into 16 classes. A request is served from the first
+class whose blocks are all large enough, so an allocation may fail while a free block of the
+requested size still exists in a class it shares with larger requests.
+
+Allocations are aligned to alignof(std::max_align_t) unless a larger alignment is asked for.
+
+A heap may be given a memory tag, which is charged the size of every block in use.
+
+The TLSF heap is not thread-safe.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef TLSF_HEAP_H
+#define TLSF_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Engine/System/Memory/MemoryTag.h"
+
+class TlsfHeap
+{
+	public:
+		/**
+		Constructs a heap and allocates its buffer.
+		@param uiCapacity The size of the buffer in bytes. A little of it is used to manage the
+		blocks */
+		explicit TlsfHeap(size_t uiCapacity);
+
+		/**
+		Destructor. */
+		~TlsfHeap();
+
+		TlsfHeap(const TlsfHeap& other) = delete;
+		TlsfHeap& operator=(const TlsfHeap& other) = delete;
+
+		/**
+		Allocates memory.
+		@param uiSize The number of bytes to allocate
+		@param uiAlignment The alignment of the memory. Must be a power of two
+		@return A pointer to the memory, or a nullptr if there is no free block large enough */
+		void* allocate(size_t uiSize, size_t uiAlignment = alignof(std::max_align_t));
+
+		/**
+		Returns memory to the heap.
+		@param pMemory Memory previously allocated from this heap, or a nullptr */
+		void deallocate(void* pMemory);
+
+		/**
+		Sets the tag charged for the blocks in use. Blocks already in use are not charged, so the
+		tag should be set before any are allocated.
+		@param pTag The tag, or a nullptr for none. Must outlive the heap */
+		void setTag(MemoryTag* pTag);
+
+		/**
+		Queries whether a pointer addresses memory within the heap.
+		@param pMemory The pointer
+		@return True if the pointer lies within the heaps buffer, false otherwise */
+		bool owns(const void* pMemory) const;
+
+		/**
+		Retrieves the size of the heaps buffer.
+		@return The capacity in bytes */
+		size_t getCapacity() const;
+
+		/**
+		Retrieves the number of bytes in the blocks currently in use.
+		@return The number of bytes */
+		size_t getUsed() const;
+
+		/**
+		Retrieves the most bytes that have been in use at once.
+		@return The number of bytes */
+		size_t getPeakUsed() const;
+
+		/**
+		Retrieves the number of allocations currently live.
+		@return The number of allocations */
+		size_t getNumAllocations() const;
+
+	protected:
+
+	private:
+		/**
+		The header of a block. A block's size excludes its header, and its lowest bit is set while
+		the block is free. The free list links are only valid while the block is free, and lie in
+		the memory that is handed out while it is in use. */
+		struct Block
+		{
+			Block* pPrevPhysical;
+			size_t uiSize;
+			Block* pNextFree;
+			Block* pPrevFree;
+		};
+
+		static const size_t m_uiNumFirstLevels = sizeof(size_t) * 8;
+		static const size_t m_uiNumSecondLevels = 16;
+
+		unsigned char* m_pBuffer;
+		MemoryTag* m_pTag;
+		size_t m_uiCapacity;
+		size_t m_uiUsed;
+		size_t m_uiPeakUsed;
+		size_t m_uiNumAllocations;
+		size_t m_uiFirstLevelMap;
+		std::uint32_t m_uiSecondLevelMaps[m_uiNumFirstLevels];
+		Block* m_pFreeLists[m_uiNumFirstLevels][m_uiNumSecondLevels];
+
+		/**
+		Adds a free block to the list for its size class.
+		@param pBlock The block */
+		void insertFreeBlock(Block* pBlock);
+
+		/**
+		Removes a free block from the list for its size class.
+		@param pBlock The block */
+		void removeFreeBlock(Block* pBlock);
+
+		/**
+		Finds a free block in the given size class or the smallest larger class with a free block.
+		@param uiFirstLevel The first level of the class, updated to that of the block found
+		@param uiSecondLevel The second level of the class, updated to that of the block found
+		@return The block, or a nullptr if there is none */
+		Block* findFreeBlock(size_t& uiFirstLevel, size_t& uiSecondLevel) const;
+};
+
+#endif
@@ -1,6 +1,10 @@
 #include "Engine/System/Schedule/Scheduler.h"
 
-Scheduler::Scheduler()
+#include "Engine/System/Memory/AllocationCounter.h"
+
+Scheduler::Scheduler() :
+	m_bSchedulerRunning(false),
+	m_pTaskSystem(nullptr)
 {
 	m_lastLagWarning = getTimeNanos();
 	m_lagWarningInterval = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::seconds(5));
@@ -8,7 +12,9 @@ Scheduler::Scheduler()
 	resetExecutionData();
 }
 
-Scheduler::Scheduler(const SchedulerConfig& conf)
+Scheduler::Scheduler(const SchedulerConfig& conf) :
+	m_bSchedulerRunning(false),
+	m_pTaskSystem(nullptr)
 {
 	m_activeConfig = conf;
 	m_pendingConfig = m_activeConfig;
@@ -32,6 +38,8 @@ void Scheduler::resetExecutionData()
 	m_executionData.uiFramesDelayedThreadWake = 0;
 	m_executionData.uiSkippedUpdateCalls = 0;
 	m_executionData.uiRefusedStopRequests = 0;
+	m_executionData.uiFramesAllocating = 0;
+	m_executionData.uiFrameAllocations = 0;
 }
 
 void Scheduler::setConfig(const SchedulerConfig& config)
@@ -108,6 +116,8 @@ void Scheduler::start()
 	timeInfo.timeLastUpdate = timeInfo.timeNow;
 	timeInfo.timeFrameStart = timeInfo.timeNow;
 	timeInfo.fInterpolation = 1.0;
+	timeInfo.frameMemory = m_frameMemory;
+	timeInfo.pTaskSystem = m_pTaskSystem;
 
 	// Announce start to items
 	for (std::pair<ScheduledItem*, SchedulerItemInfo>& schedule : m_schedules)
@@ -127,6 +137,7 @@ void Scheduler::start()
 		// Calculate the frame start and end time
 		timeFrameStart = getTimeNanos();
 		timeFrameEnd = timeFrameStart + timeStep;
+		const std::uint64_t uiFrameStartAllocations = AllocationCounter::getThreadAllocations();
 
 		// Configure time info structure and update each scheduled item
 		timeInfo.timeFrameStart = timeFrameStart;
@@ -176,6 +187,28 @@ void Scheduler::start()
 			}
 		}
 
+		// Release this frame's scratch memory
+		m_frameMemory.endFrame();
+
+		// Check the frame's updates did not allocate, once containers have had time to grow
+		if (m_activeConfig.bCheckFrameAllocations &&
+			m_executionData.uiFramesExecuted >= m_activeConfig.uiAllocationWarmUpFrames)
+		{
+			const std::uint64_t uiAllocations = AllocationCounter::getThreadAllocations() -
+				uiFrameStartAllocations;
+			if (uiAllocations > 0)
+			{
+				++m_executionData.uiFramesAllocating;
+				m_executionData.uiFrameAllocations += uiAllocations;
+
+				schedulerEvent = SchedulerEvent(SchedulerEventTypes::SCHEDULER_FRAME_ALLOCATED);
+				for (SchedulerListener* l : m_schedulerListeners)
+				{
+					l->onSchedulerEvent(schedulerEvent);
+				}
+			}
+		}
+
 		// End frame:
 		// If time left over, sleep it off
 		// If not, log and potentially report the delay
@@ -339,4 +372,20 @@ bool Scheduler::schedulerListenerExists(SchedulerListener* const pListener) cons
 		}
 	}
 	return false;
+}
+
+void Scheduler::reserve(size_t uiNumItems, size_t uiNumListeners)
+{
+	m_schedules.reserve(uiNumItems);
+	m_schedulerListeners.reserve(uiNumListeners);
+}
+
+void Scheduler::setFrameMemory(const FrameMemory& frameMemory)
+{
+	m_frameMemory = frameMemory;
+}
+
+void Scheduler::setTaskSystem(TaskSystem* pTaskSystem)
+{
+	m_pTaskSystem = pTaskSystem;
 }
\ No newline at end of file
@@ -5,7 +5,7 @@ a set of schedule objects according the specification it is provided.
 The scheduler is not thread-safe. All function calls should occur on a single thread (or should be
 exceptionally carefully managed).
 
-@date edited 25/01/2017
+@date edited 18/10/2026
 @date authored 29/11/2016
 
 @author Nathan Sainsbury */
@@ -103,6 +103,26 @@ class Scheduler
 		@return True if the listener existed, false if it did not */
 		bool schedulerListenerExists(SchedulerListener* const pListener) const;	
 
+		/**
+		Reserves room for scheduled items and listeners, so that adding up to the given numbers
+		does not allocate.
+		@param uiNumItems The number of scheduled items
+		@param uiNumListeners The number of listeners */
+		void reserve(size_t uiNumItems, size_t uiNumListeners);
+
+		/**
+		Sets the scratch arenas handed to scheduled items in their time info. The scheduler ends
+		the frame of each arena once every item has been updated. The arenas must outlive the
+		scheduler, or be replaced before they are destroyed.
+		@param frameMemory The arenas */
+		void setFrameMemory(const FrameMemory& frameMemory);
+
+		/**
+		Sets the task system handed to scheduled items in their time info. The task system must
+		outlive the scheduler, or be replaced before it is destroyed.
+		@param pTaskSystem The task system, or a nullptr for none */
+		void setTaskSystem(TaskSystem* pTaskSystem);
+
 	protected:
 
 	private:
@@ -111,6 +131,8 @@ class Scheduler
 		SchedulerExecutionData m_executionData;
 		SchedulerConfig m_activeConfig;
 		SchedulerConfig m_pendingConfig;
+		FrameMemory m_frameMemory;
+		TaskSystem* m_pTaskSystem;
 		std::vector<std::pair<ScheduledItem*, SchedulerItemInfo>> m_schedules;
 		std::vector<SchedulerListener*> m_schedulerListeners;
 		std::chrono::nanoseconds m_lastLagWarning;
@@ -5,7 +5,7 @@ scheduler.
 "Fixed timestepping" AKA every frame of execution reportedly takes exactly the same amount of time
 can be enabled by setting the interpolation cap to 1.
 
-@date edited 25/01/2017
+@date edited 18/10/2026
 @date authored 07/01/2017
 
 @author Nathan Sainsbury */
@@ -46,6 +46,17 @@ struct SchedulerConfig
 	Enables or disables the ability to stop the scheduler via a scheduled items requestStop flag. */
 	bool bRefuseStopRequests;
 
+	/**
+	Enables the allocation check. Once the warm up frames have run, every frame in which the
+	scheduler thread allocates from the heap is counted in the execution data and announced to
+	listeners. Allocations are only counted when stat tracking is enabled. */
+	bool bCheckFrameAllocations;
+
+	/**
+	The number of frames to run before the allocation check begins, giving containers time to
+	grow to their working sizes. */
+	std::uint32_t uiAllocationWarmUpFrames;
+
 	/**
 	Constructs a default configured scheduler config. */
 	SchedulerConfig()
@@ -62,6 +73,8 @@ struct SchedulerConfig
 		fInterpolationLagThreshold = 1.025;
 		uiLagWarningFrequency = 10;
 		bRefuseStopRequests = true;
+		bCheckFrameAllocations = false;
+		uiAllocationWarmUpFrames = 60;
 	}
 };
 
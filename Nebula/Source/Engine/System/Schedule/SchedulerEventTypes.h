@@ -1,7 +1,7 @@
 /**
 The scheduler event types enum lists and documents the available scheduler event types.
 
-@date edited 20/01/2017
+@date edited 18/10/2026
 @date authored 29/11/2016
 
 @author Nathan Sainsbury */
@@ -31,6 +31,11 @@ enum class SchedulerEventTypes
 	Indicates that the scheduler has stopped updating its scheduled items. This event occurs after
 	the update loop exits but before the scheduler update function returns. */
 	SCHEDULER_STOPPED,
+
+	/**
+	Indicates that a frame allocated from the heap after the warm up frames, while the allocation
+	check is enabled. This event occurs at most once per frame, after the frame's updates. */
+	SCHEDULER_FRAME_ALLOCATED,
 };
 
 #endif
\ No newline at end of file
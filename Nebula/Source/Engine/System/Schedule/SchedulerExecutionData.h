@@ -1,7 +1,7 @@
 /**
 A data structure for storing information about the execution of a scheduler.
 
-@date edited 25/01/2017
+@date edited 18/10/2026
 @date authored 05/01/2017
 
 @author Nathan Sainsbury */
@@ -35,6 +35,15 @@ struct SchedulerExecutionData
 	/**
 	The number of refused scheduler item stop requests. */
 	std::uint64_t uiRefusedStopRequests;
+
+	/**
+	The number of frames after warm up in which the scheduler thread allocated from the heap. Only
+	counted while the allocation check is enabled. */
+	std::uint64_t uiFramesAllocating;
+
+	/**
+	The number of heap allocations made by the frames counted in uiFramesAllocating. */
+	std::uint64_t uiFrameAllocations;
 };
 
 #endif
\ No newline at end of file
@@ -2,7 +2,7 @@
 A scheduler time info structure contains information about the current time as it is reported
 by a scheduler.
 
-@date edited 20/01/2017
+@date edited 18/10/2026
 @date authored 25/08/2016
 
 @author Nathan Sainsbury */
@@ -12,6 +12,9 @@ by a scheduler.
 
 #include <chrono>
 
+#include "Engine/System/Memory/FrameMemory.h"
+#include "Engine/System/Thread/TaskSystem.h"
+
 struct SchedulerTimeInfo
 {
 	/**
@@ -44,6 +47,18 @@ struct SchedulerTimeInfo
 	The time in nanoseconds since the last call to onUpdate on this scheduled item. This value is
 	recomputed for each scheduled item. */
 	std::chrono::nanoseconds timeLastUpdate;
+
+	/**
+	The scratch arenas for this frame. Their memory is released once every scheduled item has been
+	updated. This value is consistent across all scheduled items being updated this frame. */
+	FrameMemory frameMemory;
+
+	/**
+	The task system scheduled items may fan work out to. Waiting on its tasks runs them on the
+	scheduler's thread too, and tasks may use the thread frame arenas for scratch memory. May be a
+	nullptr if the owner of the scheduler does not provide one. This value is consistent across
+	all scheduled items being updated this frame. */
+	TaskSystem* pTaskSystem;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "Engine/System/Schedule/StartupGraph.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Engine/System/Tools/ResourceUsage.h"
+
+StartupGraph::StartupGraph()
+{
+}
+
+StartupGraph::~StartupGraph()
+{
+}
+
+StartupTaskId StartupGraph::addTask(const std::string& sName, TaskFunction startUp,
+	TaskFunction shutDown, const std::vector<StartupTaskId>& dependencies)
+{
+	const StartupTaskId id = m_tasks.size();
+
+	Task task;
+	task.sName = sName;
+	task.startUp = std::move(startUp);
+	task.shutDown = std::move(shutDown);
+	task.bStarted = false;
+	for (const StartupTaskId dependency : dependencies)
+	{
+		if (dependency < id && std::find(task.dependencies.begin(), task.dependencies.end(),
+			dependency) == task.dependencies.end())
+		{
+			task.dependencies.push_back(dependency);
+			m_tasks[dependency].dependents.push_back(id);
+		}
+	}
+
+	m_tasks.push_back(std::move(task));
+	return id;
+}
+
+void StartupGraph::clear()
+{
+	m_tasks.clear();
+	m_timings.clear();
+}
+
+bool StartupGraph::startUp(size_t uiNumThreads)
+{
+	return run(true, uiNumThreads);
+}
+
+bool StartupGraph::shutDown(size_t uiNumThreads)
+{
+	return run(false, uiNumThreads);
+}
+
+size_t StartupGraph::getNumTasks() const
+{
+	return m_tasks.size();
+}
+
+const std::string& StartupGraph::getName(StartupTaskId id) const
+{
+	return m_tasks[id].sName;
+}
+
+bool StartupGraph::isStarted(StartupTaskId id) const
+{
+	return id < m_tasks.size() && m_tasks[id].bStarted;
+}
+
+const std::vector<StartupTiming>& StartupGraph::getTimings() const
+{
+	return m_timings;
+}
+
+bool StartupGraph::run(bool bStartUp, size_t uiNumThreads)
+{
+	if (uiNumThreads == 0)
+	{
+		uiNumThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	// Only tasks that are not started take part in start up, and only started ones in shut down.
+	// Each waits on those of its dependencies (or dependents) that are also taking part
+	std::vector<size_t> waiting(m_tasks.size(), 0);
+	std::vector<StartupTaskId> ready;
+	size_t uiNumTakingPart = 0;
+	for (StartupTaskId id = 0; id < m_tasks.size(); ++id)
+	{
+		const Task& task = m_tasks[id];
+		if (task.bStarted == bStartUp)
+		{
+			continue;
+		}
+
+		++uiNumTakingPart;
+		for (const StartupTaskId other : bStartUp ? task.dependencies : task.dependents)
+		{
+			waiting[id] += m_tasks[other].bStarted != bStartUp ? 1 : 0;
+		}
+
+		if (waiting[id] == 0)
+		{
+			ready.push_back(id);
+		}
+	}
+
+	if (uiNumTakingPart > 0)
+	{
+		m_timings.erase(std::remove_if(m_timings.begin(), m_timings.end(),
+			[bStartUp](const StartupTiming& timing)
+		{
+			return timing.bStartUp == bStartUp;
+		}),
+		m_timings.end());
+	}
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	size_t uiNumRunning = 0;
+	bool bSucceeded = true;
+
+	auto work = [&]()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		for (;;)
+		{
+			condition.wait(lock, [&]()
+			{
+				return !ready.empty() || uiNumRunning == 0;
+			});
+
+			if (ready.empty())
+			{
+				break;
+			}
+
+			// Earlier tasks start first and shut down last, so one thread keeps the order they were
+			// added in
+			const std::vector<StartupTaskId>::iterator next = bStartUp ?
+				std::min_element(ready.begin(), ready.end()) :
+				std::max_element(ready.begin(), ready.end());
+			const StartupTaskId id = *next;
+			ready.erase(next);
+			++uiNumRunning;
+			lock.unlock();
+
+			Task& task = m_tasks[id];
+			const TaskFunction& function = bStartUp ? task.startUp : task.shutDown;
+			const ResourceUsage before = ResourceUsage::sample();
+			const bool bResult = !function || function();
+			const ResourceUsage after = ResourceUsage::sample();
+
+			StartupTiming timing;
+			timing.sName = task.sName;
+			timing.bStartUp = bStartUp;
+			timing.bSucceeded = bResult;
+			timing.uiThread = std::hash<std::thread::id>()(std::this_thread::get_id());
+			timing.dStartSeconds = before.dWallSeconds;
+			timing.dWallSeconds = after.dWallSeconds - before.dWallSeconds;
+			timing.dCpuSeconds = after.dCpuSeconds - before.dCpuSeconds;
+			timing.uiAllocations = after.uiAllocations - before.uiAllocations;
+			timing.uiAllocatedBytes = after.uiAllocatedBytes - before.uiAllocatedBytes;
+			timing.uiPeakResidentGrowth = after.uiPeakResidentBytes - before.uiPeakResidentBytes;
+
+			lock.lock();
+			m_timings.push_back(std::move(timing));
+			--uiNumRunning;
+			task.bStarted = bStartUp && bResult;
+			bSucceeded = bSucceeded && bResult;
+
+			// Whatever depends on a task that failed to start is never started, but a task that
+			// failed to shut down still lets the tasks it depends on shut down
+			if (bResult || !bStartUp)
+			{
+				for (const StartupTaskId other : bStartUp ? task.dependents : task.dependencies)
+				{
+					if (m_tasks[other].bStarted != bStartUp && --waiting[other] == 0)
+					{
+						ready.push_back(other);
+					}
+				}
+			}
+
+			condition.notify_all();
+		}
+	};
+
+	const size_t uiNumHelpers = std::min(uiNumThreads, uiNumTakingPart) > 1 ?
+		std::min(uiNumThreads, uiNumTakingPart) - 1 : 0;
+	std::vector<std::thread> helpers;
+	helpers.reserve(uiNumHelpers);
+	for (size_t i = 0; i < uiNumHelpers; ++i)
+	{
+		helpers.push_back(std::thread(work));
+	}
+
+	work();
+	for (std::thread& helper : helpers)
+	{
+		helper.join();
+	}
+
+	return bSucceeded;
+}
@@ -0,0 +1,131 @@
+/**
+A startup graph starts up and shuts down a set of tasks, such as engine layers or subsystems, in
+dependency order. Each task has a start up and a shut down function, and may depend on any other
+task added before it.
+
+Start up runs every task once all of its dependencies have started, so independent tasks run
+concurrently on a small pool of threads. If a task fails to start, nothing that depends on it is
+started, though unrelated tasks still are. Shut down runs in the reverse order: a task is shut
+down once everything that depends on it has been, and only tasks that started are shut down.
+
+The calling thread takes part in the work. With a single thread, tasks start in the order they
+were added and shut down in the reverse order, which can help when debugging. Start up and shut
+down functions must be safe to run alongside those of unrelated tasks.
+
+Each time a task runs, its wall time, CPU time, allocations and peak resident memory growth are
+recorded as a startup timing, so slow starts can be traced to the tasks responsible.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef STARTUP_GRAPH_H
+#define STARTUP_GRAPH_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Engine/System/Schedule/StartupTiming.h"
+
+typedef size_t StartupTaskId;
+
+class StartupGraph
+{
+	public:
+		typedef std::function<bool()> TaskFunction;
+
+		/**
+		Constructs an empty graph. */
+		StartupGraph();
+
+		/**
+		Destructor. Tasks that are still started are not shut down. */
+		~StartupGraph();
+
+		StartupGraph(const StartupGraph& other) = delete;
+		StartupGraph& operator=(const StartupGraph& other) = delete;
+
+		/**
+		Adds a task. Tasks may not be added during start up or shut down.
+		@param sName The name of the task, for reporting
+		@param startUp The start up function. Returns true if the task started
+		@param shutDown The shut down function. Returns true if the task shut down. May be empty
+		@param dependencies The tasks that must start before this one, and shut down after it.
+		Ids of tasks that have not been added yet are ignored, so the graph cannot have cycles
+		@return The id of the task */
+		StartupTaskId addTask(const std::string& sName, TaskFunction startUp,
+			TaskFunction shutDown = TaskFunction(),
+			const std::vector<StartupTaskId>& dependencies = std::vector<StartupTaskId>());
+
+		/**
+		Removes every task and timing. Tasks that are still started are not shut down. */
+		void clear();
+
+		/**
+		Starts up every task that has not started yet.
+		@param uiNumThreads The maximum number of threads to use, including the calling thread. 0
+		uses one thread per hardware thread
+		@return True if every task started, false if any failed */
+		bool startUp(size_t uiNumThreads = 0);
+
+		/**
+		Shuts down every started task. A task that fails to shut down is treated as shut down, so
+		that the tasks it depends on are still shut down.
+		@param uiNumThreads The maximum number of threads to use, including the calling thread. 0
+		uses one thread per hardware thread
+		@return True if every task shut down, false if any failed */
+		bool shutDown(size_t uiNumThreads = 0);
+
+		/**
+		Retrieves the number of tasks.
+		@return The number of tasks */
+		size_t getNumTasks() const;
+
+		/**
+		Retrieves the name of a task.
+		@param id The id of the task
+		@return The name */
+		const std::string& getName(StartupTaskId id) const;
+
+		/**
+		Queries whether a task is started.
+		@param id The id of the task
+		@return True if the task is started, false otherwise */
+		bool isStarted(StartupTaskId id) const;
+
+		/**
+		Retrieves the timings of the tasks run by the most recent start up and the most recent
+		shut down, in the order the tasks finished. A start up or shut down that has no tasks to
+		run keeps the previous timings.
+		@return The timings */
+		const std::vector<StartupTiming>& getTimings() const;
+
+	protected:
+
+	private:
+		struct Task
+		{
+			std::string sName;
+			TaskFunction startUp;
+			TaskFunction shutDown;
+			std::vector<StartupTaskId> dependencies;
+			std::vector<StartupTaskId> dependents;
+			bool bStarted;
+		};
+
+		std::vector<Task> m_tasks;
+		std::vector<StartupTiming> m_timings;
+
+		/**
+		Runs tasks in dependency order. In the forward direction a task waits on its
+		dependencies, and in reverse it waits on its dependents.
+		@param bStartUp True to start tasks up, false to shut them down
+		@param uiNumThreads The maximum number of threads to use
+		@return True if every task succeeded */
+		bool run(bool bStartUp, size_t uiNumThreads);
+};
+
+#endif
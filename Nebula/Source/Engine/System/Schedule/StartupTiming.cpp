@@ -0,0 +1,111 @@
+#include "Engine/System/Schedule/StartupTiming.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace
+{
+	/**
+	Writes a string as a quoted JSON string.
+	@param stream The stream to write to
+	@param sText The string */
+	void writeJsonString(std::ostream& stream, const std::string& sText)
+	{
+		stream << '"';
+		for (const char c : sText)
+		{
+			if (c == '"' || c == '\\')
+			{
+				stream << '\\' << c;
+			}
+			else if ((unsigned char)c < 0x20)
+			{
+				const char* const pHexDigits = "0123456789abcdef";
+				stream << "\\u00" << pHexDigits[(c >> 4) & 0xF] << pHexDigits[c & 0xF];
+			}
+			else
+			{
+				stream << c;
+			}
+		}
+
+		stream << '"';
+	}
+}
+
+void writeStartupReport(std::ostream& stream, const std::vector<StartupTiming>& timings)
+{
+	size_t uiNameWidth = 4;
+	for (const StartupTiming& timing : timings)
+	{
+		uiNameWidth = std::max(uiNameWidth, timing.sName.size());
+	}
+
+	std::ios format(nullptr);
+	format.copyfmt(stream);
+
+	const int iNameWidth = (int)uiNameWidth + 2;
+	stream << std::left << std::setw(11) << "Phase" << std::setw(iNameWidth) << "Task" <<
+		std::right << std::setw(10) << "Wall ms" << std::setw(10) << "CPU ms" << std::setw(10) <<
+		"Allocs" << std::setw(12) << "Alloc KB" << std::setw(12) << "Peak +KB" << '\n';
+
+	stream << std::fixed;
+	for (const StartupTiming& timing : timings)
+	{
+		stream << std::left << std::setw(11) << (timing.bStartUp ? "start up" : "shut down") <<
+			std::setw(iNameWidth) << timing.sName << std::right << std::setprecision(3) <<
+			std::setw(10) << timing.dWallSeconds * 1e3 << std::setw(10) <<
+			timing.dCpuSeconds * 1e3 << std::setw(10) << timing.uiAllocations <<
+			std::setprecision(1) << std::setw(12) << (double)timing.uiAllocatedBytes / 1024.0 <<
+			std::setw(12) << (double)timing.uiPeakResidentGrowth / 1024.0;
+
+		if (!timing.bSucceeded)
+		{
+			stream << "  FAILED";
+		}
+
+		stream << '\n';
+	}
+
+	stream.copyfmt(format);
+}
+
+void writeStartupTrace(std::ostream& stream, const std::vector<StartupTiming>& timings)
+{
+	double dEpoch = 0.0;
+	for (size_t i = 0; i < timings.size(); ++i)
+	{
+		dEpoch = i == 0 ? timings[i].dStartSeconds : std::min(dEpoch, timings[i].dStartSeconds);
+	}
+
+	// Trace viewers expect small thread numbers, so threads are numbered in order of appearance
+	std::vector<size_t> threads;
+
+	std::ios format(nullptr);
+	format.copyfmt(stream);
+
+	stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+	for (size_t i = 0; i < timings.size(); ++i)
+	{
+		const StartupTiming& timing = timings[i];
+		const size_t uiThread = std::find(threads.begin(), threads.end(), timing.uiThread) -
+			threads.begin();
+		if (uiThread == threads.size())
+		{
+			threads.push_back(timing.uiThread);
+		}
+
+		stream << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+		writeJsonString(stream, timing.sName);
+		stream << ",\"cat\":\"" << (timing.bStartUp ? "startup" : "shutdown") <<
+			"\",\"ph\":\"X\",\"pid\":1,\"tid\":" << uiThread + 1 << ",\"ts\":" <<
+			(timing.dStartSeconds - dEpoch) * 1e6 << ",\"dur\":" << timing.dWallSeconds * 1e6 <<
+			",\"args\":{\"succeeded\":" << (timing.bSucceeded ? "true" : "false") <<
+			",\"cpuMs\":" << timing.dCpuSeconds * 1e3 << ",\"allocations\":" <<
+			timing.uiAllocations << ",\"allocatedBytes\":" << timing.uiAllocatedBytes <<
+			",\"peakResidentGrowthBytes\":" << timing.uiPeakResidentGrowth << "}}";
+	}
+
+	stream << "\n]}\n";
+	stream.copyfmt(format);
+}
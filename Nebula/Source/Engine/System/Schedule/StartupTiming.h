@@ -0,0 +1,78 @@
+/**
+A startup timing records what it cost to start up or shut down a single task of a startup graph,
+such as an engine layer or subsystem. Timings may be written out as a plain text report, or as a
+trace in the Chrome trace event format, which chrome://tracing and Perfetto can open to show
+which tasks ran concurrently and on which threads.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef STARTUP_TIMING_H
+#define STARTUP_TIMING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct StartupTiming
+{
+	/**
+	The name of the task. */
+	std::string sName;
+
+	/**
+	True if the task was started up, false if it was shut down. */
+	bool bStartUp;
+
+	/**
+	True if the task succeeded. */
+	bool bSucceeded;
+
+	/**
+	Identifies the thread the task ran on. Tasks that ran on the same thread share a value. */
+	size_t uiThread;
+
+	/**
+	The time the task began, from a steady clock, in seconds. */
+	double dStartSeconds;
+
+	/**
+	The time the task took, in seconds. */
+	double dWallSeconds;
+
+	/**
+	The CPU time the task's thread used while running it, in seconds. */
+	double dCpuSeconds;
+
+	/**
+	The number of heap allocations the task's thread made while running it. */
+	std::uint64_t uiAllocations;
+
+	/**
+	The number of bytes the task's thread allocated while running it. */
+	std::uint64_t uiAllocatedBytes;
+
+	/**
+	How much the peak resident memory of the process grew while the task ran, in bytes. Tasks
+	running alongside it contribute too. */
+	std::uint64_t uiPeakResidentGrowth;
+};
+
+/**
+Writes a plain text report with one line per timing, in the order given.
+@param stream The stream to write to
+@param timings The timings */
+void writeStartupReport(std::ostream& stream, const std::vector<StartupTiming>& timings);
+
+/**
+Writes a trace in the Chrome trace event format, with one complete event per timing. Times are
+relative to the earliest timing.
+@param stream The stream to write to
+@param timings The timings */
+void writeStartupTrace(std::ostream& stream, const std::vector<StartupTiming>& timings);
+
+#endif
@@ -0,0 +1,58 @@
+/**
+A task is a function to run on a task system, along with the range of work it covers. Tasks are
+kept in a fixed ring per thread by the task system and are never allocated from the heap.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef TASK_H
+#define TASK_H
+
+#include <atomic>
+#include <cstddef>
+
+class TaskCounter;
+
+/**
+A function run as a task.
+@param pData The data given when the task was submitted
+@param uiBegin The first index of the range the task covers
+@param uiEnd One past the last index of the range the task covers */
+typedef void (*TaskFunction)(void* pData, size_t uiBegin, size_t uiEnd);
+
+struct Task
+{
+	TaskFunction pFunction;
+	void* pData;
+	size_t uiBegin;
+	size_t uiEnd;
+
+	/**
+	The counter decremented once the task has run. */
+	TaskCounter* pCounter;
+
+	/**
+	The next task waiting on the same counter, while this task waits for its dependency. */
+	Task* pNextWaiting;
+
+	/**
+	Set from when the task is submitted until it has run, so its slot is not reused. */
+	std::atomic<bool> bInUse;
+
+	/**
+	Constructs an unused task. */
+	Task() :
+		pFunction(nullptr),
+		pData(nullptr),
+		uiBegin(0),
+		uiEnd(0),
+		pCounter(nullptr),
+		pNextWaiting(nullptr),
+		bInUse(false)
+	{
+	}
+};
+
+#endif
@@ -0,0 +1,23 @@
+#include "Engine/System/Thread/TaskCounter.h"
+
+TaskCounter::TaskCounter() :
+	m_uiValue(0),
+	m_pWaiting(nullptr)
+{
+}
+
+TaskCounter::~TaskCounter()
+{
+	// The thread that took the counter to zero may still hold the lock
+	std::lock_guard<std::mutex> lock(m_mutex);
+}
+
+bool TaskCounter::isDone() const
+{
+	return m_uiValue.load(std::memory_order_acquire) == 0;
+}
+
+size_t TaskCounter::getValue() const
+{
+	return m_uiValue.load(std::memory_order_acquire);
+}
@@ -0,0 +1,61 @@
+/**
+A task counter counts the tasks submitted with it that have not yet run. Waiting on a counter runs
+other tasks until it reaches zero, and tasks may be submitted to run only once a counter has
+reached zero, which is how dependencies between tasks are expressed.
+
+A counter must outlive the tasks submitted with it. Destroying a counter waits for the thread
+that ran its last task to let go of it. More tasks must not be submitted with a counter while
+tasks are waiting for it to reach zero.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef TASK_COUNTER_H
+#define TASK_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "Engine/System/Thread/Task.h"
+
+class TaskCounter
+{
+	public:
+		/**
+		Constructs a counter at zero. */
+		TaskCounter();
+
+		/**
+		Destructor. */
+		~TaskCounter();
+
+		TaskCounter(const TaskCounter& other) = delete;
+		TaskCounter& operator=(const TaskCounter& other) = delete;
+
+		/**
+		Queries whether every task submitted with the counter has run.
+		@return True if the counter is zero, false otherwise */
+		bool isDone() const;
+
+		/**
+		Retrieves the number of tasks submitted with the counter that have not yet run.
+		@return The count */
+		size_t getValue() const;
+
+	protected:
+
+	private:
+		friend class TaskSystem;
+
+		std::atomic<size_t> m_uiValue;
+
+		/**
+		Guards the tasks waiting for the counter to reach zero, and the counter reaching zero. */
+		std::mutex m_mutex;
+		Task* m_pWaiting;
+};
+
+#endif
@@ -0,0 +1,418 @@
+#include "Engine/System/Thread/TaskSystem.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+	std::atomic<std::uint64_t> g_uiNextId(1);
+
+	/**
+	The system and context the calling thread last asked for. */
+	thread_local std::uint64_t t_uiCachedId = 0;
+	thread_local void* t_pCachedContext = nullptr;
+
+	/**
+	The number of times an idle worker looks for work before it sleeps. */
+	const size_t g_uiIdleSpins = 64;
+
+	/**
+	Pins a thread to a single hardware thread. Pinning is not supported on every platform, and
+	a thread that cannot be pinned runs wherever the operating system chooses.
+	@param thread The thread
+	@param uiHardwareThread The index of the hardware thread
+	@return True if the thread was pinned, false otherwise */
+	bool pinThread(std::thread& thread, size_t uiHardwareThread)
+	{
+#ifdef _WIN32
+		if (uiHardwareThread >= sizeof(DWORD_PTR) * 8)
+		{
+			return false;
+		}
+
+		return SetThreadAffinityMask(thread.native_handle(),
+			(DWORD_PTR)1 << uiHardwareThread) != 0;
+#elif defined(__linux__)
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+		CPU_SET(uiHardwareThread, &cpuSet);
+		return pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+		(void)thread;
+		(void)uiHardwareThread;
+		return false;
+#endif
+	}
+}
+
+TaskSystem::TaskSystem() :
+	m_uiId(0),
+	m_bRunning(false),
+	m_uiNumOwnedContexts(0),
+	m_uiNumSleeping(0),
+	m_uiWakeEpoch(0)
+{
+}
+
+TaskSystem::~TaskSystem()
+{
+	stop();
+}
+
+bool TaskSystem::start(size_t uiNumWorkers, size_t uiMaxTasks, size_t uiMaxOtherThreads,
+	bool bPinWorkers)
+{
+	if (m_bRunning)
+	{
+		return false;
+	}
+
+	const size_t uiNumHardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	if (uiNumWorkers == 0)
+	{
+		uiNumWorkers = std::max<size_t>(uiNumHardwareThreads - 1, 1);
+	}
+
+	size_t uiCapacity = 1;
+	while (uiCapacity < uiMaxTasks)
+	{
+		uiCapacity *= 2;
+	}
+
+	// Every context is created up front, so thieves never see the list change
+	m_contexts.clear();
+	for (size_t i = 0; i < uiNumWorkers + uiMaxOtherThreads; ++i)
+	{
+		m_contexts.emplace_back(new Context(i, uiCapacity));
+	}
+
+	m_uiId = g_uiNextId++;
+	m_uiNumOwnedContexts = uiNumWorkers;
+	m_bRunning = true;
+
+	m_workers.reserve(uiNumWorkers);
+	for (size_t i = 0; i < uiNumWorkers; ++i)
+	{
+		m_workers.emplace_back(&TaskSystem::runWorker, this, i);
+		if (bPinWorkers)
+		{
+			pinThread(m_workers.back(), (i + 1) % uiNumHardwareThreads);
+		}
+	}
+
+	return true;
+}
+
+void TaskSystem::stop()
+{
+	if (!m_bRunning)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_sleepMutex);
+		m_bRunning = false;
+	}
+
+	m_wakeCondition.notify_all();
+	for (std::thread& worker : m_workers)
+	{
+		worker.join();
+	}
+
+	// Run whatever was left behind, so that no counter is left waiting
+	for (const std::unique_ptr<Context>& pContext : m_contexts)
+	{
+		Task* pTask = nullptr;
+		while (pContext->deque.steal(pTask))
+		{
+			runTask(nullptr, pTask);
+		}
+	}
+
+	// Threads that cached a context will not find it again
+	m_uiId = 0;
+	m_workers.clear();
+	m_contexts.clear();
+	m_uiNumOwnedContexts = 0;
+}
+
+bool TaskSystem::isRunning() const
+{
+	return m_bRunning;
+}
+
+size_t TaskSystem::getNumWorkers() const
+{
+	return m_workers.size();
+}
+
+void TaskSystem::submit(TaskFunction pFunction, void* pData, TaskCounter& counter,
+	size_t uiBegin, size_t uiEnd)
+{
+	counter.m_uiValue.fetch_add(1, std::memory_order_relaxed);
+
+	Context* pContext = getLocalContext();
+	Task* pTask = allocateTask(pContext);
+	if (pTask == nullptr)
+	{
+		// Run the task now rather than allocate room for it
+		pFunction(pData, uiBegin, uiEnd);
+		decrementCounter(pContext, counter);
+		return;
+	}
+
+	pTask->pFunction = pFunction;
+	pTask->pData = pData;
+	pTask->uiBegin = uiBegin;
+	pTask->uiEnd = uiEnd;
+	pTask->pCounter = &counter;
+	pushTask(pContext, pTask);
+}
+
+void TaskSystem::submitAfter(TaskCounter& dependency, TaskFunction pFunction, void* pData,
+	TaskCounter& counter, size_t uiBegin, size_t uiEnd)
+{
+	Context* pContext = getLocalContext();
+	Task* pTask = allocateTask(pContext);
+	if (pTask == nullptr)
+	{
+		wait(dependency);
+		submit(pFunction, pData, counter, uiBegin, uiEnd);
+		return;
+	}
+
+	counter.m_uiValue.fetch_add(1, std::memory_order_relaxed);
+	pTask->pFunction = pFunction;
+	pTask->pData = pData;
+	pTask->uiBegin = uiBegin;
+	pTask->uiEnd = uiEnd;
+	pTask->pCounter = &counter;
+
+	{
+		// The task is released by whichever thread takes the dependency to zero
+		std::lock_guard<std::mutex> lock(dependency.m_mutex);
+		if (dependency.m_uiValue.load(std::memory_order_acquire) != 0)
+		{
+			pTask->pNextWaiting = dependency.m_pWaiting;
+			dependency.m_pWaiting = pTask;
+			return;
+		}
+	}
+
+	pushTask(pContext, pTask);
+}
+
+void TaskSystem::wait(const TaskCounter& counter)
+{
+	Context* pContext = getLocalContext();
+	while (!counter.isDone())
+	{
+		Task* pTask = findTask(pContext);
+		if (pTask != nullptr)
+		{
+			runTask(pContext, pTask);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void TaskSystem::runWorker(size_t uiContext)
+{
+	Context* pContext = m_contexts[uiContext].get();
+	pContext->owner = std::this_thread::get_id();
+	t_uiCachedId = m_uiId;
+	t_pCachedContext = pContext;
+
+	size_t uiIdleSpins = 0;
+	while (m_bRunning.load(std::memory_order_acquire))
+	{
+		Task* pTask = findTask(pContext);
+		if (pTask != nullptr)
+		{
+			runTask(pContext, pTask);
+			uiIdleSpins = 0;
+			continue;
+		}
+
+		if (++uiIdleSpins < g_uiIdleSpins)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		// Announce the sleep before the last look for work. A task pushed after that look sees
+		// the sleeper and advances the epoch under the mutex, so the wake up cannot be missed
+		std::unique_lock<std::mutex> lock(m_sleepMutex);
+		m_uiNumSleeping.fetch_add(1, std::memory_order_seq_cst);
+		const size_t uiEpoch = m_uiWakeEpoch;
+		if (!hasQueuedTasks())
+		{
+			m_wakeCondition.wait(lock, [this, uiEpoch]()
+			{
+				return m_uiWakeEpoch != uiEpoch || !m_bRunning.load(std::memory_order_acquire);
+			});
+		}
+
+		m_uiNumSleeping.fetch_sub(1, std::memory_order_relaxed);
+		uiIdleSpins = 0;
+	}
+}
+
+TaskSystem::Context* TaskSystem::getLocalContext()
+{
+	if (t_uiCachedId == m_uiId)
+	{
+		return static_cast<Context*>(t_pCachedContext);
+	}
+
+	if (!m_bRunning.load(std::memory_order_acquire))
+	{
+		return nullptr;
+	}
+
+	const std::thread::id thread = std::this_thread::get_id();
+	std::lock_guard<std::mutex> lock(m_contextMutex);
+
+	Context* pContext = nullptr;
+	const size_t uiNumOwnedContexts = m_uiNumOwnedContexts.load(std::memory_order_relaxed);
+	for (size_t i = m_workers.size(); i < uiNumOwnedContexts; ++i)
+	{
+		if (m_contexts[i]->owner == thread)
+		{
+			pContext = m_contexts[i].get();
+		}
+	}
+
+	if (pContext == nullptr && uiNumOwnedContexts < m_contexts.size())
+	{
+		pContext = m_contexts[uiNumOwnedContexts].get();
+		pContext->owner = thread;
+		m_uiNumOwnedContexts.store(uiNumOwnedContexts + 1, std::memory_order_release);
+	}
+
+	t_uiCachedId = m_uiId;
+	t_pCachedContext = pContext;
+	return pContext;
+}
+
+Task* TaskSystem::allocateTask(Context* pContext)
+{
+	if (pContext == nullptr)
+	{
+		return nullptr;
+	}
+
+	const size_t uiMask = pContext->deque.getCapacity() - 1;
+	Task* pTask = &pContext->pTasks[pContext->uiNextTask & uiMask];
+	if (pTask->bInUse.load(std::memory_order_acquire))
+	{
+		return nullptr;
+	}
+
+	++pContext->uiNextTask;
+	pTask->bInUse.store(true, std::memory_order_relaxed);
+	pTask->pNextWaiting = nullptr;
+	return pTask;
+}
+
+void TaskSystem::pushTask(Context* pContext, Task* pTask)
+{
+	if (pContext == nullptr || !pContext->deque.push(pTask))
+	{
+		runTask(pContext, pTask);
+		return;
+	}
+
+	if (m_uiNumSleeping.load(std::memory_order_seq_cst) != 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			++m_uiWakeEpoch;
+		}
+
+		m_wakeCondition.notify_one();
+	}
+}
+
+bool TaskSystem::hasQueuedTasks() const
+{
+	// Every context is checked, as one may gain an owner and a task after the count is read
+	for (const std::unique_ptr<Context>& pContext : m_contexts)
+	{
+		if (!pContext->deque.isEmpty())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+Task* TaskSystem::findTask(Context* pContext)
+{
+	Task* pTask = nullptr;
+	if (pContext != nullptr && pContext->deque.pop(pTask))
+	{
+		return pTask;
+	}
+
+	// Start from a different victim on each thread, so thieves do not all hit the same deque
+	const size_t uiNumContexts = m_uiNumOwnedContexts.load(std::memory_order_acquire);
+	if (uiNumContexts == 0)
+	{
+		return nullptr;
+	}
+
+	const size_t uiStart = pContext != nullptr ? pContext->uiIndex + 1 : 0;
+	for (size_t i = 0; i < uiNumContexts; ++i)
+	{
+		Context* pVictim = m_contexts[(uiStart + i) % uiNumContexts].get();
+		if (pVictim != pContext && pVictim->deque.steal(pTask))
+		{
+			return pTask;
+		}
+	}
+
+	return nullptr;
+}
+
+void TaskSystem::runTask(Context* pContext, Task* pTask)
+{
+	pTask->pFunction(pTask->pData, pTask->uiBegin, pTask->uiEnd);
+
+	TaskCounter& counter = *pTask->pCounter;
+	pTask->bInUse.store(false, std::memory_order_release);
+	decrementCounter(pContext, counter);
+}
+
+void TaskSystem::decrementCounter(Context* pContext, TaskCounter& counter)
+{
+	Task* pWaiting = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(counter.m_mutex);
+		if (counter.m_uiValue.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			pWaiting = counter.m_pWaiting;
+			counter.m_pWaiting = nullptr;
+		}
+	}
+
+	// The counter may be destroyed from here on, so only the released tasks are touched
+	while (pWaiting != nullptr)
+	{
+		Task* pNext = pWaiting->pNextWaiting;
+		pushTask(pContext, pWaiting);
+		pWaiting = pNext;
+	}
+}
@@ -0,0 +1,264 @@
+/**
+The task system runs small tasks on a fixed set of worker threads. Each thread that submits tasks
+has its own work stealing deque, and a thread that runs out of work steals from the others, so
+work spreads itself across the workers without a shared queue.
+
+Tasks are submitted with a task counter and waited on through it. A thread that waits runs other
+tasks until the counter reaches zero, so waiting never blocks a worker and the scheduler's thread
+helps with the work it fans out. Tasks may also be submitted to run only once another counter
+has reached zero.
+
+Submitting a task never allocates. Each thread keeps its tasks in a fixed ring, and a task that
+does not fit in its thread's ring or deque is run immediately on the submitting thread instead.
+The same happens while the system is not running, so code that uses it also works without any
+workers.
+
+Threads other than the workers are given a deque the first time they submit or wait, up to a
+fixed number of them. Further threads run their tasks immediately.
+
+Idle workers briefly look for more work and then sleep until a submitted task wakes them, so an
+idle system uses no processor time.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef TASK_SYSTEM_H
+#define TASK_SYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Engine/System/Thread/Task.h"
+#include "Engine/System/Thread/TaskCounter.h"
+#include "Engine/System/Thread/WorkStealingDeque.h"
+
+class TaskSystem
+{
+	public:
+		/**
+		Constructs a task system that is not running. */
+		TaskSystem();
+
+		/**
+		Destructor. Stops the system if it is running. */
+		~TaskSystem();
+
+		TaskSystem(const TaskSystem& other) = delete;
+		TaskSystem& operator=(const TaskSystem& other) = delete;
+
+		/**
+		Starts the worker threads.
+		@param uiNumWorkers The number of worker threads. 0 uses one fewer than the number of
+		hardware threads, leaving one for the thread that runs the scheduler
+		@param uiMaxTasks The most tasks each thread may have waiting to run before it runs them
+		itself. Rounded up to a power of two
+		@param uiMaxOtherThreads The number of threads other than the workers given a deque
+		@param bPinWorkers Pins each worker to its own hardware thread, skipping the first
+		@return True if the system was started, false if it was already running */
+		bool start(size_t uiNumWorkers, size_t uiMaxTasks, size_t uiMaxOtherThreads,
+			bool bPinWorkers);
+
+		/**
+		Stops the worker threads once they finish their current tasks. Tasks that have not yet
+		started are run on the calling thread. No other thread may submit or wait while the system
+		is stopping. */
+		void stop();
+
+		/**
+		Queries whether the system is running.
+		@return True if the workers are running, false otherwise */
+		bool isRunning() const;
+
+		/**
+		Retrieves the number of worker threads.
+		@return The number of workers, or 0 if the system is not running */
+		size_t getNumWorkers() const;
+
+		/**
+		Submits a task.
+		@param pFunction The function to run
+		@param pData The data handed to the function. Must outlive the task
+		@param counter The counter incremented now and decremented once the task has run
+		@param uiBegin The first index of the range handed to the function
+		@param uiEnd One past the last index of the range handed to the function */
+		void submit(TaskFunction pFunction, void* pData, TaskCounter& counter, size_t uiBegin = 0,
+			size_t uiEnd = 0);
+
+		/**
+		Submits a task that runs once another counter has reached zero.
+		@param dependency The counter to wait for
+		@param pFunction The function to run
+		@param pData The data handed to the function. Must outlive the task
+		@param counter The counter incremented now and decremented once the task has run
+		@param uiBegin The first index of the range handed to the function
+		@param uiEnd One past the last index of the range handed to the function */
+		void submitAfter(TaskCounter& dependency, TaskFunction pFunction, void* pData,
+			TaskCounter& counter, size_t uiBegin = 0, size_t uiEnd = 0);
+
+		/**
+		Runs other tasks until a counter reaches zero.
+		@param counter The counter */
+		void wait(const TaskCounter& counter);
+
+		/**
+		Invokes a function over a range of indices, splitting the range in half until the pieces
+		are no larger than the grain size and running the pieces as tasks. The calling thread
+		works on the range too, and returns once all of it has been processed.
+		@param uiCount The number of indices, starting from 0
+		@param uiGrainSize The largest piece of the range handed to a single invocation
+		@param function The function to invoke. Receives the first index and one past the last
+		index of a piece, and is invoked concurrently from several threads */
+		template <typename Function>
+		void parallelFor(size_t uiCount, size_t uiGrainSize, const Function& function)
+		{
+			if (uiCount == 0)
+			{
+				return;
+			}
+
+			TaskCounter counter;
+			ParallelForData<Function> data;
+			data.pTaskSystem = this;
+			data.pFunction = &function;
+			data.pCounter = &counter;
+			data.uiGrainSize = std::max<size_t>(uiGrainSize, 1);
+
+			runParallelFor<Function>(&data, 0, uiCount);
+			wait(counter);
+		}
+
+	protected:
+
+	private:
+		/**
+		The deque and task ring of a thread that submits tasks. */
+		struct Context
+		{
+			size_t uiIndex;
+			std::thread::id owner;
+			WorkStealingDeque<Task*> deque;
+			std::unique_ptr<Task[]> pTasks;
+			size_t uiNextTask;
+
+			/**
+			Constructs a context without an owner.
+			@param uiContextIndex The index of the context
+			@param uiMaxTasks The capacity of the deque and ring. Must be a power of two */
+			Context(size_t uiContextIndex, size_t uiMaxTasks) :
+				uiIndex(uiContextIndex),
+				deque(uiMaxTasks),
+				pTasks(new Task[uiMaxTasks]),
+				uiNextTask(0)
+			{
+			}
+		};
+
+		template <typename Function>
+		struct ParallelForData
+		{
+			TaskSystem* pTaskSystem;
+			const Function* pFunction;
+			TaskCounter* pCounter;
+			size_t uiGrainSize;
+		};
+
+		/**
+		Identifies the system in thread local caches. Changes each time the system starts. */
+		std::uint64_t m_uiId;
+
+		std::atomic<bool> m_bRunning;
+		std::vector<std::thread> m_workers;
+		std::vector<std::unique_ptr<Context>> m_contexts;
+
+		/**
+		The number of contexts that have an owner. The workers own the first contexts. */
+		std::atomic<size_t> m_uiNumOwnedContexts;
+		std::mutex m_contextMutex;
+
+		std::mutex m_sleepMutex;
+		std::condition_variable m_wakeCondition;
+		std::atomic<size_t> m_uiNumSleeping;
+
+		/**
+		Advanced under the sleep mutex each time sleeping workers are woken for new work. */
+		size_t m_uiWakeEpoch;
+
+		/**
+		Runs a worker thread until the system stops.
+		@param uiContext The index of the worker's context */
+		void runWorker(size_t uiContext);
+
+		/**
+		Retrieves the calling thread's context, giving it one if it has none and one is free.
+		@return The context, or a nullptr if every context is taken */
+		Context* getLocalContext();
+
+		/**
+		Takes a task from a context's ring.
+		@param pContext The context, or a nullptr
+		@return The task, or a nullptr if the ring's next slot is still in use */
+		Task* allocateTask(Context* pContext);
+
+		/**
+		Pushes a task on to a context's deque, or runs it if the deque is full.
+		@param pContext The context, or a nullptr to run the task now
+		@param pTask The task */
+		void pushTask(Context* pContext, Task* pTask);
+
+		/**
+		Queries whether any context's deque holds a task.
+		@return True if a task was queued, false otherwise */
+		bool hasQueuedTasks() const;
+
+		/**
+		Pops a task from a context's deque, or steals one from another context's deque.
+		@param pContext The context to pop from, or a nullptr to only steal
+		@return The task, or a nullptr if no task was found */
+		Task* findTask(Context* pContext);
+
+		/**
+		Runs a task and decrements its counter.
+		@param pContext The context of the calling thread, or a nullptr
+		@param pTask The task */
+		void runTask(Context* pContext, Task* pTask);
+
+		/**
+		Decrements a counter, releasing the tasks waiting on it once it reaches zero.
+		@param pContext The context of the calling thread, or a nullptr
+		@param counter The counter */
+		void decrementCounter(Context* pContext, TaskCounter& counter);
+
+		/**
+		Runs a piece of a parallel for, splitting off half of the piece as a task until it is no
+		larger than the grain size.
+		@param pData The parallel for data
+		@param uiBegin The first index of the piece
+		@param uiEnd One past the last index of the piece */
+		template <typename Function>
+		static void runParallelFor(void* pData, size_t uiBegin, size_t uiEnd)
+		{
+			const ParallelForData<Function>& data =
+				*static_cast<const ParallelForData<Function>*>(pData);
+
+			while (uiEnd - uiBegin > data.uiGrainSize)
+			{
+				const size_t uiMiddle = uiBegin + (uiEnd - uiBegin) / 2;
+				data.pTaskSystem->submit(&runParallelFor<Function>, pData, *data.pCounter,
+					uiMiddle, uiEnd);
+				uiEnd = uiMiddle;
+			}
+
+			(*data.pFunction)(uiBegin, uiEnd);
+		}
+};
+
+#endif
@@ -0,0 +1,150 @@
+/**
+A work stealing deque is the Chase-Lev deque of a single owning thread. The owner pushes and pops
+items at the bottom, last in first out, so it keeps working on the data it touched most recently.
+Any other thread may steal items from the top, first in first out, taking the oldest and usually
+largest pieces of work.
+
+Pushing and popping take no locks and only contend with thieves when a single item is left.
+Stealing takes a single compare and swap.
+
+The deque has a fixed capacity, so it never allocates once constructed. Pushing fails when it is
+full, and the owner is expected to run the item itself instead.
+
+Items are stored in atomics, so they must be trivially copyable, such as a pointer.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class WorkStealingDeque
+{
+	public:
+		/**
+		Constructs a deque.
+		@param uiCapacity The most items the deque may hold. Rounded up to a power of two */
+		explicit WorkStealingDeque(size_t uiCapacity) :
+			m_iTop(0),
+			m_iBottom(0),
+			m_uiMask(0)
+		{
+			size_t uiRoundedCapacity = 1;
+			while (uiRoundedCapacity < uiCapacity)
+			{
+				uiRoundedCapacity *= 2;
+			}
+
+			m_uiMask = uiRoundedCapacity - 1;
+			m_pItems.reset(new std::atomic<T>[uiRoundedCapacity]);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque& other) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+
+		/**
+		Pushes an item on to the bottom of the deque. Only the owner may push.
+		@param item The item
+		@return True if the item was pushed, false if the deque was full */
+		bool push(T item)
+		{
+			const std::int64_t iBottom = m_iBottom.load(std::memory_order_relaxed);
+			const std::int64_t iTop = m_iTop.load(std::memory_order_acquire);
+			if ((size_t)(iBottom - iTop) > m_uiMask)
+			{
+				return false;
+			}
+
+			// Sequentially consistent, so a thread that checks isEmpty before it sleeps either sees
+			// the item or is seen by the pusher
+			m_pItems[(size_t)iBottom & m_uiMask].store(item, std::memory_order_relaxed);
+			m_iBottom.store(iBottom + 1, std::memory_order_seq_cst);
+			return true;
+		}
+
+		/**
+		Pops the most recently pushed item from the bottom of the deque. Only the owner may pop.
+		@param item Set to the item
+		@return True if an item was popped, false if the deque was empty */
+		bool pop(T& item)
+		{
+			const std::int64_t iBottom = m_iBottom.load(std::memory_order_relaxed) - 1;
+			m_iBottom.store(iBottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			std::int64_t iTop = m_iTop.load(std::memory_order_relaxed);
+
+			if (iTop > iBottom)
+			{
+				m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			item = m_pItems[(size_t)iBottom & m_uiMask].load(std::memory_order_relaxed);
+			if (iTop != iBottom)
+			{
+				return true;
+			}
+
+			// The last item may be taken by a thief at the same time
+			const bool bWon = m_iTop.compare_exchange_strong(iTop, iTop + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+			return bWon;
+		}
+
+		/**
+		Steals the least recently pushed item from the top of the deque. Any thread may steal.
+		@param item Set to the item
+		@return True if an item was stolen, false if the deque was empty or another thread took
+		the item first */
+		bool steal(T& item)
+		{
+			std::int64_t iTop = m_iTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const std::int64_t iBottom = m_iBottom.load(std::memory_order_acquire);
+			if (iTop >= iBottom)
+			{
+				return false;
+			}
+
+			item = m_pItems[(size_t)iTop & m_uiMask].load(std::memory_order_relaxed);
+			return m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order_seq_cst,
+				std::memory_order_relaxed);
+		}
+
+		/**
+		Queries whether the deque appears empty. The answer may be out of date by the time it is
+		returned if other threads are using the deque.
+		@return True if the deque was empty, false otherwise */
+		bool isEmpty() const
+		{
+			return m_iBottom.load(std::memory_order_seq_cst) <=
+				m_iTop.load(std::memory_order_seq_cst);
+		}
+
+		/**
+		Retrieves the most items the deque may hold.
+		@return The capacity */
+		size_t getCapacity() const
+		{
+			return m_uiMask + 1;
+		}
+
+	protected:
+
+	private:
+		std::atomic<std::int64_t> m_iTop;
+		std::atomic<std::int64_t> m_iBottom;
+		std::unique_ptr<std::atomic<T>[]> m_pItems;
+		size_t m_uiMask;
+};
+
+#endif
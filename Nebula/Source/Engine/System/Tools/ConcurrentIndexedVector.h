@@ -0,0 +1,466 @@
+/**
+A concurrent indexed vector is an indexed vector that can be pushed to, removed from and searched
+by multiple threads at once without any external locking.
+
+- Slots are acquired lock-free. Released slots are kept on an atomic free list whose head stores
+  a packed id. Because every slot is re-versioned between leaving and rejoining the free list, the
+  version number doubles as the ABA tag.
+- Ids are validated wait-free. An entries version number and active flag live in a single atomic
+  word, so find is one atomic load and one comparison.
+- Storage is paged. The page table is sized once at construction and pages are installed with a
+  single compare-and-swap, so growth never moves an element.
+- Reclamation is deferred. A removed slot keeps its element until collect is called, so a pointer
+  returned by find stays readable until then even if another thread removes the element.
+
+collect must only be called when no thread holds a pointer returned by find. The end of a
+scheduler frame is the intended call site. Concurrent access to the same element is not
+synchronised by the container.
+
+Only packed id types of at most 64 bits are supported (see IndexedId.h). The largest index of the
+id type is reserved as a list terminator.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef CONCURRENT_INDEXED_VECTOR_H
+#define CONCURRENT_INDEXED_VECTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "Engine/System/Tools/IndexedId.h"
+
+template <typename ElementType>
+struct ConcurrentIndexedVectorEntry
+{
+	/**
+	The version number shifted left by one, combined with an active flag in the lowest bit. */
+	std::atomic<std::uint64_t> uiState;
+
+	/**
+	The index of the next entry in the free or pending list this entry belongs to. */
+	std::atomic<size_t> uiNextIndex;
+
+	/**
+	The stored element. */
+	ElementType element;
+
+	ConcurrentIndexedVectorEntry() :
+		uiState(0),
+		uiNextIndex(0),
+		element(ElementType())
+	{
+	}
+};
+
+template <typename ElementType, size_t uiPageSize = 1024, typename IdType = IndexedId64>
+class ConcurrentIndexedVector
+{
+	private:
+		typedef ConcurrentIndexedVectorEntry<ElementType> Entry;
+		typedef IndexedIdVersioning<IdType> Versioning;
+		typedef typename IdType::VersionType VersionType;
+		typedef decltype(IdType::uiValue) StorageType;
+
+	public:
+		typedef IdType Id;
+
+		static_assert(uiPageSize > 0 && (uiPageSize & (uiPageSize - 1)) == 0,
+			"ConcurrentIndexedVector template parameter 'uiPageSize' must be a power of two.");
+		static_assert(sizeof(IdType) <= sizeof(std::uint64_t) && sizeof(VersionType) < 8,
+			"ConcurrentIndexedVector requires a packed id type of at most 64 bits.");
+		static_assert(!std::is_const<ElementType>::value, "ConcurrentIndexedVector does not "
+			"support const element types.");
+		static_assert(std::is_default_constructible<ElementType>::value, "ConcurrentIndexedVector "
+			"template parameter 'ElementType' must be default constructible.");
+		static_assert(std::is_copy_assignable<ElementType>::value, "ConcurrentIndexedVector "
+			"requires elements to be copy assignable");
+
+		/**
+		Constructs a concurrent indexed vector that can hold up to the given number of elements.
+		Only the page table is allocated up front. The limit is clamped to the number of indices
+		addressable by the id type.
+		@param uiMaxElements The maximum number of elements */
+		explicit ConcurrentIndexedVector(size_t uiMaxElements = 1 << 20) :
+			m_uiMaxElements(clampMaxElements(uiMaxElements)),
+			m_uiNumPages((m_uiMaxElements + uiPageSize - 1) / uiPageSize),
+			m_uiFreeHead(nullHead()),
+			m_uiPendingHead(uiNullIndex),
+			m_uiNextUnusedIndex(0),
+			m_iNumElements(0)
+		{
+			m_pPages = new std::atomic<Entry*>[m_uiNumPages];
+			for (size_t i = 0; i < m_uiNumPages; ++i)
+			{
+				m_pPages[i].store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		Destructor. */
+		~ConcurrentIndexedVector()
+		{
+			for (size_t i = 0; i < m_uiNumPages; ++i)
+			{
+				delete[] m_pPages[i].load(std::memory_order_relaxed);
+			}
+
+			delete[] m_pPages;
+		}
+
+		/**
+		Pushes an element on to the vector. Thread safe and lock-free. If the vector was full, the
+		element is not appended and a default id is returned instead.
+		@param element The element to insert
+		@return The elements id, or a default id */
+		Id push(const ElementType& element)
+		{
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
+			{
+				return Id();
+			}
+
+			Entry& entry = entryAt(uiIndex);
+			entry.element = element;
+			return activate(entry, uiIndex);
+		}
+
+		/**
+		Pushes an element on to the vector. Thread safe and lock-free. If the vector was full, the
+		element is not appended and a default id is returned instead.
+		@param element The element to insert
+		@return The elements id, or a default id */
+		Id push(ElementType&& element)
+		{
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
+			{
+				return Id();
+			}
+
+			Entry& entry = entryAt(uiIndex);
+			entry.element = std::move(element);
+			return activate(entry, uiIndex);
+		}
+
+		/**
+		Removes an element with the given id. Thread safe and lock-free. If no such element
+		existed, the container is not modified. The element itself is not destroyed and its slot is
+		not reused until the next call to collect.
+		@param id The id of the element to remove */
+		void remove(const Id& id)
+		{
+			Entry* pEntry = findEntry(id.getIndex());
+			if (pEntry == nullptr)
+			{
+				return;
+			}
+
+			VersionType uiVersion = id.getVersion();
+			std::uint64_t uiExpected = activeState(uiVersion);
+			Versioning::advance(uiVersion);
+			if (pEntry->uiState.compare_exchange_strong(uiExpected, inactiveState(uiVersion),
+				std::memory_order_acq_rel, std::memory_order_relaxed))
+			{
+				m_iNumElements.fetch_sub(1, std::memory_order_relaxed);
+				pushPending(id.getIndex());
+			}
+		}
+
+		/**
+		Returns a pointer to the element with the given id. Thread safe and wait-free. The pointer
+		remains valid until the next call to collect.
+		@param id An id
+		@return A pointer to the element, or a nullptr if no such element existed */
+		ElementType* find(const Id& id) const
+		{
+			Entry* pEntry = findEntry(id.getIndex());
+			if (pEntry != nullptr &&
+				pEntry->uiState.load(std::memory_order_acquire) == activeState(id.getVersion()))
+			{
+				return &pEntry->element;
+			}
+
+			return nullptr;
+		}
+
+		/**
+		Queries whether an element with the given id exists. Thread safe and wait-free.
+		@param id An id
+		@return True if the element existed, false if it did not */
+		bool contains(const Id& id) const
+		{
+			return find(id) != nullptr;
+		}
+
+		/**
+		Destroys the elements of every slot removed since the previous call and makes their slots
+		available to push again. Slots whose version numbers have been exhausted are retired
+		instead if the id types overflow policy requires it. Must not be called while any thread
+		holds a pointer returned by find. May run concurrently with push and remove.
+		@return The number of slots reclaimed */
+		size_t collect()
+		{
+			size_t uiReclaimed = 0;
+			size_t uiIndex = m_uiPendingHead.exchange(uiNullIndex, std::memory_order_acquire);
+			while (uiIndex != uiNullIndex)
+			{
+				Entry& entry = entryAt(uiIndex);
+				const size_t uiNext = entry.uiNextIndex.load(std::memory_order_relaxed);
+
+				entry.element = ElementType();
+				if (Versioning::isUsable(versionOf(entry)))
+				{
+					pushFree(uiIndex, entry);
+				}
+
+				++uiReclaimed;
+				uiIndex = uiNext;
+			}
+
+			return uiReclaimed;
+		}
+
+		/**
+		Allocates the pages required to hold at least the given number of elements. Thread safe.
+		@param uiCapacity The desired capacity */
+		void reserve(size_t uiCapacity)
+		{
+			if (uiCapacity > m_uiMaxElements)
+			{
+				uiCapacity = m_uiMaxElements;
+			}
+
+			for (size_t uiPage = 0; uiPage * uiPageSize < uiCapacity; ++uiPage)
+			{
+				ensurePage(uiPage);
+			}
+		}
+
+		/**
+		Retrieves the current number of elements. The value may be stale by the time it is used if
+		other threads are modifying the vector.
+		@return The current number of elements */
+		size_t size() const
+		{
+			const std::int64_t iNumElements = m_iNumElements.load(std::memory_order_relaxed);
+			return iNumElements > 0 ? (size_t)iNumElements : 0;
+		}
+
+		/**
+		Retrieves the maximum number of elements the vector can hold.
+		@return The maximum number of elements */
+		size_t maxSize() const
+		{
+			return m_uiMaxElements;
+		}
+
+		/**
+		Queries whether the vector is empty. The value may be stale by the time it is used if other
+		threads are modifying the vector.
+		@return True if the vector is empty, false if it is not */
+		bool isEmpty() const
+		{
+			return size() == 0;
+		}
+
+	protected:
+
+	private:
+		static const size_t uiNullIndex = IdType::uiMaxIndex;
+
+		std::atomic<Entry*>* m_pPages;
+		const size_t m_uiMaxElements;
+		const size_t m_uiNumPages;
+		std::atomic<StorageType> m_uiFreeHead;
+		std::atomic<size_t> m_uiPendingHead;
+		std::atomic<size_t> m_uiNextUnusedIndex;
+		std::atomic<std::int64_t> m_iNumElements;
+
+		/**
+		Forbidden. Concurrent vectors are shared by address. */
+		ConcurrentIndexedVector(const ConcurrentIndexedVector& other);
+
+		/**
+		Forbidden. Concurrent vectors are shared by address. */
+		ConcurrentIndexedVector& operator=(const ConcurrentIndexedVector& other);
+
+		static size_t clampMaxElements(size_t uiMaxElements)
+		{
+			const size_t uiLimit = uiNullIndex;
+			return uiMaxElements < uiLimit ? uiMaxElements : uiLimit;
+		}
+
+		static StorageType nullHead()
+		{
+			return Id(uiNullIndex, 0).uiValue;
+		}
+
+		static std::uint64_t activeState(VersionType uiVersion)
+		{
+			return ((std::uint64_t)uiVersion << 1) | 1;
+		}
+
+		static std::uint64_t inactiveState(VersionType uiVersion)
+		{
+			return (std::uint64_t)uiVersion << 1;
+		}
+
+		static VersionType versionOf(const Entry& entry)
+		{
+			return (VersionType)(entry.uiState.load(std::memory_order_acquire) >> 1);
+		}
+
+		/**
+		Retrieves the entry at an index whose page is known to exist.
+		@param uiIndex The index
+		@return The entry */
+		Entry& entryAt(size_t uiIndex) const
+		{
+			return m_pPages[uiIndex / uiPageSize].load(std::memory_order_acquire)[uiIndex % uiPageSize];
+		}
+
+		/**
+		Retrieves the entry at an index if its page exists.
+		@param uiIndex The index
+		@return The entry, or a nullptr if the index is out of range or its page does not exist */
+		Entry* findEntry(size_t uiIndex) const
+		{
+			if (uiIndex >= m_uiMaxElements)
+			{
+				return nullptr;
+			}
+
+			Entry* pPage = m_pPages[uiIndex / uiPageSize].load(std::memory_order_acquire);
+			return pPage != nullptr ? &pPage[uiIndex % uiPageSize] : nullptr;
+		}
+
+		/**
+		Marks an exclusively owned entry as active and publishes its element to other threads.
+		@param entry The entry
+		@param uiIndex The index of the entry
+		@return The id of the element */
+		Id activate(Entry& entry, size_t uiIndex)
+		{
+			VersionType uiVersion = versionOf(entry);
+			Versioning::advance(uiVersion);
+			entry.uiState.store(activeState(uiVersion), std::memory_order_release);
+			m_iNumElements.fetch_add(1, std::memory_order_relaxed);
+
+			return Id(uiIndex, uiVersion);
+		}
+
+		/**
+		Acquires exclusive ownership of an inactive slot. Recycled slots are preferred.
+		@param uiIndex Receives the index
+		@return True if a slot was acquired, false if the vector was full */
+		bool acquireIndex(size_t& uiIndex)
+		{
+			if (popFree(uiIndex))
+			{
+				return true;
+			}
+
+			size_t uiNext = m_uiNextUnusedIndex.load(std::memory_order_relaxed);
+			do
+			{
+				if (uiNext >= m_uiMaxElements)
+				{
+					return false;
+				}
+			}
+			while (!m_uiNextUnusedIndex.compare_exchange_weak(uiNext, uiNext + 1,
+				std::memory_order_relaxed));
+
+			uiIndex = uiNext;
+			ensurePage(uiIndex / uiPageSize);
+			return true;
+		}
+
+		/**
+		Installs the given page if no other thread has done so already.
+		@param uiPage The page index */
+		void ensurePage(size_t uiPage)
+		{
+			if (m_pPages[uiPage].load(std::memory_order_acquire) != nullptr)
+			{
+				return;
+			}
+
+			Entry* pExpected = nullptr;
+			Entry* pPage = new Entry[uiPageSize];
+			if (!m_pPages[uiPage].compare_exchange_strong(pExpected, pPage,
+				std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				delete[] pPage;
+			}
+		}
+
+		/**
+		Pops a slot from the free list. The head carries the version the top slot had when it was
+		pushed, so a head that was popped and pushed again in the meantime fails the exchange.
+		@param uiIndex Receives the index
+		@return True if a slot was popped, false if the free list was empty */
+		bool popFree(size_t& uiIndex)
+		{
+			StorageType uiHead = m_uiFreeHead.load(std::memory_order_acquire);
+			for (;;)
+			{
+				const size_t uiTop = Id::fromPackedValue(uiHead).getIndex();
+				if (uiTop == uiNullIndex)
+				{
+					return false;
+				}
+
+				const size_t uiNext = entryAt(uiTop).uiNextIndex.load(std::memory_order_relaxed);
+				const StorageType uiNewHead = uiNext == uiNullIndex ?
+					nullHead() : Id(uiNext, versionOf(entryAt(uiNext))).uiValue;
+
+				if (m_uiFreeHead.compare_exchange_weak(uiHead, uiNewHead,
+					std::memory_order_acq_rel, std::memory_order_acquire))
+				{
+					uiIndex = uiTop;
+					return true;
+				}
+			}
+		}
+
+		/**
+		Pushes a slot on to the free list.
+		@param uiIndex The index of the slot
+		@param entry The entry at the index */
+		void pushFree(size_t uiIndex, Entry& entry)
+		{
+			const StorageType uiNewHead = Id(uiIndex, versionOf(entry)).uiValue;
+			StorageType uiHead = m_uiFreeHead.load(std::memory_order_relaxed);
+			do
+			{
+				entry.uiNextIndex.store(Id::fromPackedValue(uiHead).getIndex(),
+					std::memory_order_relaxed);
+			}
+			while (!m_uiFreeHead.compare_exchange_weak(uiHead, uiNewHead,
+				std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		/**
+		Pushes a removed slot on to the pending list. The pending list is only ever emptied as a
+		whole, so it needs no ABA protection.
+		@param uiIndex The index of the slot */
+		void pushPending(size_t uiIndex)
+		{
+			Entry& entry = entryAt(uiIndex);
+			size_t uiHead = m_uiPendingHead.load(std::memory_order_relaxed);
+			do
+			{
+				entry.uiNextIndex.store(uiHead, std::memory_order_relaxed);
+			}
+			while (!m_uiPendingHead.compare_exchange_weak(uiHead, uiIndex,
+				std::memory_order_release, std::memory_order_relaxed));
+		}
+};
+
+#endif
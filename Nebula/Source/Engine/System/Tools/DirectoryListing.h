@@ -8,7 +8,12 @@ Some example mappings could be (depending on key type):
 "textures_sub_dir", "textures/"
 1, "./data/"
 
-@date edited 26/03/2017
+Mappings are either kept ordered, or in an open addressing hash table which avoids the string
+comparisons of a tree walk. Once the set of keys is final the listing can be frozen, which builds a
+minimal perfect hash over the keys. A frozen lookup hashes the key once, reads a single
+displacement and compares against a single entry.
+
+@date edited 18/10/2026
 @date authored 24/11/2016
 
 @author Nathan Sainsbury */
@@ -16,16 +21,21 @@ Some example mappings could be (depending on key type):
 #ifndef DIRECTORY_LISTING_H
 #define DIRECTORY_LISTING_H
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 struct DirectoryListingSearchResult
 {
 	/**
 	True if the search successfully found its target directory. */
 	bool bFound; 
-	
+
 	/**
 	The directory. Addresses the default directory if the search failed to find the target
 	directory. */
@@ -45,7 +55,7 @@ struct DirectoryListingSearchResult
 	}
 };
 
-template <typename KeyType = std::string>
+template <typename KeyType = std::string, typename Hash = std::hash<KeyType>>
 class DirectoryListing
 {
 	private:
@@ -66,39 +76,68 @@ class DirectoryListing
 
 			/**
 			The operation failed because the given directory was illegal. */
-			FAIL_ILLEGAL_DIRECTORY
+			FAIL_ILLEGAL_DIRECTORY,
+
+			/**
+			The operation failed because the listing is frozen. */
+			FAIL_FROZEN
+		};
+
+		enum class Modes
+		{
+			/**
+			Mappings are kept ordered by key. */
+			ORDERED,
+
+			/**
+			Mappings are kept in an open addressing hash table. */
+			HASHED
 		};
 
 		/**
-		Constructs a directory listing with no additional illegal keys or directories. */
-		DirectoryListing() :
-			m_sDefaultDirectory("./default/")
+		Constructs a directory listing with no additional illegal keys or directories.
+		@param mode The way mappings are stored while the listing is not frozen */
+		DirectoryListing(Modes mode = Modes::ORDERED) :
+			m_sDefaultDirectory("./default/"),
+			m_mode(mode),
+			m_uiNumHashedEntries(0),
+			m_bFrozen(false),
+			m_uiFrozenSeed(0)
 		{
 			m_illegalDirectories.insert("./default/");
 		}
-		
+
 		/**
 		Constructs a directory listing with the given illegal keys and directories.
 		@param illegalKeys The keys to disallow
-		@param illegalDirectories The directories to disallow */
-		DirectoryListing(const std::set<KeyType>& illegalKeys, 
-			const std::set<std::string&> illegalDirectories) :
+		@param illegalDirectories The directories to disallow
+		@param mode The way mappings are stored while the listing is not frozen */
+		DirectoryListing(const std::set<KeyType>& illegalKeys,
+			const std::set<std::string>& illegalDirectories, Modes mode = Modes::ORDERED) :
 			m_sDefaultDirectory("./default/"),
 			m_illegalKeys(illegalKeys),
-			m_illegalDirectories(illegalDirectories)
+			m_illegalDirectories(illegalDirectories),
+			m_mode(mode),
+			m_uiNumHashedEntries(0),
+			m_bFrozen(false),
+			m_uiFrozenSeed(0)
 		{
 			m_illegalDirectories.insert("./default/");
 		}
 
 		/**
 		Adds a directory to the listing. Overwrites if the key was already in use. Both the key and 
-		directory must be legal values as defined by the illegal keys and directories given in the 
-		directory listing constructor.
+		directory must be legal values as defined by the illegal keys and directories given in the
+		directory listing constructor. Fails if the listing is frozen.
 		@param key The key
 		@param sDirectory The directory
 		@return A code indicating the result of the operation */
 		OpResults add(const KeyType& key, const std::string& sDirectory)
 		{
+			if (m_bFrozen)
+			{
+				return OpResults::FAIL_FROZEN;
+			}
 			if (isIllegalKey(key))
 			{
 				return OpResults::FAIL_ILLEGAL_KEY;
@@ -108,25 +147,55 @@ class DirectoryListing
 				return OpResults::FAIL_ILLEGAL_DIRECTORY;
 			}
 
-			m_mappings[key] = sDirectory;
+			if (m_mode == Modes::HASHED)
+			{
+				hashedAdd(key, sDirectory);
+			}
+			else
+			{
+				m_mappings[key] = sDirectory;
+			}
+
 			return OpResults::SUCCESS;
 		}
 
 		/**
-		Removes a directory from the listing.
+		Removes a directory from the listing. Does nothing if the listing is frozen.
 		@param key The key */
-		void remove(const KeyType& key) 
+		void remove(const KeyType& key)
 		{
-			m_mappings.erase(key);
+			if (m_bFrozen)
+			{
+				return;
+			}
+
+			if (m_mode == Modes::HASHED)
+			{
+				hashedRemove(key);
+			}
+			else
+			{
+				m_mappings.erase(key);
+			}
 		}
 
 		/**
 		Searches for and returns the directory mapped to the given key. If no such directory 
-		existed the default directory is returned instead.
+		existed the default directory is returned instead. In hashed mode the directory in the
+		result is invalidated by the next add or remove.
 		@param key The key 
 		@return The result of the search */
 		SearchResult find(const KeyType& key) const
 		{
+			if (m_bFrozen)
+			{
+				return frozenFind(key);
+			}
+			else if (m_mode == Modes::HASHED)
+			{
+				return hashedFind(key);
+			}
+
 			ConstIter it = m_mappings.find(key);
 			if (it != m_mappings.cend())
 			{
@@ -139,19 +208,193 @@ class DirectoryListing
 		}
 
 		/**
-		Clears all entries. */
+		Clears all entries. Thaws the listing if it was frozen. */
 		void clear()
 		{
 			m_mappings.clear();
+			m_hashedEntries.clear();
+			m_uiNumHashedEntries = 0;
+			m_displacements.clear();
+			m_frozenEntries.clear();
+			m_bFrozen = false;
+		}
+
+		/**
+		Freezes the listing by building a minimal perfect hash over its keys. While frozen, adds
+		fail and removes are ignored. Freezing an already frozen listing does nothing.
+		@return True if the listing is frozen, false if no perfect hash could be built over the
+		keys, in which case the listing is left unfrozen */
+		bool freeze()
+		{
+			if (m_bFrozen)
+			{
+				return true;
+			}
+
+			std::vector<FrozenEntry> entries;
+			if (m_mode == Modes::HASHED)
+			{
+				entries.reserve(m_uiNumHashedEntries);
+				for (HashedEntry& entry : m_hashedEntries)
+				{
+					if (entry.bIsOccupied)
+					{
+						entries.emplace_back(entry.uiHash, std::move(entry.key),
+							std::move(entry.sDirectory));
+					}
+				}
+			}
+			else
+			{
+				entries.reserve(m_mappings.size());
+				for (const std::pair<const KeyType, std::string>& mapping : m_mappings)
+				{
+					entries.emplace_back(hashKey(mapping.first), mapping.first, mapping.second);
+				}
+			}
+
+			for (std::uint64_t uiAttempt = 0; uiAttempt < uiMaxFreezeAttempts; ++uiAttempt)
+			{
+				if (buildPerfectHash(entries, mixHash(uiAttempt + 1)))
+				{
+					m_mappings.clear();
+					m_hashedEntries.clear();
+					m_uiNumHashedEntries = 0;
+					m_bFrozen = true;
+					return true;
+				}
+			}
+
+			// Hashed entries were moved out, so put them back
+			if (m_mode == Modes::HASHED)
+			{
+				m_hashedEntries.clear();
+				m_uiNumHashedEntries = 0;
+				for (FrozenEntry& entry : entries)
+				{
+					hashedAdd(entry.key, entry.sDirectory);
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		Thaws a frozen listing, allowing it to be modified again. Does nothing if the listing is
+		not frozen. */
+		void thaw()
+		{
+			if (!m_bFrozen)
+			{
+				return;
+			}
+
+			for (FrozenEntry& entry : m_frozenEntries)
+			{
+				if (m_mode == Modes::HASHED)
+				{
+					hashedAdd(entry.key, entry.sDirectory);
+				}
+				else
+				{
+					m_mappings[entry.key] = std::move(entry.sDirectory);
+				}
+			}
+
+			m_displacements.clear();
+			m_frozenEntries.clear();
+			m_bFrozen = false;
+		}
+
+		/**
+		Queries whether the listing is frozen.
+		@return True if the listing is frozen, false if it is not */
+		bool isFrozen() const
+		{
+			return m_bFrozen;
+		}
+
+		/**
+		Gets the way mappings are stored while the listing is not frozen.
+		@return The mode */
+		Modes getMode() const
+		{
+			return m_mode;
 		}
 
 	protected:
 
 	private:
+		struct HashedEntry
+		{
+			std::uint64_t uiHash;
+			bool bIsOccupied;
+			KeyType key;
+			std::string sDirectory;
+
+			HashedEntry() :
+				uiHash(0),
+				bIsOccupied(false),
+				key(),
+				sDirectory()
+			{
+			}
+		};
+
+		struct FrozenEntry
+		{
+			std::uint64_t uiHash;
+			KeyType key;
+			std::string sDirectory;
+
+			FrozenEntry() :
+				uiHash(0),
+				key(),
+				sDirectory()
+			{
+			}
+
+			FrozenEntry(std::uint64_t uiHash, KeyType key, std::string sDirectory) :
+				uiHash(uiHash),
+				key(std::move(key)),
+				sDirectory(std::move(sDirectory))
+			{
+			}
+		};
+
+		/**
+		The average number of keys per displacement when building the perfect hash. Larger values
+		shrink the displacement table but make the hash slower to build. */
+		static const size_t uiKeysPerDisplacement = 4;
+
+		/**
+		The number of displacements tried for a single bucket before the build is restarted. */
+		static const std::uint32_t uiMaxDisplacementAttempts = 1 << 20;
+
+		/**
+		The number of seeds tried before freezing gives up. */
+		static const std::uint64_t uiMaxFreezeAttempts = 8;
+
 		std::string m_sDefaultDirectory;
 		std::map<KeyType, std::string> m_mappings;
 		std::set<KeyType> m_illegalKeys;
 		std::set<std::string> m_illegalDirectories;
+		Modes m_mode;
+		Hash m_hash;
+
+		/**
+		The open addressing table used in hashed mode. The capacity is always zero or a power of
+		two, and is kept at least double the number of entries so probe sequences stay short. */
+		std::vector<HashedEntry> m_hashedEntries;
+		size_t m_uiNumHashedEntries;
+
+		/**
+		The perfect hash used while frozen. Each key is first hashed to a displacement, which is
+		then combined with the key's hash to find the key's entry. */
+		bool m_bFrozen;
+		std::uint64_t m_uiFrozenSeed;
+		std::vector<std::uint32_t> m_displacements;
+		std::vector<FrozenEntry> m_frozenEntries;
 
 		/**
 		Queries whether a key is illegal.
@@ -170,6 +413,322 @@ class DirectoryListing
 		{
 			return m_illegalDirectories.find(sDirectory) != m_illegalDirectories.cend();
 		}
+
+		/**
+		Scrambles the bits of a value so that every input bit affects every output bit. The
+		finalizer of SplitMix64.
+		@param uiValue The value
+		@return The scrambled value */
+		static std::uint64_t mixHash(std::uint64_t uiValue)
+		{
+			uiValue = (uiValue ^ (uiValue >> 30)) * 0xBF58476D1CE4E5B9ull;
+			uiValue = (uiValue ^ (uiValue >> 27)) * 0x94D049BB133111EBull;
+			return uiValue ^ (uiValue >> 31);
+		}
+
+		/**
+		Maps a 32 bit value on to the range [0, uiRange) without a division.
+		@param uiValue The value
+		@param uiRange The size of the range
+		@return The value in range */
+		static size_t reduce(std::uint32_t uiValue, size_t uiRange)
+		{
+			return (size_t)(((std::uint64_t)uiValue * (std::uint64_t)uiRange) >> 32);
+		}
+
+		/**
+		Hashes a key. The result is mixed so that weak hashes, such as the identity hash most
+		standard libraries use for integers, are usable by the tables.
+		@param key The key
+		@return The hash */
+		std::uint64_t hashKey(const KeyType& key) const
+		{
+			return mixHash((std::uint64_t)m_hash(key));
+		}
+
+		/**
+		Finds the displacement slot for a key in the perfect hash.
+		@param uiFrozenHash The key's hash combined with the frozen seed
+		@param uiNumDisplacements The number of displacements
+		@return The index of the displacement */
+		static size_t frozenBucket(std::uint64_t uiFrozenHash, size_t uiNumDisplacements)
+		{
+			return reduce((std::uint32_t)(uiFrozenHash >> 32), uiNumDisplacements);
+		}
+
+		/**
+		Finds the entry for a key in the perfect hash.
+		@param uiFrozenHash The key's hash combined with the frozen seed
+		@param uiDisplacement The displacement of the key's bucket
+		@param uiNumEntries The number of entries
+		@return The index of the entry */
+		static size_t frozenSlot(std::uint64_t uiFrozenHash, std::uint32_t uiDisplacement,
+			size_t uiNumEntries)
+		{
+			return reduce((std::uint32_t)mixHash(uiFrozenHash + uiDisplacement), uiNumEntries);
+		}
+
+		/**
+		Searches the perfect hash for a key.
+		@param key The key
+		@return The result of the search */
+		SearchResult frozenFind(const KeyType& key) const
+		{
+			if (m_frozenEntries.empty())
+			{
+				return SearchResult(false, m_sDefaultDirectory);
+			}
+
+			const std::uint64_t uiHash = hashKey(key);
+			const std::uint64_t uiFrozenHash = mixHash(uiHash ^ m_uiFrozenSeed);
+			const std::uint32_t uiDisplacement =
+				m_displacements[frozenBucket(uiFrozenHash, m_displacements.size())];
+			const FrozenEntry& entry =
+				m_frozenEntries[frozenSlot(uiFrozenHash, uiDisplacement, m_frozenEntries.size())];
+
+			if (entry.uiHash == uiHash && entry.key == key)
+			{
+				return SearchResult(true, entry.sDirectory);
+			}
+			else
+			{
+				return SearchResult(false, m_sDefaultDirectory);
+			}
+		}
+
+		/**
+		Attempts to build a minimal perfect hash over the given entries using hash and displace.
+		Keys are grouped in to buckets by their hash, then the largest buckets are placed first,
+		each by searching for a displacement that sends all of its keys to free entries. On success
+		the entries are moved in to the frozen table.
+		@param entries The entries to build the hash over
+		@param uiSeed The seed combined with each key's hash
+		@return True if the hash was built, false if a bucket could not be placed */
+		bool buildPerfectHash(std::vector<FrozenEntry>& entries, std::uint64_t uiSeed)
+		{
+			const size_t uiNumEntries = entries.size();
+			const size_t uiNumDisplacements =
+				std::max<size_t>(1, (uiNumEntries + uiKeysPerDisplacement - 1) /
+				uiKeysPerDisplacement);
+
+			std::vector<std::vector<size_t>> buckets(uiNumDisplacements);
+			for (size_t i = 0; i < uiNumEntries; ++i)
+			{
+				const std::uint64_t uiFrozenHash = mixHash(entries[i].uiHash ^ uiSeed);
+				buckets[frozenBucket(uiFrozenHash, uiNumDisplacements)].push_back(i);
+			}
+
+			std::vector<size_t> order(uiNumDisplacements);
+			for (size_t i = 0; i < uiNumDisplacements; ++i)
+			{
+				order[i] = i;
+			}
+
+			std::stable_sort(order.begin(), order.end(), [&buckets](size_t uiA, size_t uiB)
+			{
+				return buckets[uiA].size() > buckets[uiB].size();
+			});
+
+			std::vector<std::uint32_t> displacements(uiNumDisplacements, 0);
+			std::vector<bool> used(uiNumEntries, false);
+			std::vector<size_t> slots;
+
+			for (size_t uiBucket : order)
+			{
+				const std::vector<size_t>& bucket = buckets[uiBucket];
+				if (bucket.empty())
+				{
+					break;
+				}
+
+				bool bPlaced = false;
+				for (std::uint32_t uiDisplacement = 0;
+					uiDisplacement < uiMaxDisplacementAttempts && !bPlaced; ++uiDisplacement)
+				{
+					slots.clear();
+					bPlaced = true;
+					for (size_t uiEntry : bucket)
+					{
+						const std::uint64_t uiFrozenHash =
+							mixHash(entries[uiEntry].uiHash ^ uiSeed);
+						const size_t uiSlot =
+							frozenSlot(uiFrozenHash, uiDisplacement, uiNumEntries);
+						if (used[uiSlot] ||
+							std::find(slots.begin(), slots.end(), uiSlot) != slots.end())
+						{
+							bPlaced = false;
+							break;
+						}
+
+						slots.push_back(uiSlot);
+					}
+
+					if (bPlaced)
+					{
+						displacements[uiBucket] = uiDisplacement;
+						for (size_t uiSlot : slots)
+						{
+							used[uiSlot] = true;
+						}
+					}
+				}
+
+				if (!bPlaced)
+				{
+					return false;
+				}
+			}
+
+			m_frozenEntries.clear();
+			m_frozenEntries.resize(uiNumEntries);
+			for (FrozenEntry& entry : entries)
+			{
+				const std::uint64_t uiFrozenHash = mixHash(entry.uiHash ^ uiSeed);
+				const std::uint32_t uiDisplacement =
+					displacements[frozenBucket(uiFrozenHash, uiNumDisplacements)];
+				m_frozenEntries[frozenSlot(uiFrozenHash, uiDisplacement, uiNumEntries)] =
+					std::move(entry);
+			}
+
+			m_displacements.swap(displacements);
+			m_uiFrozenSeed = uiSeed;
+			return true;
+		}
+
+		/**
+		Searches the open addressing table for a key.
+		@param key The key
+		@return The result of the search */
+		SearchResult hashedFind(const KeyType& key) const
+		{
+			size_t uiIndex;
+			if (findHashedIndex(key, hashKey(key), uiIndex))
+			{
+				return SearchResult(true, m_hashedEntries[uiIndex].sDirectory);
+			}
+			else
+			{
+				return SearchResult(false, m_sDefaultDirectory);
+			}
+		}
+
+		/**
+		Finds the index of a key in the open addressing table.
+		@param key The key
+		@param uiHash The key's hash
+		@param uiIndex Set to the key's index if it was found, otherwise to the free index at the
+		end of its probe sequence. Set to 0 if the table has no capacity
+		@return True if the key was found, false if it was not */
+		bool findHashedIndex(const KeyType& key, std::uint64_t uiHash, size_t& uiIndex) const
+		{
+			if (m_hashedEntries.empty())
+			{
+				uiIndex = 0;
+				return false;
+			}
+
+			const size_t uiMask = m_hashedEntries.size() - 1;
+			size_t i = (size_t)uiHash & uiMask;
+			while (m_hashedEntries[i].bIsOccupied)
+			{
+				if (m_hashedEntries[i].uiHash == uiHash && m_hashedEntries[i].key == key)
+				{
+					uiIndex = i;
+					return true;
+				}
+
+				i = (i + 1) & uiMask;
+			}
+
+			uiIndex = i;
+			return false;
+		}
+
+		/**
+		Adds or overwrites a mapping in the open addressing table, growing the table if needed.
+		@param key The key
+		@param sDirectory The directory */
+		void hashedAdd(const KeyType& key, const std::string& sDirectory)
+		{
+			if ((m_uiNumHashedEntries + 1) * 2 > m_hashedEntries.size())
+			{
+				rehash(std::max<size_t>(8, m_hashedEntries.size() * 2));
+			}
+
+			const std::uint64_t uiHash = hashKey(key);
+			size_t uiIndex = 0;
+			if (!findHashedIndex(key, uiHash, uiIndex))
+			{
+				HashedEntry& entry = m_hashedEntries[uiIndex];
+				entry.uiHash = uiHash;
+				entry.bIsOccupied = true;
+				entry.key = key;
+				++m_uiNumHashedEntries;
+			}
+
+			m_hashedEntries[uiIndex].sDirectory = sDirectory;
+		}
+
+		/**
+		Removes a mapping from the open addressing table. Rather than leaving a tombstone, the
+		entries after it in the probe sequence are shifted back to close the gap.
+		@param key The key */
+		void hashedRemove(const KeyType& key)
+		{
+			size_t uiHole;
+			if (!findHashedIndex(key, hashKey(key), uiHole))
+			{
+				return;
+			}
+
+			const size_t uiMask = m_hashedEntries.size() - 1;
+			size_t i = uiHole;
+			while (true)
+			{
+				i = (i + 1) & uiMask;
+				if (!m_hashedEntries[i].bIsOccupied)
+				{
+					break;
+				}
+
+				// Entries whose home lies cyclically within (hole, i] must stay where they are
+				const size_t uiHome = (size_t)m_hashedEntries[i].uiHash & uiMask;
+				const bool bStays = uiHole <= i ? (uiHole < uiHome && uiHome <= i) :
+					(uiHole < uiHome || uiHome <= i);
+				if (!bStays)
+				{
+					m_hashedEntries[uiHole] = std::move(m_hashedEntries[i]);
+					uiHole = i;
+				}
+			}
+
+			m_hashedEntries[uiHole] = HashedEntry();
+			--m_uiNumHashedEntries;
+		}
+
+		/**
+		Resizes the open addressing table, reinserting every entry.
+		@param uiCapacity The new capacity. Must be a power of two */
+		void rehash(size_t uiCapacity)
+		{
+			std::vector<HashedEntry> oldEntries(uiCapacity);
+			oldEntries.swap(m_hashedEntries);
+
+			const size_t uiMask = uiCapacity - 1;
+			for (HashedEntry& entry : oldEntries)
+			{
+				if (entry.bIsOccupied)
+				{
+					size_t i = (size_t)entry.uiHash & uiMask;
+					while (m_hashedEntries[i].bIsOccupied)
+					{
+						i = (i + 1) & uiMask;
+					}
+
+					m_hashedEntries[i] = std::move(entry);
+				}
+			}
+		}
 };
 
 #endif
\ No newline at end of file
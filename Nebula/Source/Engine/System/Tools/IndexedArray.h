@@ -11,18 +11,45 @@ Ids are composed of the index that the element currently resides at and a unique
 that increments each time the stored object is replaced.
 
 *Note that if the version number overflows, Ids are no longer unique. Users should consider this
-when selecting their container of choice.
+when selecting their container of choice. Alternatively, a packed id type with a retiring overflow
+policy can be supplied as the third template parameter. Packed ids also reduce the size of both
+the ids and the per-entry version numbers. See IndexedId.h.
+
+Storage is obtained from the allocator supplied as the fourth template parameter, which is
+rebound to the internal entry type. See ArenaAllocator.h and PoolAllocator.h. Moves transfer the
+storage without allocating and leave the source without storage until it is next pushed to.
+Supplying IndexedArrayInlineStorage instead of an allocator stores the entries inside the indexed
+array itself, which avoids allocation entirely. Moves then move the elements individually.
+
+Indexed arrays of trivially copyable elements can be written to a snapshot image and can adopt an
+image, preserving every id. Arrays using an allocator adopt the image in place, arrays using
+inline storage copy it. See IndexedSnapshot.h.
 
 @date authored 26/03/2017
-@date edited 14/03/2017
+@date edited 18/10/2026
 
 @author Nathan Sainsbury */
 
 #ifndef INDEXED_ARRAY_H
 #define INDEXED_ARRAY_H
 
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <type_traits>
+
+#include "Engine/System/Tools/IndexedId.h"
+#include "Engine/System/Tools/IndexedSnapshot.h"
+
 struct IndexedArrayId
 {
+	typedef size_t VersionType;
+
+	static const size_t uiMaxIndex = std::numeric_limits<size_t>::max();
+	static const size_t uiMaxVersion = std::numeric_limits<size_t>::max();
+	static const IndexedIdOverflowPolicies overflowPolicy = IndexedIdOverflowPolicies::WRAP;
+
 	/**
 	The index. */
 	size_t uiIndex;
@@ -42,9 +69,35 @@ struct IndexedArrayId
 		uiVersion(uiVersion) 
 	{
 	}
+
+	/**
+	Retrieves the index.
+	@return The index */
+	size_t getIndex() const
+	{
+		return uiIndex;
+	}
+
+	/**
+	Retrieves the version number.
+	@return The version number */
+	size_t getVersion() const
+	{
+		return uiVersion;
+	}
+
+	bool operator==(const IndexedArrayId& other) const
+	{
+		return uiIndex == other.uiIndex && uiVersion == other.uiVersion;
+	}
+
+	bool operator!=(const IndexedArrayId& other) const
+	{
+		return uiIndex != other.uiIndex || uiVersion != other.uiVersion;
+	}
 };
 
-template <typename ElementType>
+template <typename ElementType, typename VersionType = size_t>
 struct IndexedArrayEntry
 {
 	/**
@@ -53,7 +106,7 @@ struct IndexedArrayEntry
 
 	/**
 	The version number. */
-	size_t uiVersionNumber;
+	VersionType uiVersionNumber;
 
 	/**
 	The stored element. */
@@ -66,7 +119,7 @@ struct IndexedArrayEntry
 	{
 	}
 
-	IndexedArrayEntry(bool bIsActive, size_t uiVersionNumber, const ElementType& element) :
+	IndexedArrayEntry(bool bIsActive, VersionType uiVersionNumber, const ElementType& element) :
 		bIsActive(bIsActive), 
 		uiVersionNumber(uiVersionNumber), 
 		element(element)
@@ -74,13 +127,13 @@ struct IndexedArrayEntry
 	}
 };
 
-template <typename ElementType>
+template <typename ElementType, typename IdType = IndexedArrayId>
 class IndexedArrayIterator
 {
 	private:
-		typedef IndexedArrayEntry<ElementType> Entry;
-		typedef IndexedArrayIterator<ElementType> Iterator;
-		typedef IndexedArrayId Id;
+		typedef IndexedArrayEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedArrayIterator<ElementType, IdType> Iterator;
+		typedef IdType Id;
 
 	public:
 		IndexedArrayIterator() :
@@ -184,13 +237,13 @@ class IndexedArrayIterator
 		size_t m_uiMaxIndex;
 };
 
-template <typename ElementType>
+template <typename ElementType, typename IdType = IndexedArrayId>
 class IndexedArrayConstIterator
 {
 	private:
-		typedef IndexedArrayEntry<ElementType> Entry;
-		typedef IndexedArrayConstIterator<ElementType> Iterator;
-		typedef IndexedArrayId Id;
+		typedef IndexedArrayEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedArrayConstIterator<ElementType, IdType> Iterator;
+		typedef IdType Id;
 
 	public:
 		IndexedArrayConstIterator() :
@@ -294,20 +347,279 @@ class IndexedArrayConstIterator
 		size_t m_uiMaxIndex;
 };
 
-template <typename ElementType, size_t m_uiMaxElements>
+/**
+Selects inline storage for an indexed array in place of an allocator. */
+struct IndexedArrayInlineStorage
+{
+};
+
+/**
+Owns the entries of an indexed array. Entries are obtained from an allocator rebound to the
+entry type. Intended for use by IndexedArray only. */
+template <typename Entry, size_t uiCapacity, typename Allocator>
+class IndexedArrayStorage
+{
+	private:
+		typedef IndexedArrayStorage<Entry, uiCapacity, Allocator> Storage;
+		typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>
+			EntryAllocator;
+		typedef std::allocator_traits<EntryAllocator> EntryAllocatorTraits;
+
+	public:
+		explicit IndexedArrayStorage(const Allocator& allocator) :
+			m_pEntries(nullptr),
+			m_allocator(allocator),
+			m_bOwnsEntries(true)
+		{
+			allocate();
+		}
+
+		~IndexedArrayStorage()
+		{
+			release();
+		}
+
+		IndexedArrayStorage(const Storage& other) :
+			m_pEntries(nullptr),
+			m_allocator(EntryAllocatorTraits::select_on_container_copy_construction(
+				other.m_allocator)),
+			m_bOwnsEntries(true)
+		{
+			if (other.m_pEntries != nullptr && allocate())
+			{
+				copyEntries(other);
+			}
+		}
+
+		IndexedArrayStorage(Storage&& other) :
+			m_pEntries(other.m_pEntries),
+			m_allocator(other.m_allocator),
+			m_bOwnsEntries(other.m_bOwnsEntries)
+		{
+			other.m_pEntries = nullptr;
+		}
+
+		Storage& operator=(const Storage& other)
+		{
+			if (this != &other)
+			{
+				// An adopted image is never written to, so it is swapped for owned entries
+				if (other.m_pEntries == nullptr || !m_bOwnsEntries)
+				{
+					release();
+				}
+
+				if (other.m_pEntries != nullptr && allocate())
+				{
+					copyEntries(other);
+				}
+			}
+
+			return *this;
+		}
+
+		Storage& operator=(Storage&& other)
+		{
+			if (this != &other)
+			{
+				release();
+
+				m_pEntries = other.m_pEntries;
+				m_allocator = other.m_allocator;
+				m_bOwnsEntries = other.m_bOwnsEntries;
+
+				other.m_pEntries = nullptr;
+			}
+
+			return *this;
+		}
+
+		void swap(Storage& other)
+		{
+			std::swap(m_pEntries, other.m_pEntries);
+			std::swap(m_allocator, other.m_allocator);
+			std::swap(m_bOwnsEntries, other.m_bOwnsEntries);
+		}
+
+		/**
+		Allocates the entries if they have not been allocated yet.
+		@return True if the entries are allocated, false if the allocator failed */
+		bool allocate()
+		{
+			if (m_pEntries == nullptr)
+			{
+				Entry* pEntries = EntryAllocatorTraits::allocate(m_allocator, uiCapacity);
+				if (pEntries != nullptr)
+				{
+					for (size_t i = 0; i < uiCapacity; ++i)
+					{
+						EntryAllocatorTraits::construct(m_allocator, pEntries + i);
+					}
+				}
+
+				m_pEntries = pEntries;
+				m_bOwnsEntries = true;
+			}
+
+			return m_pEntries != nullptr;
+		}
+
+		/**
+		Uses the given entries in place of allocated ones. The entries are not released.
+		@param pEntries The entries */
+		void adopt(Entry* pEntries)
+		{
+			release();
+
+			m_pEntries = pEntries;
+			m_bOwnsEntries = false;
+		}
+
+		/**
+		Retrieves the entries.
+		@return The entries, or a nullptr if they are not allocated */
+		Entry* data() const
+		{
+			return m_pEntries;
+		}
+
+		/**
+		Queries whether the entries are adopted rather than allocated.
+		@return True if the entries are adopted, false otherwise */
+		bool isAdopted() const
+		{
+			return m_pEntries != nullptr && !m_bOwnsEntries;
+		}
+
+	protected:
+
+	private:
+		Entry* m_pEntries;
+		EntryAllocator m_allocator;
+		bool m_bOwnsEntries;
+
+		void copyEntries(const Storage& other)
+		{
+			for (size_t i = 0; i < uiCapacity; ++i)
+			{
+				m_pEntries[i] = other.m_pEntries[i];
+			}
+		}
+
+		void release()
+		{
+			if (m_pEntries != nullptr && m_bOwnsEntries)
+			{
+				for (size_t i = 0; i < uiCapacity; ++i)
+				{
+					EntryAllocatorTraits::destroy(m_allocator, m_pEntries + i);
+				}
+
+				EntryAllocatorTraits::deallocate(m_allocator, m_pEntries, uiCapacity);
+			}
+
+			m_pEntries = nullptr;
+		}
+};
+
+/**
+Stores the entries of an indexed array inline. Intended for use by IndexedArray only. */
+template <typename Entry, size_t uiCapacity>
+class IndexedArrayStorage<Entry, uiCapacity, IndexedArrayInlineStorage>
+{
+	private:
+		typedef IndexedArrayStorage<Entry, uiCapacity, IndexedArrayInlineStorage> Storage;
+
+	public:
+		explicit IndexedArrayStorage(const IndexedArrayInlineStorage&)
+		{
+		}
+
+		IndexedArrayStorage(const Storage& other) = default;
+
+		IndexedArrayStorage(Storage&& other)
+		{
+			moveEntries(other);
+		}
+
+		Storage& operator=(const Storage& other) = default;
+
+		Storage& operator=(Storage&& other)
+		{
+			if (this != &other)
+			{
+				moveEntries(other);
+			}
+
+			return *this;
+		}
+
+		void swap(Storage& other)
+		{
+			for (size_t i = 0; i < uiCapacity; ++i)
+			{
+				std::swap(m_entries[i], other.m_entries[i]);
+			}
+		}
+
+		bool allocate()
+		{
+			return true;
+		}
+
+		void adopt(Entry* pEntries)
+		{
+			std::memcpy(m_entries, pEntries, sizeof(m_entries));
+		}
+
+		Entry* data() const
+		{
+			return m_entries;
+		}
+
+		bool isAdopted() const
+		{
+			return false;
+		}
+
+	protected:
+
+	private:
+		mutable Entry m_entries[uiCapacity];
+
+		/**
+		Moves the entries of another storage into this one and resets the other storages
+		entries. */
+		void moveEntries(Storage& other)
+		{
+			for (size_t i = 0; i < uiCapacity; ++i)
+			{
+				m_entries[i] = std::move(other.m_entries[i]);
+				other.m_entries[i] = Entry();
+			}
+		}
+};
+
+template <typename ElementType, size_t m_uiMaxElements, typename IdType = IndexedArrayId,
+	typename Allocator = std::allocator<ElementType>>
 class IndexedArray
 {
 	private:
-		typedef IndexedArray<ElementType, m_uiMaxElements> Array;
-		typedef IndexedArrayEntry<ElementType> Entry;
+		typedef IndexedArray<ElementType, m_uiMaxElements, IdType, Allocator> Array;
+		typedef IndexedArrayEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedIdVersioning<IdType> Versioning;
+		typedef IndexedArrayStorage<Entry, m_uiMaxElements, Allocator> Storage;
+		typedef IndexedSnapshot<Entry, typename IdType::VersionType> Snapshot;
 
 	public:
-		typedef IndexedArrayConstIterator<ElementType> ConstIterator;
-		typedef IndexedArrayIterator<ElementType> Iterator;
-		typedef IndexedArrayId Id;
+		typedef IndexedArrayConstIterator<ElementType, IdType> ConstIterator;
+		typedef IndexedArrayIterator<ElementType, IdType> Iterator;
+		typedef IdType Id;
 
 		static_assert((m_uiMaxElements > 0), "IndexedArray template parameter 'm_uiMaxElements' "
 			"must be >= 1.");
+		static_assert((m_uiMaxElements - 1 <= IdType::uiMaxIndex), "IndexedArray template "
+			"parameter 'm_uiMaxElements' exceeds the number of indices addressable by 'IdType'.");
 		static_assert(!std::is_const<ElementType>::value, "IndexedArray does not support const "
 			"element types.");
 		static_assert(std::is_default_constructible<ElementType>::value, "IndexedArray template "
@@ -320,39 +632,46 @@ class IndexedArray
 		/**
 		Constructor. */
 		IndexedArray() :
+			m_storage(Allocator()),
 			m_uiNumElements(0)
 		{
-			m_pElements = new Entry[m_uiMaxElements];
+			m_pElements = m_storage.data();
 		}
 
 		/**
-		Destructor. */
-		~IndexedArray()
+		Constructs an indexed array that obtains its storage from the given allocator.
+		@param allocator The allocator */
+		explicit IndexedArray(const Allocator& allocator) :
+			m_storage(allocator),
+			m_uiNumElements(0)
 		{
-			delete[] m_pElements;
+			m_pElements = m_storage.data();
 		}
 
 		/**
 		Copy constructor.
 		@param other The indexed array to copy */
 		IndexedArray(const Array& other) :
+			m_storage(other.m_storage),
 			m_uiNumElements(other.m_uiNumElements)
 		{
-			m_pElements = new Entry[m_uiMaxElements];
-			for (size_t i = 0; i < m_uiMaxElements; ++i)
+			m_pElements = m_storage.data();
+			if (m_pElements == nullptr)
 			{
-				m_pElements[i] = other.m_pElements[i];
+				m_uiNumElements = 0;
 			}
 		}
 
 		/**
-		Move-copy constructor.
+		Move-copy constructor. The storage is transferred without allocating and the other
+		indexed array is left empty.
 		@param other The indexed array to copy */
 		IndexedArray(Array&& other) :
-			m_uiNumElements(other.m_uiNumElements),
-			m_pElements(other.m_pElements)
+			m_storage(std::move(other.m_storage)),
+			m_uiNumElements(other.m_uiNumElements)
 		{
-			other.m_pElements = new Entry[m_uiMaxElements];
+			m_pElements = m_storage.data();
+			other.m_pElements = other.m_storage.data();
 			other.m_uiNumElements = 0;
 		}
 
@@ -364,34 +683,28 @@ class IndexedArray
 		{
 			if (this != &other)
 			{
-				m_uiNumElements = other.m_uiNumElements;
-
-				delete[] m_pElements;
-
-				m_pElements = new Entry[m_uiMaxElements];
-				for (size_t i = 0; i < m_uiMaxElements; ++i)
-				{
-					m_pElements[i] = other.m_pElements[i];
-				}
+				m_storage = other.m_storage;
+				m_pElements = m_storage.data();
+				m_uiNumElements = m_pElements != nullptr ? other.m_uiNumElements : 0;
 			}
 
 			return *this;
 		}
 
 		/**
-		Move-assignment operator.
+		Move-assignment operator. The storage is transferred without allocating and the other
+		indexed array is left empty.
 		@param other The indexed array to assign from
 		@return A reference to this indexed array */
 		Array& operator=(Array&& other)
 		{
 			if (this != &other)
 			{
-				delete[] m_pElements;
-
-				m_pElements = other.m_pElements;
+				m_storage = std::move(other.m_storage);
+				m_pElements = m_storage.data();
 				m_uiNumElements = other.m_uiNumElements;
 
-				other.m_pElements = new Entry[m_uiMaxElements];
+				other.m_pElements = other.m_storage.data();
 				other.m_uiNumElements = 0;
 			}
 
@@ -404,8 +717,10 @@ class IndexedArray
 		@param other The array to swap contents with */
 		void swap(Array& other)
 		{
+			m_storage.swap(other.m_storage);
+			m_pElements = m_storage.data();
+			other.m_pElements = other.m_storage.data();
 			std::swap(m_uiNumElements, other.m_uiNumElements);
-			std::swap(m_pElements, other.m_pElements);
 		}
 
 		/**
@@ -415,20 +730,19 @@ class IndexedArray
 		@return The elements id, or a default id */
 		Id push(const ElementType& element)
 		{
-			for (size_t i = 0; i < m_uiMaxElements; ++i)
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
 			{
-				if (!m_pElements[i].bIsActive)
-				{
-					m_pElements[i].bIsActive = true;
-					++m_pElements[i].uiVersionNumber;
-					m_pElements[i].element = element;
-					++m_uiNumElements;
-
-					return Id(i, m_pElements[i].uiVersionNumber);
-				}
+				return Id();
 			}
 
-			return Id(0, 0);
+			Entry& entry = m_pElements[uiIndex];
+			entry.bIsActive = true;
+			Versioning::advance(entry.uiVersionNumber);
+			entry.element = element;
+			++m_uiNumElements;
+
+			return Id(uiIndex, entry.uiVersionNumber);
 		}
 
 		/**
@@ -438,30 +752,31 @@ class IndexedArray
 		@return The elements id, or a default id */
 		Id push(ElementType&& element)
 		{
-			for (size_t i = 0; i < m_uiMaxElements; ++i)
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
 			{
-				if (!m_pElements[i].bIsActive)
-				{
-					m_pElements[i].bIsActive = true;
-					++m_pElements[i].uiVersionNumber;
-					m_pElements[i].element = std::move(element);
-					++m_uiNumElements;
-
-					return Id(i, m_pElements[i].uiVersionNumber);
-				}
+				return Id();
 			}
 
-			return Id(0, 0);
+			Entry& entry = m_pElements[uiIndex];
+			entry.bIsActive = true;
+			Versioning::advance(entry.uiVersionNumber);
+			entry.element = std::move(element);
+			++m_uiNumElements;
+
+			return Id(uiIndex, entry.uiVersionNumber);
 		}
 
 		/**
-		Inserts an element at the given index.
+		Inserts an element at the given index. Fails if the index is out of range or the entry at
+		the index has been retired.
 		@param element The element to insert
 		@param uiIndex The index to insert at
 		@return The elements id, or a default id */
 		Id insert(const ElementType& element, size_t uiIndex)
 		{
-			if (uiIndex < m_uiMaxElements)
+			if (uiIndex < m_uiMaxElements && ensureStorage() &&
+				Versioning::isUsable(m_pElements[uiIndex].uiVersionNumber))
 			{
 				if (!m_pElements[uiIndex].bIsActive)
 				{
@@ -469,25 +784,27 @@ class IndexedArray
 					++m_uiNumElements;
 				}
 
-				++m_pElements[uiIndex].uiVersionNumber;
+				Versioning::advance(m_pElements[uiIndex].uiVersionNumber);
 				m_pElements[uiIndex].element = element;
 
 				return Id(uiIndex, m_pElements[uiIndex].uiVersionNumber);
 			}
 			else
 			{
-				return Id(0, 0);
+				return Id();
 			}
 		}
 
 		/**
-		Inserts an element at the given index.
+		Inserts an element at the given index. Fails if the index is out of range or the entry at
+		the index has been retired.
 		@param element The element to insert
 		@param uiIndex The index to insert at
 		@return The elements id, or a default id */
 		Id insert(ElementType&& element, size_t uiIndex)
 		{
-			if (uiIndex < m_uiMaxElements)
+			if (uiIndex < m_uiMaxElements && ensureStorage() &&
+				Versioning::isUsable(m_pElements[uiIndex].uiVersionNumber))
 			{
 				if (!m_pElements[uiIndex].bIsActive)
 				{
@@ -495,29 +812,221 @@ class IndexedArray
 					++m_uiNumElements;
 				}
 
-				++m_pElements[uiIndex].uiVersionNumber;
+				Versioning::advance(m_pElements[uiIndex].uiVersionNumber);
 				m_pElements[uiIndex].element = std::move(element);
 
 				return Id(uiIndex, m_pElements[uiIndex].uiVersionNumber);
 			}
 			else
 			{
-				return Id(0, 0);
+				return Id();
+			}
+		}
+
+		/**
+		Pushes a batch of elements on to the indexed array. Free entries are found with a single
+		pass, rather than one search per element. The ids of the pushed elements are written to
+		the given id array, which must be able to hold uiCount ids, unless it is a nullptr.
+		Pushing stops early if the container becomes full.
+		@param pElements The elements to insert
+		@param uiCount The number of elements to insert
+		@param pIds Receives the element ids. May be a nullptr
+		@return The number of elements that were pushed */
+		size_t pushBatch(const ElementType* pElements, size_t uiCount, Id* pIds = nullptr)
+		{
+			if (!ensureStorage())
+			{
+				return 0;
+			}
+
+			size_t uiPushed = 0;
+			size_t uiCursor = 0;
+			while (uiPushed < uiCount)
+			{
+				while (uiCursor < m_uiMaxElements && !isUsableIndex(uiCursor))
+				{
+					++uiCursor;
+				}
+
+				if (uiCursor == m_uiMaxElements)
+				{
+					break;
+				}
+
+				Entry& entry = m_pElements[uiCursor];
+				entry.bIsActive = true;
+				Versioning::advance(entry.uiVersionNumber);
+				entry.element = pElements[uiPushed];
+
+				if (pIds != nullptr)
+				{
+					pIds[uiPushed] = Id(uiCursor, entry.uiVersionNumber);
+				}
+
+				++uiPushed;
+				++uiCursor;
+			}
+
+			m_uiNumElements += uiPushed;
+			return uiPushed;
+		}
+
+		/**
+		Removes a batch of elements. Ids that do not address an element are ignored.
+		@param pIds The ids of the elements to remove
+		@param uiCount The number of ids
+		@return The number of elements that were removed */
+		size_t removeBatch(const Id* pIds, size_t uiCount)
+		{
+			size_t uiRemoved = 0;
+			for (size_t i = 0; i < uiCount; ++i)
+			{
+				const size_t uiIndex = pIds[i].getIndex();
+				if (uiIndex < numEntries())
+				{
+					Entry& entry = m_pElements[uiIndex];
+					if (entry.bIsActive && entry.uiVersionNumber == pIds[i].getVersion())
+					{
+						entry.bIsActive = false;
+						Versioning::advance(entry.uiVersionNumber);
+						entry.element = ElementType();
+						++uiRemoved;
+					}
+				}
+			}
+
+			m_uiNumElements -= uiRemoved;
+			return uiRemoved;
+		}
+
+		/**
+		Invokes the given function on every active element whose index lies within the given
+		range. Disjoint ranges may be processed by different threads at the same time, provided
+		the container itself is not modified. See ParallelForEach.h.
+		@param uiBegin The first index of the range
+		@param uiEnd One past the last index of the range. Clamped to the capacity
+		@param function The function to invoke. Receives a reference to each element */
+		template <typename Function>
+		void forEachInRange(size_t uiBegin, size_t uiEnd, Function function)
+		{
+			if (uiEnd > numEntries())
+			{
+				uiEnd = numEntries();
 			}
+
+			for (size_t uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				Entry& entry = m_pElements[uiIndex];
+				if (entry.bIsActive)
+				{
+					function(entry.element);
+				}
+			}
+		}
+
+		/**
+		Invokes the given function on every active element whose index lies within the given
+		range. Disjoint ranges may be processed by different threads at the same time.
+		@param uiBegin The first index of the range
+		@param uiEnd One past the last index of the range. Clamped to the capacity
+		@param function The function to invoke. Receives a const reference to each element */
+		template <typename Function>
+		void forEachInRange(size_t uiBegin, size_t uiEnd, Function function) const
+		{
+			if (uiEnd > numEntries())
+			{
+				uiEnd = numEntries();
+			}
+
+			for (size_t uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				const Entry& entry = m_pElements[uiIndex];
+				if (entry.bIsActive)
+				{
+					function(entry.element);
+				}
+			}
+		}
+
+		/**
+		Retrieves the size of the snapshot image of the indexed array.
+		@return The image size in bytes */
+		size_t snapshotSize() const
+		{
+			return Snapshot::imageSize(m_uiMaxElements);
+		}
+
+		/**
+		Writes a snapshot image of the indexed array. Requires trivially copyable elements.
+		@param pBuffer The buffer to write to. Must be suitably aligned for the entries
+		@param uiBufferSize The size of the buffer in bytes. See snapshotSize
+		@return The result of the operation */
+		IndexedSnapshotResults writeSnapshot(void* pBuffer, size_t uiBufferSize)
+		{
+			if (!ensureStorage())
+			{
+				return IndexedSnapshotResults::FAIL_BUFFER_TOO_SMALL;
+			}
+
+			return Snapshot::write(m_pElements, m_uiMaxElements, m_uiNumElements, pBuffer,
+				uiBufferSize);
+		}
+
+		/**
+		Replaces the contents of the indexed array with a snapshot image of an indexed array of
+		the same capacity. Unless the array uses inline storage, the image is used in place
+		rather than copied, so it must stay valid and writable until the indexed array is
+		destroyed or adopts another image. Ids that were valid when the image was written are
+		valid again. Requires trivially copyable elements.
+		@param pImage The image. Must be suitably aligned for the entries
+		@param uiImageSize The size of the image in bytes
+		@return The result of the operation. The indexed array is not modified on failure */
+		IndexedSnapshotResults adoptSnapshot(void* pImage, size_t uiImageSize)
+		{
+			Entry* pEntries;
+			size_t uiCapacity;
+			size_t uiNumElements;
+
+			IndexedSnapshotResults result = Snapshot::read(pImage, uiImageSize, pEntries,
+				uiCapacity, uiNumElements);
+			if (result != IndexedSnapshotResults::SUCCESS)
+			{
+				return result;
+			}
+			else if (uiCapacity != m_uiMaxElements)
+			{
+				return IndexedSnapshotResults::FAIL_INCOMPATIBLE_IMAGE;
+			}
+
+			m_storage.adopt(pEntries);
+			m_pElements = m_storage.data();
+			m_uiNumElements = uiNumElements;
+
+			return IndexedSnapshotResults::SUCCESS;
 		}
 
 		/**
-		Returns an iterator to an element with the given id. If no such element existed, the 
+		Queries whether the indexed array is using an adopted snapshot image as its storage.
+		@return True if the storage is an adopted image, false otherwise */
+		bool isAdopted() const
+		{
+			return m_storage.isAdopted();
+		}
+
+		/**
+		Returns an iterator to an element with the given id. If no such element existed, the
 		iterator will address the end iterator.
 		@param id An id
 		@return An iterator to the element, or an iterator to the end */
 		Iterator find(const Id& id) const
 		{
-			if (id.uiIndex < m_uiMaxElements)
+			const size_t uiIndex = id.getIndex();
+			if (uiIndex < numEntries())
 			{
-				if (m_pElements[id.uiIndex].uiVersionNumber == id.uiVersion)
+				if (m_pElements[uiIndex].bIsActive &&
+					m_pElements[uiIndex].uiVersionNumber == id.getVersion())
 				{
-					return Iterator(&m_pElements[id.uiIndex], id.uiIndex, m_uiMaxElements);
+					return Iterator(&m_pElements[uiIndex], uiIndex, numEntries());
 				}
 				else
 				{
@@ -534,13 +1043,15 @@ class IndexedArray
 		@param id The id of the element to remove */
 		void remove(const Id& id)
 		{
-			if (id.uiIndex < m_uiMaxElements)
+			const size_t uiIndex = id.getIndex();
+			if (uiIndex < numEntries())
 			{
-				if (m_pElements[id.uiIndex].uiVersionNumber == id.uiVersion)
+				if (m_pElements[uiIndex].bIsActive &&
+					m_pElements[uiIndex].uiVersionNumber == id.getVersion())
 				{
-					m_pElements[id.uiIndex].bIsActive = false;
-					++m_pElements[id.uiIndex].uiVersionNumber;
-					m_pElements[id.uiIndex].element = ElementType();
+					m_pElements[uiIndex].bIsActive = false;
+					Versioning::advance(m_pElements[uiIndex].uiVersionNumber);
+					m_pElements[uiIndex].element = ElementType();
 					--m_uiNumElements;
 				}
 			}
@@ -550,10 +1061,10 @@ class IndexedArray
 		Clears all elements. Version counters are incremented. */
 		void clear()
 		{
-			for (size_t i = 0; i < m_uiMaxElements; ++i)
+			for (size_t i = 0; i < numEntries(); ++i)
 			{
 				m_pElements[i].bIsActive = false;
-				++m_pElements[i].uiVersionNumber;
+				Versioning::advance(m_pElements[i].uiVersionNumber);
 				m_pElements[i].element = ElementType();
 			}
 
@@ -561,10 +1072,11 @@ class IndexedArray
 		}
 
 		/**
-		Clears all elements. Version counters are reset to 0. */
+		Clears all elements. Version counters are reset to 0, which also restores any retired
+		entries. */
 		void reset()
 		{
-			for (size_t i = 0; i < m_uiMaxElements; ++i)
+			for (size_t i = 0; i < numEntries(); ++i)
 			{
 				m_pElements[i].bIsActive = false;
 				m_pElements[i].uiVersionNumber = 0;
@@ -579,7 +1091,7 @@ class IndexedArray
 		@return An iterator addressing the first element */
 		Iterator begin() const
 		{
-			return Iterator(&m_pElements[0], 0, m_uiMaxElements);
+			return Iterator(m_pElements, 0, numEntries());
 		}
 
 		/**
@@ -587,7 +1099,7 @@ class IndexedArray
 		@return An iterator addressing the end element */
 		Iterator end() const
 		{
-			return Iterator(&m_pElements[m_uiMaxElements], m_uiMaxElements, m_uiMaxElements);
+			return Iterator(m_pElements + numEntries(), numEntries(), numEntries());
 		}
 
 		/**
@@ -595,7 +1107,7 @@ class IndexedArray
 		@return A const iterator addressing the first element */
 		ConstIterator cbegin() const
 		{
-			return ConstIterator(&m_pElements[0], 0, m_uiMaxElements);
+			return ConstIterator(m_pElements, 0, numEntries());
 		}
 
 		/**
@@ -603,7 +1115,7 @@ class IndexedArray
 		@return A const iterator addressing the end element */
 		ConstIterator cend() const
 		{
-			return ConstIterator(&m_pElements[m_uiMaxElements], m_uiMaxElements, m_uiMaxElements);
+			return ConstIterator(m_pElements + numEntries(), numEntries(), numEntries());
 		}
 
 		/**
@@ -657,8 +1169,65 @@ class IndexedArray
 	protected:
 
 	private:
+		Storage m_storage;
 		Entry* m_pElements;
 		size_t m_uiNumElements;
+
+		/**
+		Retrieves the number of entries currently backed by storage. This is 0 for an indexed
+		array whose storage was moved away and has not been reallocated.
+		@return The number of entries */
+		size_t numEntries() const
+		{
+			return m_pElements != nullptr ? m_uiMaxElements : 0;
+		}
+
+		/**
+		Allocates the storage if it was moved away.
+		@return True if the storage is available, false if the allocator could not provide it */
+		bool ensureStorage()
+		{
+			if (m_pElements == nullptr)
+			{
+				m_storage.allocate();
+				m_pElements = m_storage.data();
+			}
+
+			return m_pElements != nullptr;
+		}
+
+		/**
+		Finds an inactive, usable index for a push.
+		@param uiIndex Receives the index
+		@return True if an index was found, false if the container was full */
+		bool acquireIndex(size_t& uiIndex)
+		{
+			if (!ensureStorage())
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < m_uiMaxElements; ++i)
+			{
+				if (isUsableIndex(i))
+				{
+					uiIndex = i;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		Queries whether the entry at the given index can be handed out by a push.
+		@param uiIndex The index. Must be less than the capacity
+		@return True if the entry is inactive and has not been retired */
+		bool isUsableIndex(size_t uiIndex) const
+		{
+			return !m_pElements[uiIndex].bIsActive &&
+				Versioning::isUsable(m_pElements[uiIndex].uiVersionNumber);
+		}
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,179 @@
+/**
+Indexed ids are the handles used to address elements of the indexed containers (IndexedArray,
+IndexedVector and PagedIndexedVector). Every id type exposes the same small interface so that the
+containers can be configured with the id type that best suits their use:
+
+- getIndex() and getVersion() accessors
+- A constructor taking an index and a version
+- A VersionType typedef that the containers use to store per-entry version numbers
+- uiMaxIndex, uiMaxVersion and overflowPolicy constants
+
+The default ids (IndexedArrayId and IndexedVectorId) store a full size_t index and version. The
+packed ids store both values in a single integer which makes them a quarter or half the size of
+the default ids. Entries in containers using packed ids store a correspondingly smaller version
+number.
+
+The overflow policy determines what happens to an entry whose version number has reached the
+maximum value representable by the id:
+- WRAP: The version returns to 0. Ids are no longer guaranteed to be unique.
+- RETIRE: The entry is retired once its element is removed and is never handed out by a push
+  again. Ids remain unique at the cost of slowly losing capacity. Retired entries are restored by
+  resetting the container.
+
+Containers refuse to store elements at indices greater than the id types maximum index.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef INDEXED_ID_H
+#define INDEXED_ID_H
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+enum class IndexedIdOverflowPolicies
+{
+	/**
+	Version numbers wrap back to 0 once they reach their maximum value. */
+	WRAP,
+
+	/**
+	Entries whose version numbers reach their maximum value are retired once their element is
+	removed. */
+	RETIRE
+};
+
+template <typename StorageType, std::uint32_t uiIndexBits,
+	IndexedIdOverflowPolicies policy = IndexedIdOverflowPolicies::WRAP>
+struct PackedIndexedId
+{
+	static_assert(std::is_unsigned<StorageType>::value, "PackedIndexedId template parameter "
+		"'StorageType' must be an unsigned integer type.");
+	static_assert(uiIndexBits > 0 && uiIndexBits < sizeof(StorageType) * 8, "PackedIndexedId "
+		"must reserve at least one bit for both the index and the version.");
+	static_assert(uiIndexBits <= sizeof(size_t) * 8, "PackedIndexedId index bits must fit in a "
+		"size_t.");
+
+	static const std::uint32_t uiVersionBits = sizeof(StorageType) * 8 - uiIndexBits;
+
+	typedef typename std::conditional<(uiVersionBits <= 8), std::uint8_t,
+		typename std::conditional<(uiVersionBits <= 16), std::uint16_t,
+		typename std::conditional<(uiVersionBits <= 32), std::uint32_t,
+		std::uint64_t>::type>::type>::type VersionType;
+
+	static const size_t uiMaxIndex = (size_t)(~0ull >> (64 - uiIndexBits));
+	static const VersionType uiMaxVersion = (VersionType)(~0ull >> (64 - uiVersionBits));
+	static const IndexedIdOverflowPolicies overflowPolicy = policy;
+
+	/**
+	The packed index and version. The index occupies the low bits. */
+	StorageType uiValue;
+
+	PackedIndexedId() :
+		uiValue(0)
+	{
+	}
+
+	PackedIndexedId(size_t uiIndex, VersionType uiVersion) :
+		uiValue((StorageType)(((StorageType)uiVersion << uiIndexBits) |
+			((StorageType)uiIndex & (StorageType)uiMaxIndex)))
+	{
+	}
+
+	/**
+	Retrieves the index.
+	@return The index */
+	size_t getIndex() const
+	{
+		return (size_t)(uiValue & (StorageType)uiMaxIndex);
+	}
+
+	/**
+	Retrieves the version number.
+	@return The version number */
+	VersionType getVersion() const
+	{
+		return (VersionType)(uiValue >> uiIndexBits);
+	}
+
+	/**
+	Constructs an id from a previously packed value. Intended for ids that have been stored or
+	transmitted in their packed form.
+	@param uiPackedValue The packed value
+	@return The id */
+	static PackedIndexedId fromPackedValue(StorageType uiPackedValue)
+	{
+		PackedIndexedId id;
+		id.uiValue = uiPackedValue;
+		return id;
+	}
+
+	bool operator==(const PackedIndexedId& other) const
+	{
+		return uiValue == other.uiValue;
+	}
+
+	bool operator!=(const PackedIndexedId& other) const
+	{
+		return uiValue != other.uiValue;
+	}
+};
+
+/**
+A 32 bit id with a 24 bit index and an 8 bit version. Retires entries on version overflow. */
+typedef PackedIndexedId<std::uint32_t, 24, IndexedIdOverflowPolicies::RETIRE> IndexedId32;
+
+/**
+A 32 bit id with a 24 bit index and an 8 bit version. Wraps versions on overflow. */
+typedef PackedIndexedId<std::uint32_t, 24, IndexedIdOverflowPolicies::WRAP> IndexedId32Wrapping;
+
+/**
+A 64 bit id with a 32 bit index and a 32 bit version. Retires entries on version overflow. */
+typedef PackedIndexedId<std::uint64_t, 32, IndexedIdOverflowPolicies::RETIRE> IndexedId64;
+
+/**
+A 64 bit id with a 32 bit index and a 32 bit version. Wraps versions on overflow. */
+typedef PackedIndexedId<std::uint64_t, 32, IndexedIdOverflowPolicies::WRAP> IndexedId64Wrapping;
+
+/**
+Applies an id types overflow policy to entry version numbers. Intended for use by the indexed
+containers only. */
+template <typename IdType>
+struct IndexedIdVersioning
+{
+	typedef typename IdType::VersionType VersionType;
+
+	/**
+	Queries whether an inactive entry with the given version number may be handed out by a push.
+	Retired entries may not.
+	@param uiVersion The entries version number
+	@return True if the entry can be used, false if it has been retired */
+	static bool isUsable(VersionType uiVersion)
+	{
+		return IdType::overflowPolicy == IndexedIdOverflowPolicies::WRAP ||
+			uiVersion != IdType::uiMaxVersion;
+	}
+
+	/**
+	Advances a version number according to the overflow policy. Under the retire policy a
+	version number that has reached its maximum stays there, which retires the entry once it is
+	inactive.
+	@param uiVersion The version number to advance */
+	static void advance(VersionType& uiVersion)
+	{
+		if (uiVersion != IdType::uiMaxVersion)
+		{
+			++uiVersion;
+		}
+		else if (IdType::overflowPolicy == IndexedIdOverflowPolicies::WRAP)
+		{
+			uiVersion = 0;
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,190 @@
+/**
+Snapshots are flat binary images of an indexed containers entries. An image consists of a fixed
+size header followed by the entries exactly as they are laid out in memory, including each
+entries active flag and version number. Inactive entries take the place of a free list, so an
+image restores the containers ids exactly.
+
+Because the entries are stored verbatim, an image can be adopted by a container in place, for
+example straight from a memory mapped file (see MappedFile.h), without any per-element work.
+Only containers of trivially copyable elements can be snapshotted.
+
+Images are not portable. They are only valid for the same element type, id type and platform
+they were written with. The header records the entry size and alignment and the version number
+size, which catches most mismatches, but not all of them.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef INDEXED_SNAPSHOT_H
+#define INDEXED_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+enum class IndexedSnapshotResults
+{
+	/**
+	The operation was successful. */
+	SUCCESS,
+
+	/**
+	The operation failed because the buffer or image was too small. */
+	FAIL_BUFFER_TOO_SMALL,
+
+	/**
+	The operation failed because the buffer or image was not suitably aligned for the entries. */
+	FAIL_MISALIGNED,
+
+	/**
+	The operation failed because the image is not a snapshot. */
+	FAIL_INVALID_IMAGE,
+
+	/**
+	The operation failed because the image was written by a container of a different type or
+	capacity. */
+	FAIL_INCOMPATIBLE_IMAGE
+};
+
+struct IndexedSnapshotHeader
+{
+	/**
+	Identifies a snapshot image. The bytes "NBIS" when read in little endian order. */
+	static const std::uint32_t uiSnapshotMagic = 0x5349424E;
+
+	/**
+	The current image format. */
+	static const std::uint32_t uiSnapshotFormat = 1;
+
+	/**
+	The offset of the entries from the start of an image. */
+	static const size_t uiEntriesOffset = 64;
+
+	std::uint32_t uiMagic;
+	std::uint32_t uiFormat;
+	std::uint64_t uiEntrySize;
+	std::uint64_t uiEntryAlignment;
+	std::uint64_t uiVersionSize;
+	std::uint64_t uiCapacity;
+	std::uint64_t uiNumElements;
+};
+
+static_assert(sizeof(IndexedSnapshotHeader) <= IndexedSnapshotHeader::uiEntriesOffset,
+	"IndexedSnapshotHeader must fit before the entries.");
+
+/**
+Reads and writes snapshot images. Intended for use by the indexed containers only. */
+template <typename Entry, typename VersionType>
+struct IndexedSnapshot
+{
+	static_assert(std::is_trivially_copyable<Entry>::value, "Snapshots require trivially "
+		"copyable elements.");
+	static_assert(alignof(Entry) <= IndexedSnapshotHeader::uiEntriesOffset, "Snapshot entries "
+		"are over-aligned.");
+
+	/**
+	Calculates the size of an image.
+	@param uiCapacity The number of entries
+	@return The image size in bytes */
+	static size_t imageSize(size_t uiCapacity)
+	{
+		return IndexedSnapshotHeader::uiEntriesOffset + uiCapacity * sizeof(Entry);
+	}
+
+	/**
+	Writes an image.
+	@param pEntries The entries
+	@param uiCapacity The number of entries
+	@param uiNumElements The number of active entries
+	@param pBuffer The buffer to write to. Must be aligned to at least alignof(Entry)
+	@param uiBufferSize The size of the buffer in bytes
+	@return The result of the operation */
+	static IndexedSnapshotResults write(const Entry* pEntries, size_t uiCapacity,
+		size_t uiNumElements, void* pBuffer, size_t uiBufferSize)
+	{
+		if (uiBufferSize < imageSize(uiCapacity))
+		{
+			return IndexedSnapshotResults::FAIL_BUFFER_TOO_SMALL;
+		}
+		else if (reinterpret_cast<std::uintptr_t>(pBuffer) % alignof(Entry) != 0)
+		{
+			return IndexedSnapshotResults::FAIL_MISALIGNED;
+		}
+
+		IndexedSnapshotHeader header;
+		std::memset(&header, 0, sizeof(header));
+		header.uiMagic = IndexedSnapshotHeader::uiSnapshotMagic;
+		header.uiFormat = IndexedSnapshotHeader::uiSnapshotFormat;
+		header.uiEntrySize = sizeof(Entry);
+		header.uiEntryAlignment = alignof(Entry);
+		header.uiVersionSize = sizeof(VersionType);
+		header.uiCapacity = uiCapacity;
+		header.uiNumElements = uiNumElements;
+
+		unsigned char* pBytes = static_cast<unsigned char*>(pBuffer);
+		std::memset(pBytes, 0, IndexedSnapshotHeader::uiEntriesOffset);
+		std::memcpy(pBytes, &header, sizeof(header));
+
+		if (uiCapacity != 0)
+		{
+			std::memcpy(pBytes + IndexedSnapshotHeader::uiEntriesOffset, pEntries,
+				uiCapacity * sizeof(Entry));
+		}
+
+		return IndexedSnapshotResults::SUCCESS;
+	}
+
+	/**
+	Validates an image and locates its entries. The entries are not copied.
+	@param pImage The image. Must be aligned to at least alignof(Entry)
+	@param uiImageSize The size of the image in bytes
+	@param pEntries Receives a pointer to the entries within the image
+	@param uiCapacity Receives the number of entries
+	@param uiNumElements Receives the number of active entries
+	@return The result of the operation */
+	static IndexedSnapshotResults read(void* pImage, size_t uiImageSize, Entry*& pEntries,
+		size_t& uiCapacity, size_t& uiNumElements)
+	{
+		if (uiImageSize < IndexedSnapshotHeader::uiEntriesOffset)
+		{
+			return IndexedSnapshotResults::FAIL_BUFFER_TOO_SMALL;
+		}
+		else if (reinterpret_cast<std::uintptr_t>(pImage) % alignof(Entry) != 0)
+		{
+			return IndexedSnapshotResults::FAIL_MISALIGNED;
+		}
+
+		IndexedSnapshotHeader header;
+		std::memcpy(&header, pImage, sizeof(header));
+
+		if (header.uiMagic != IndexedSnapshotHeader::uiSnapshotMagic ||
+			header.uiFormat != IndexedSnapshotHeader::uiSnapshotFormat ||
+			header.uiNumElements > header.uiCapacity)
+		{
+			return IndexedSnapshotResults::FAIL_INVALID_IMAGE;
+		}
+		else if (header.uiEntrySize != sizeof(Entry) ||
+			header.uiEntryAlignment != alignof(Entry) ||
+			header.uiVersionSize != sizeof(VersionType))
+		{
+			return IndexedSnapshotResults::FAIL_INCOMPATIBLE_IMAGE;
+		}
+		else if (header.uiCapacity > (uiImageSize - IndexedSnapshotHeader::uiEntriesOffset) /
+			sizeof(Entry))
+		{
+			return IndexedSnapshotResults::FAIL_BUFFER_TOO_SMALL;
+		}
+
+		pEntries = reinterpret_cast<Entry*>(static_cast<unsigned char*>(pImage) +
+			IndexedSnapshotHeader::uiEntriesOffset);
+		uiCapacity = (size_t)header.uiCapacity;
+		uiNumElements = (size_t)header.uiNumElements;
+
+		return IndexedSnapshotResults::SUCCESS;
+	}
+};
+
+#endif
@@ -11,18 +11,47 @@ Ids are composed of the index that the element currently resides at and a unique
 that increments each time the stored object is replaced.
 
 *Note that if the version number overflows, Ids are no longer unique. Users should consider this
-when selecting their container of choice.
+when selecting their container of choice. Alternatively, a packed id type with a retiring overflow
+policy can be supplied as the second template parameter. Packed ids also reduce the size of both
+the ids and the per-entry version numbers. See IndexedId.h.
+
+The capacity of an indexed vector never shrinks on its own. After heavy churn, compact moves the
+active elements into the holes at the front of the storage and releases the unused tail. Ids of
+moved elements change, so compact returns a remap that callers apply to the ids they hold.
+
+Storage is obtained from the allocator supplied as the third template parameter, which is
+rebound to the internal entry type. See ArenaAllocator.h and PoolAllocator.h. No storage is
+allocated until the first element is pushed, and moves transfer the storage without allocating.
+
+Indexed vectors of trivially copyable elements can be written to a snapshot image and can adopt
+an image in place, preserving every id. See IndexedSnapshot.h.
 
 @date authored 26/03/2017
-@date edited 14/03/2017
+@date edited 18/10/2026
 
 @author Nathan Sainsbury */
 
 #ifndef INDEXED_VECTOR_H
 #define INDEXED_VECTOR_H
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <vector>
+
+#include "Engine/System/Tools/IndexedId.h"
+#include "Engine/System/Tools/IndexedSnapshot.h"
+
 struct IndexedVectorId
 {
+	typedef size_t VersionType;
+
+	static const size_t uiMaxIndex = std::numeric_limits<size_t>::max();
+	static const size_t uiMaxVersion = std::numeric_limits<size_t>::max();
+	static const IndexedIdOverflowPolicies overflowPolicy = IndexedIdOverflowPolicies::WRAP;
+
 	/**
 	The index. */
 	size_t uiIndex;
@@ -42,9 +71,35 @@ struct IndexedVectorId
 		uiVersion(uiVersion)
 	{
 	}
+
+	/**
+	Retrieves the index.
+	@return The index */
+	size_t getIndex() const
+	{
+		return uiIndex;
+	}
+
+	/**
+	Retrieves the version number.
+	@return The version number */
+	size_t getVersion() const
+	{
+		return uiVersion;
+	}
+
+	bool operator==(const IndexedVectorId& other) const
+	{
+		return uiIndex == other.uiIndex && uiVersion == other.uiVersion;
+	}
+
+	bool operator!=(const IndexedVectorId& other) const
+	{
+		return uiIndex != other.uiIndex || uiVersion != other.uiVersion;
+	}
 };
 
-template <typename ElementType>
+template <typename ElementType, typename VersionType = size_t>
 struct IndexedVectorEntry
 {
 	/**
@@ -53,7 +108,7 @@ struct IndexedVectorEntry
 
 	/**
 	The version number. */
-	size_t uiVersionNumber;
+	VersionType uiVersionNumber;
 
 	/**
 	The stored element. */
@@ -66,7 +121,7 @@ struct IndexedVectorEntry
 	{
 	}
 
-	IndexedVectorEntry(bool bIsActive, size_t uiVersionNumber, const ElementType& element) :
+	IndexedVectorEntry(bool bIsActive, VersionType uiVersionNumber, const ElementType& element) :
 		bIsActive(bIsActive),
 		uiVersionNumber(uiVersionNumber),
 		element(element)
@@ -74,13 +129,13 @@ struct IndexedVectorEntry
 	}
 };
 
-template <typename ElementType>
+template <typename ElementType, typename IdType = IndexedVectorId>
 class IndexedVectorIterator
 {
 	private:
-		typedef IndexedVectorEntry<ElementType> Entry;
-		typedef IndexedVectorIterator<ElementType> Iterator;
-		typedef IndexedVectorId Id;
+		typedef IndexedVectorEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedVectorIterator<ElementType, IdType> Iterator;
+		typedef IdType Id;
 
 	public:
 		IndexedVectorIterator() :
@@ -184,13 +239,13 @@ class IndexedVectorIterator
 		size_t m_uiMaxIndex;
 };
 
-template <typename ElementType>
+template <typename ElementType, typename IdType = IndexedVectorId>
 class IndexedVectorConstIterator
 {
 	private:
-		typedef IndexedVectorEntry<ElementType> Entry;
-		typedef IndexedVectorConstIterator<ElementType> Iterator;
-		typedef IndexedVectorId Id;
+		typedef IndexedVectorEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedVectorConstIterator<ElementType, IdType> Iterator;
+		typedef IdType Id;
 
 	public:
 		IndexedVectorConstIterator() :
@@ -296,17 +351,87 @@ class IndexedVectorConstIterator
 		size_t m_uiMaxIndex;
 };
 
-template <typename ElementType>
+/**
+Maps the ids of elements moved by IndexedVector::compact to their new ids. Ids of elements that
+were not moved stay valid and are left unchanged by the remap. */
+template <typename IdType = IndexedVectorId>
+class IndexedVectorRemap
+{
+	public:
+		typedef IdType Id;
+
+		/**
+		Records that the element addressed by an old id now resides at a new id. Old ids must be
+		added in ascending index order.
+		@param oldId The id before compaction
+		@param newId The id after compaction */
+		void add(const Id& oldId, const Id& newId)
+		{
+			m_mappings.push_back(std::make_pair(oldId, newId));
+		}
+
+		/**
+		Replaces an id with its new id if the element it addresses was moved.
+		@param id The id to remap
+		@return True if the id was replaced, false if it is unchanged */
+		bool remap(Id& id) const
+		{
+			const size_t uiIndex = id.getIndex();
+			auto it = std::lower_bound(m_mappings.begin(), m_mappings.end(), uiIndex,
+				[](const std::pair<Id, Id>& mapping, size_t uiOldIndex)
+				{
+					return mapping.first.getIndex() < uiOldIndex;
+				});
+
+			if (it != m_mappings.end() && it->first == id)
+			{
+				id = it->second;
+				return true;
+			}
+
+			return false;
+		}
+
+		/**
+		Retrieves the number of moved elements.
+		@return The number of moved elements */
+		size_t size() const
+		{
+			return m_mappings.size();
+		}
+
+		/**
+		Queries whether no elements were moved.
+		@return True if no elements were moved, false otherwise */
+		bool isEmpty() const
+		{
+			return m_mappings.empty();
+		}
+
+	protected:
+
+	private:
+		std::vector<std::pair<Id, Id>> m_mappings;
+};
+
+template <typename ElementType, typename IdType = IndexedVectorId,
+	typename Allocator = std::allocator<ElementType>>
 class IndexedVector
 {
 	private:
-		typedef IndexedVector<ElementType> Array;
-		typedef IndexedVectorEntry<ElementType> Entry;
+		typedef IndexedVector<ElementType, IdType, Allocator> Array;
+		typedef IndexedVectorEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedIdVersioning<IdType> Versioning;
+		typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>
+			EntryAllocator;
+		typedef std::allocator_traits<EntryAllocator> EntryAllocatorTraits;
+		typedef IndexedSnapshot<Entry, typename IdType::VersionType> Snapshot;
 
 	public:
-		typedef IndexedVectorConstIterator<ElementType> ConstIterator;
-		typedef IndexedVectorIterator<ElementType> Iterator;
-		typedef IndexedVectorId Id;
+		typedef IndexedVectorConstIterator<ElementType, IdType> ConstIterator;
+		typedef IndexedVectorIterator<ElementType, IdType> Iterator;
+		typedef IndexedVectorRemap<IdType> Remap;
+		typedef IdType Id;
 
 		static_assert(!std::is_const<ElementType>::value, "IndexedVector does not support const "
 			"element types.");
@@ -318,45 +443,64 @@ class IndexedVector
 			"to be destructible");
 
 		/**
-		Constructor. */
+		Constructor. No storage is allocated until the first element is pushed. */
 		IndexedVector() :
+			m_pElements(nullptr),
+			m_uiNumElements(0),
+			m_uiMaxElements(0),
+			m_allocator(Allocator()),
+			m_bOwnsElements(true)
+		{
+		}
+
+		/**
+		Constructs an indexed vector that obtains its storage from the given allocator. No storage
+		is allocated until the first element is pushed.
+		@param allocator The allocator */
+		explicit IndexedVector(const Allocator& allocator) :
+			m_pElements(nullptr),
 			m_uiNumElements(0),
-			m_uiMaxElements(1)
+			m_uiMaxElements(0),
+			m_allocator(allocator),
+			m_bOwnsElements(true)
 		{
-			m_pElements = new Entry[m_uiMaxElements];
 		}
 
 		/**
 		Destructor. */
 		~IndexedVector()
 		{
-			delete[] m_pElements;
+			releaseStorage();
 		}
 
 		/**
 		Copy constructor.
 		@param other The indexed vector to copy */
 		IndexedVector(const Array& other) :
-			m_uiNumElements(other.m_uiNumElements),
-			m_uiMaxElements(other.m_uiMaxElements)
+			m_pElements(nullptr),
+			m_uiNumElements(0),
+			m_uiMaxElements(0),
+			m_allocator(EntryAllocatorTraits::select_on_container_copy_construction(
+				other.m_allocator)),
+			m_bOwnsElements(true)
 		{
-			m_pElements = new Entry[m_uiMaxElements];
-			for (size_t i = 0; i < m_uiMaxElements; ++i)
-			{
-				m_pElements[i] = other.m_pElements[i];
-			}
+			copyFrom(other);
 		}
 
 		/**
-		Move-copy constructor.
+		Move-copy constructor. The storage is transferred and the other indexed vector is left
+		empty without any storage.
 		@param other The indexed vector to copy */
 		IndexedVector(Array&& other) :
+			m_pElements(other.m_pElements),
 			m_uiNumElements(other.m_uiNumElements),
 			m_uiMaxElements(other.m_uiMaxElements),
-			m_pElements(other.m_pElements)
+			m_allocator(other.m_allocator),
+			m_bOwnsElements(other.m_bOwnsElements)
 		{
-			other.m_pElements = new Entry[m_uiMaxElements];
+			other.m_pElements = nullptr;
 			other.m_uiNumElements = 0;
+			other.m_uiMaxElements = 0;
 		}
 
 		/**
@@ -367,180 +511,110 @@ class IndexedVector
 		{
 			if (this != &other)
 			{
-				m_uiNumElements = other.m_uiNumElements;
-				m_uiMaxElements = other.m_uiMaxElements;
+				releaseStorage();
 
-				delete[] m_pElements;
+				m_pElements = nullptr;
+				m_uiNumElements = 0;
+				m_uiMaxElements = 0;
 
-				m_pElements = new Entry[m_uiMaxElements];
-				for (size_t i = 0; i < m_uiMaxElements; ++i)
-				{
-					m_pElements[i] = other.m_pElements[i];
-				}
+				copyFrom(other);
 			}
 
 			return *this;
 		}
 
 		/**
-		Move-assignment operator.
+		Move-assignment operator. The storage and allocator are transferred and the other indexed
+		vector is left empty without any storage.
 		@param other The indexed vector to assign from
 		@return A reference to this indexed vector */
 		Array& operator=(Array&& other)
 		{
 			if (this != &other)
 			{
-				delete[] m_pElements;
+				releaseStorage();
 
+				m_pElements = other.m_pElements;
 				m_uiNumElements = other.m_uiNumElements;
 				m_uiMaxElements = other.m_uiMaxElements;
-				m_pElements = other.m_pElements;
+				m_allocator = other.m_allocator;
+				m_bOwnsElements = other.m_bOwnsElements;
 
+				other.m_pElements = nullptr;
 				other.m_uiNumElements = 0;
-				other.m_uiMaxElements = 1;
-				other.m_pElements = new Entry[other.m_uiMaxElements];
+				other.m_uiMaxElements = 0;
 			}
 
 			return *this;
 		}
 
 		/**
-		Swaps the contents of the indexed vector with another indexed vector of the same type and
-		size.
+		Swaps the contents of the indexed vector with another indexed vector of the same type.
+		Allocators are swapped along with the storage.
 		@param other The array to swap contents with */
 		void swap(Array& other)
 		{
+			std::swap(m_pElements, other.m_pElements);
 			std::swap(m_uiNumElements, other.m_uiNumElements);
 			std::swap(m_uiMaxElements, other.m_uiMaxElements);
-			std::swap(m_pElements, other.m_pElements);
+			std::swap(m_allocator, other.m_allocator);
+			std::swap(m_bOwnsElements, other.m_bOwnsElements);
 		}
 
 		/**
-		Pushes an element on to the indexed vector. If the container was full, the element is not
-		appended and a default id is returned instead.
+		Pushes an element on to the indexed vector. If the container was full and could not grow
+		any further, the element is not appended and a default id is returned instead.
 		@param element The element to insert
 		@return The elements id, or a default id */
 		Id push(const ElementType& element)
 		{
-			if (m_uiNumElements < m_uiMaxElements)
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
 			{
-				for (size_t i = 0; i < m_uiMaxElements; ++i)
-				{
-					if (!m_pElements[i].bIsActive)
-					{
-						m_pElements[i].bIsActive = true;
-						++m_pElements[i].uiVersionNumber;
-						m_pElements[i].element = element;
-						++m_uiNumElements;
-
-						return Id(i, m_pElements[i].uiVersionNumber);
-					}
-				}
+				return Id();
 			}
-			else
-			{
-				size_t uiOldMax = m_uiMaxElements;
-
-				// Expand if possible
-				if (m_uiMaxElements < std::numeric_limits<size_t>::max())
-				{
-					if (m_uiMaxElements * 2 < std::numeric_limits<size_t>::max())
-					{
-						m_uiMaxElements *= 2;
-					}
-					else
-					{
-						m_uiMaxElements = std::numeric_limits<size_t>::max();
-					}
-
-					Entry* pNewElements = new Entry[m_uiMaxElements];
-					for (size_t ui = 0; ui < uiOldMax; ++ui)
-					{
-						pNewElements[ui] = m_pElements[ui];
-					}
 
-					delete[] m_pElements;
-					m_pElements = pNewElements;
+			Entry& entry = m_pElements[uiIndex];
+			entry.bIsActive = true;
+			Versioning::advance(entry.uiVersionNumber);
+			entry.element = element;
+			++m_uiNumElements;
 
-					m_pElements[uiOldMax].bIsActive = true;
-					++m_pElements[uiOldMax].uiVersionNumber;
-					m_pElements[uiOldMax].element = std::move(element);
-					++m_uiNumElements;
-
-					return Id(uiOldMax, 1);
-				}
-			}
-
-			return Id(0, 0);
+			return Id(uiIndex, entry.uiVersionNumber);
 		}
 
 		/**
-		Pushes an element on to the indexed vector. If the container was full, the element is not
-		appended and a default id is returned instead.
+		Pushes an element on to the indexed vector. If the container was full and could not grow
+		any further, the element is not appended and a default id is returned instead.
 		@param element The element to insert
 		@return The elements id, or a default id */
 		Id push(ElementType&& element)
 		{
-			if (m_uiNumElements < m_uiMaxElements)
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
 			{
-				for (size_t i = 0; i < m_uiMaxElements; ++i)
-				{
-					if (!m_pElements[i].bIsActive)
-					{
-						m_pElements[i].bIsActive = true;
-						++m_pElements[i].uiVersionNumber;
-						m_pElements[i].element = std::move(element);
-						++m_uiNumElements;
-
-						return Id(i, m_pElements[i].uiVersionNumber);
-					}
-				}
+				return Id();
 			}
-			else
-			{
-				size_t uiOldMax = m_uiMaxElements;
-				
-				// Expand if possible
-				if (m_uiMaxElements < std::numeric_limits<size_t>::max())
-				{
-					if (m_uiMaxElements * 2 < std::numeric_limits<size_t>::max())
-					{
-						m_uiMaxElements *= 2;
-					}
-					else
-					{
-						m_uiMaxElements = std::numeric_limits<size_t>::max();
-					}
-					
-					Entry* pNewElements = new Entry[m_uiMaxElements];
-					for (size_t ui = 0; ui < uiOldMax; ++ui)
-					{
-						pNewElements[ui] = m_pElements[ui];
-					}
-
-					delete[] m_pElements;
-					m_pElements = pNewElements;
 
-					m_pElements[uiOldMax].bIsActive = true;
-					++m_pElements[uiOldMax].uiVersionNumber;
-					m_pElements[uiOldMax].element = std::move(element);
-					++m_uiNumElements;
-
-					return Id(uiOldMax, 1);
-				}			
-			}
+			Entry& entry = m_pElements[uiIndex];
+			entry.bIsActive = true;
+			Versioning::advance(entry.uiVersionNumber);
+			entry.element = std::move(element);
+			++m_uiNumElements;
 
-			return Id(0, 0);
+			return Id(uiIndex, entry.uiVersionNumber);
 		}
 
 		/**
-		Inserts an element at the given index.
+		Inserts an element at the given index. Fails if the index is out of range or the entry at
+		the index has been retired.
 		@param element The element to insert
 		@param uiIndex The index to insert at
 		@return The elements id, or a default id */
 		Id insert(const ElementType& element, size_t uiIndex)
 		{
-			if (uiIndex < m_uiMaxElements)
+			if (uiIndex < m_uiMaxElements &&
+				Versioning::isUsable(m_pElements[uiIndex].uiVersionNumber))
 			{
 				if (!m_pElements[uiIndex].bIsActive)
 				{
@@ -548,25 +622,27 @@ class IndexedVector
 					++m_uiNumElements;
 				}
 
-				++m_pElements[uiIndex].uiVersionNumber;
+				Versioning::advance(m_pElements[uiIndex].uiVersionNumber);
 				m_pElements[uiIndex].element = element;
 
 				return Id(uiIndex, m_pElements[uiIndex].uiVersionNumber);
 			}
 			else
 			{
-				return Id(0, 0);
+				return Id();
 			}
 		}
 
 		/**
-		Inserts an element at the given index.
+		Inserts an element at the given index. Fails if the index is out of range or the entry at
+		the index has been retired.
 		@param element The element to insert
 		@param uiIndex The index to insert at
 		@return The elements id, or a default id */
 		Id insert(ElementType&& element, size_t uiIndex)
 		{
-			if (uiIndex < m_uiMaxElements)
+			if (uiIndex < m_uiMaxElements &&
+				Versioning::isUsable(m_pElements[uiIndex].uiVersionNumber))
 			{
 				if (!m_pElements[uiIndex].bIsActive)
 				{
@@ -574,35 +650,310 @@ class IndexedVector
 					++m_uiNumElements;
 				}
 
-				++m_pElements[uiIndex].uiVersionNumber;
+				Versioning::advance(m_pElements[uiIndex].uiVersionNumber);
 				m_pElements[uiIndex].element = std::move(element);
 
 				return Id(uiIndex, m_pElements[uiIndex].uiVersionNumber);
 			}
 			else
 			{
-				return Id(0, 0);
+				return Id();
+			}
+		}
+
+		/**
+		Pushes a batch of elements on to the indexed vector. The container grows at most once
+		up front and free entries are found with a single pass, rather than one search per
+		element. The ids of the pushed elements are written to the given id array, which must be
+		able to hold uiCount ids, unless it is a nullptr. Pushing stops early if the container
+		reaches its maximum capacity.
+		@param pElements The elements to insert
+		@param uiCount The number of elements to insert
+		@param pIds Receives the element ids. May be a nullptr
+		@return The number of elements that were pushed */
+		size_t pushBatch(const ElementType* pElements, size_t uiCount, Id* pIds = nullptr)
+		{
+			// Grow once for the whole batch rather than doubling repeatedly
+			if (uiCount > m_uiMaxElements - m_uiNumElements)
+			{
+				reserve(uiCount < maxCapacity() - m_uiNumElements ?
+					m_uiNumElements + uiCount : maxCapacity());
+			}
+
+			size_t uiPushed = 0;
+			size_t uiCursor = 0;
+			while (uiPushed < uiCount)
+			{
+				while (uiCursor < m_uiMaxElements && !isUsableIndex(uiCursor))
+				{
+					++uiCursor;
+				}
+
+				if (uiCursor == m_uiMaxElements && !grow())
+				{
+					break;
+				}
+
+				Entry& entry = m_pElements[uiCursor];
+				entry.bIsActive = true;
+				Versioning::advance(entry.uiVersionNumber);
+				entry.element = pElements[uiPushed];
+
+				if (pIds != nullptr)
+				{
+					pIds[uiPushed] = Id(uiCursor, entry.uiVersionNumber);
+				}
+
+				++uiPushed;
+				++uiCursor;
+			}
+
+			m_uiNumElements += uiPushed;
+			return uiPushed;
+		}
+
+		/**
+		Removes a batch of elements. Ids that do not address an element are ignored.
+		@param pIds The ids of the elements to remove
+		@param uiCount The number of ids
+		@return The number of elements that were removed */
+		size_t removeBatch(const Id* pIds, size_t uiCount)
+		{
+			size_t uiRemoved = 0;
+			for (size_t i = 0; i < uiCount; ++i)
+			{
+				const size_t uiIndex = pIds[i].getIndex();
+				if (uiIndex < m_uiMaxElements)
+				{
+					Entry& entry = m_pElements[uiIndex];
+					if (entry.bIsActive && entry.uiVersionNumber == pIds[i].getVersion())
+					{
+						entry.bIsActive = false;
+						Versioning::advance(entry.uiVersionNumber);
+						entry.element = ElementType();
+						++uiRemoved;
+					}
+				}
+			}
+
+			m_uiNumElements -= uiRemoved;
+			return uiRemoved;
+		}
+
+		/**
+		Invokes the given function on every active element whose index lies within the given
+		range. Disjoint ranges may be processed by different threads at the same time, provided
+		the container itself is not modified. See ParallelForEach.h.
+		@param uiBegin The first index of the range
+		@param uiEnd One past the last index of the range. Clamped to the capacity
+		@param function The function to invoke. Receives a reference to each element */
+		template <typename Function>
+		void forEachInRange(size_t uiBegin, size_t uiEnd, Function function)
+		{
+			if (uiEnd > m_uiMaxElements)
+			{
+				uiEnd = m_uiMaxElements;
+			}
+
+			for (size_t uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				Entry& entry = m_pElements[uiIndex];
+				if (entry.bIsActive)
+				{
+					function(entry.element);
+				}
+			}
+		}
+
+		/**
+		Invokes the given function on every active element whose index lies within the given
+		range. Disjoint ranges may be processed by different threads at the same time.
+		@param uiBegin The first index of the range
+		@param uiEnd One past the last index of the range. Clamped to the capacity
+		@param function The function to invoke. Receives a const reference to each element */
+		template <typename Function>
+		void forEachInRange(size_t uiBegin, size_t uiEnd, Function function) const
+		{
+			if (uiEnd > m_uiMaxElements)
+			{
+				uiEnd = m_uiMaxElements;
+			}
+
+			for (size_t uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				const Entry& entry = m_pElements[uiIndex];
+				if (entry.bIsActive)
+				{
+					function(entry.element);
+				}
 			}
 		}
 
 		/**
 		Reserves space for at least the given number of elements. If the given number is less
-		than the current maximum elements, no action is taken.
+		than the current maximum elements, no action is taken. The capacity is limited to the
+		number of indices addressable by the id type.
 		@param uiCapacity The desired capacity */
 		void reserve(size_t uiCapacity)
 		{
+			if (uiCapacity > maxCapacity())
+			{
+				uiCapacity = maxCapacity();
+			}
+
 			if (uiCapacity > m_uiMaxElements)
 			{
-				Entry* pNewElements = new Entry[uiCapacity];
-				for (size_t ui = 0; ui < m_uiMaxElements; ++ui)
+				reallocate(uiCapacity);
+			}
+		}
+
+		/**
+		Moves active elements from the back of the storage into inactive entries at the front,
+		then shrinks the storage to fit the remaining elements. Retired entries are not filled.
+		Moved elements do not keep their relative order.
+
+		The ids of moved elements change. Apply the returned remap to every stored id of an
+		element in the container. Entries released by the shrink lose their version numbers, so
+		ids of previously removed elements must be discarded rather than kept across a compact.
+		@return The mapping from the old ids of moved elements to their new ids */
+		Remap compact()
+		{
+			std::vector<std::pair<Id, Id>> moves;
+
+			size_t uiFront = 0;
+			size_t uiBack = m_uiMaxElements;
+			while (true)
+			{
+				while (uiFront < uiBack && !isUsableIndex(uiFront))
+				{
+					++uiFront;
+				}
+
+				while (uiBack > uiFront && !m_pElements[uiBack - 1].bIsActive)
+				{
+					--uiBack;
+				}
+
+				if (uiBack <= uiFront + 1)
 				{
-					pNewElements[ui] = m_pElements[ui];
+					break;
 				}
 
-				delete[] m_pElements;
-				m_pElements = pNewElements;
-				m_uiMaxElements = uiCapacity;
+				Entry& source = m_pElements[uiBack - 1];
+				Entry& destination = m_pElements[uiFront];
+
+				destination.bIsActive = true;
+				Versioning::advance(destination.uiVersionNumber);
+				destination.element = std::move(source.element);
+				moves.push_back(std::make_pair(Id(uiBack - 1, source.uiVersionNumber),
+					Id(uiFront, destination.uiVersionNumber)));
+
+				source.bIsActive = false;
+				Versioning::advance(source.uiVersionNumber);
+				source.element = ElementType();
+			}
+
+			// Elements were moved from the back, so the old ids are in descending index order
+			Remap remap;
+			for (auto it = moves.rbegin(); it != moves.rend(); ++it)
+			{
+				remap.add(it->first, it->second);
 			}
+
+			shrinkToFit();
+			return remap;
+		}
+
+		/**
+		Shrinks the storage to end just after the last active element. An empty indexed vector
+		releases its storage entirely. Elements are not moved, so all ids of active elements stay
+		valid. Entries released by the shrink lose their version numbers, see compact.
+		@return The new capacity */
+		size_t shrinkToFit()
+		{
+			size_t uiCapacity = m_uiMaxElements;
+			while (uiCapacity > 0 && !m_pElements[uiCapacity - 1].bIsActive)
+			{
+				--uiCapacity;
+			}
+
+			if (uiCapacity != m_uiMaxElements)
+			{
+				reallocate(uiCapacity);
+			}
+
+			return m_uiMaxElements;
+		}
+
+		/**
+		Retrieves the number of bytes used by the indexed vector, including its heap storage.
+		Memory owned by the elements themselves is not included.
+		@return The memory footprint in bytes */
+		size_t memoryFootprint() const
+		{
+			return sizeof(Array) + m_uiMaxElements * sizeof(Entry);
+		}
+
+		/**
+		Retrieves the size of the snapshot image of the indexed vector.
+		@return The image size in bytes */
+		size_t snapshotSize() const
+		{
+			return Snapshot::imageSize(m_uiMaxElements);
+		}
+
+		/**
+		Writes a snapshot image of the indexed vector. Requires trivially copyable elements.
+		@param pBuffer The buffer to write to. Must be suitably aligned for the entries
+		@param uiBufferSize The size of the buffer in bytes. See snapshotSize
+		@return The result of the operation */
+		IndexedSnapshotResults writeSnapshot(void* pBuffer, size_t uiBufferSize) const
+		{
+			return Snapshot::write(m_pElements, m_uiMaxElements, m_uiNumElements, pBuffer,
+				uiBufferSize);
+		}
+
+		/**
+		Replaces the contents of the indexed vector with a snapshot image. The image is used in
+		place rather than copied, so it must stay valid and writable until the indexed vector
+		grows, is destroyed or adopts another image. Ids that were valid when the image was
+		written are valid again. Requires trivially copyable elements.
+		@param pImage The image. Must be suitably aligned for the entries
+		@param uiImageSize The size of the image in bytes
+		@return The result of the operation. The indexed vector is not modified on failure */
+		IndexedSnapshotResults adoptSnapshot(void* pImage, size_t uiImageSize)
+		{
+			Entry* pEntries;
+			size_t uiCapacity;
+			size_t uiNumElements;
+
+			IndexedSnapshotResults result = Snapshot::read(pImage, uiImageSize, pEntries,
+				uiCapacity, uiNumElements);
+			if (result != IndexedSnapshotResults::SUCCESS)
+			{
+				return result;
+			}
+			else if (uiCapacity > maxCapacity())
+			{
+				return IndexedSnapshotResults::FAIL_INCOMPATIBLE_IMAGE;
+			}
+
+			releaseStorage();
+
+			m_pElements = uiCapacity != 0 ? pEntries : nullptr;
+			m_uiNumElements = uiNumElements;
+			m_uiMaxElements = uiCapacity;
+			m_bOwnsElements = uiCapacity == 0;
+
+			return IndexedSnapshotResults::SUCCESS;
+		}
+
+		/**
+		Queries whether the indexed vector is using an adopted snapshot image as its storage.
+		@return True if the storage is an adopted image, false otherwise */
+		bool isAdopted() const
+		{
+			return !m_bOwnsElements;
 		}
 
 		/**
@@ -612,11 +963,13 @@ class IndexedVector
 		@return An iterator to the element, or an iterator to the end */
 		Iterator find(const Id& id) const
 		{
-			if (id.uiIndex < m_uiMaxElements)
+			const size_t uiIndex = id.getIndex();
+			if (uiIndex < m_uiMaxElements)
 			{
-				if (m_pElements[id.uiIndex].uiVersionNumber == id.uiVersion)
+				if (m_pElements[uiIndex].bIsActive &&
+					m_pElements[uiIndex].uiVersionNumber == id.getVersion())
 				{
-					return Iterator(&m_pElements[id.uiIndex], id.uiIndex, m_uiMaxElements);
+					return Iterator(&m_pElements[uiIndex], uiIndex, m_uiMaxElements);
 				}
 				else
 				{
@@ -633,13 +986,15 @@ class IndexedVector
 		@param id The id of the element to remove */
 		void remove(const Id& id)
 		{
-			if (id.uiIndex < m_uiMaxElements)
+			const size_t uiIndex = id.getIndex();
+			if (uiIndex < m_uiMaxElements)
 			{
-				if (m_pElements[id.uiIndex].uiVersionNumber == id.uiVersion)
+				if (m_pElements[uiIndex].bIsActive &&
+					m_pElements[uiIndex].uiVersionNumber == id.getVersion())
 				{
-					m_pElements[id.uiIndex].bIsActive = false;
-					++m_pElements[id.uiIndex].uiVersionNumber;
-					m_pElements[id.uiIndex].element = ElementType();
+					m_pElements[uiIndex].bIsActive = false;
+					Versioning::advance(m_pElements[uiIndex].uiVersionNumber);
+					m_pElements[uiIndex].element = ElementType();
 					--m_uiNumElements;
 				}
 			}
@@ -652,7 +1007,7 @@ class IndexedVector
 			for (size_t i = 0; i < m_uiMaxElements; ++i)
 			{
 				m_pElements[i].bIsActive = false;
-				++m_pElements[i].uiVersionNumber;
+				Versioning::advance(m_pElements[i].uiVersionNumber);
 				m_pElements[i].element = ElementType();
 			}
 
@@ -660,7 +1015,8 @@ class IndexedVector
 		}
 
 		/**
-		Clears all elements. Version counters are reset to 0. */
+		Clears all elements. Version counters are reset to 0, which also restores any retired
+		entries. */
 		void reset()
 		{
 			for (size_t i = 0; i < m_uiMaxElements; ++i)
@@ -678,7 +1034,7 @@ class IndexedVector
 		@return An iterator addressing the first element */
 		Iterator begin() const
 		{
-			return Iterator(&m_pElements[0], 0, m_uiMaxElements);
+			return Iterator(m_pElements, 0, m_uiMaxElements);
 		}
 
 		/**
@@ -686,7 +1042,7 @@ class IndexedVector
 		@return An iterator addressing the end element */
 		Iterator end() const
 		{
-			return Iterator(&m_pElements[m_uiMaxElements], m_uiMaxElements, m_uiMaxElements);
+			return Iterator(m_pElements + m_uiMaxElements, m_uiMaxElements, m_uiMaxElements);
 		}
 
 		/**
@@ -694,7 +1050,7 @@ class IndexedVector
 		@return A const iterator addressing the first element */
 		ConstIterator cbegin() const
 		{
-			return ConstIterator(&m_pElements[0], 0, m_uiMaxElements);
+			return ConstIterator(m_pElements, 0, m_uiMaxElements);
 		}
 
 		/**
@@ -702,7 +1058,7 @@ class IndexedVector
 		@return A const iterator addressing the end element */
 		ConstIterator cend() const
 		{
-			return ConstIterator(&m_pElements[m_uiMaxElements], m_uiMaxElements, m_uiMaxElements);
+			return ConstIterator(m_pElements + m_uiMaxElements, m_uiMaxElements, m_uiMaxElements);
 		}
 
 		/**
@@ -759,6 +1115,175 @@ class IndexedVector
 		Entry* m_pElements;
 		size_t m_uiNumElements;
 		size_t m_uiMaxElements;
+		EntryAllocator m_allocator;
+		bool m_bOwnsElements;
+
+		/**
+		Retrieves the largest capacity the id type is able to address.
+		@return The maximum capacity */
+		static size_t maxCapacity()
+		{
+			const size_t uiMaxIndex = Id::uiMaxIndex;
+			return uiMaxIndex == std::numeric_limits<size_t>::max() ? uiMaxIndex : uiMaxIndex + 1;
+		}
+
+		/**
+		Finds an inactive, usable index for a push. The container grows if no such index exists.
+		@param uiIndex Receives the index
+		@return True if an index was found, false if the container could not grow */
+		bool acquireIndex(size_t& uiIndex)
+		{
+			if (m_uiNumElements < m_uiMaxElements)
+			{
+				for (size_t i = 0; i < m_uiMaxElements; ++i)
+				{
+					if (isUsableIndex(i))
+					{
+						uiIndex = i;
+						return true;
+					}
+				}
+			}
+
+			// Expand if possible
+			const size_t uiOldMax = m_uiMaxElements;
+			if (grow())
+			{
+				uiIndex = uiOldMax;
+				return true;
+			}
+
+			return false;
+		}
+
+		/**
+		Doubles the capacity, or grows to the maximum capacity if doubling would exceed it.
+		@return True if the container grew, false if it was already at its maximum capacity or
+		the allocator could not provide the storage */
+		bool grow()
+		{
+			const size_t uiOldMax = m_uiMaxElements;
+			if (uiOldMax >= maxCapacity())
+			{
+				return false;
+			}
+			else if (uiOldMax == 0)
+			{
+				return reallocate(1);
+			}
+
+			return reallocate(uiOldMax <= maxCapacity() / 2 ? uiOldMax * 2 : maxCapacity());
+		}
+
+		/**
+		Queries whether the entry at the given index can be handed out by a push.
+		@param uiIndex The index. Must be less than the capacity
+		@return True if the entry is inactive and has not been retired */
+		bool isUsableIndex(size_t uiIndex) const
+		{
+			return !m_pElements[uiIndex].bIsActive &&
+				Versioning::isUsable(m_pElements[uiIndex].uiVersionNumber);
+		}
+
+		/**
+		Moves all entries into a new buffer of the given capacity. Entries beyond the new capacity
+		are discarded. A capacity of 0 releases the storage.
+		@param uiCapacity The new capacity
+		@return True if the storage was replaced, false if the allocator could not provide it */
+		bool reallocate(size_t uiCapacity)
+		{
+			Entry* pNewElements = allocateEntries(uiCapacity);
+			if (pNewElements == nullptr && uiCapacity != 0)
+			{
+				return false;
+			}
+
+			const size_t uiNumToMove = uiCapacity < m_uiMaxElements ? uiCapacity : m_uiMaxElements;
+			for (size_t ui = 0; ui < uiNumToMove; ++ui)
+			{
+				pNewElements[ui] = std::move(m_pElements[ui]);
+			}
+
+			releaseStorage();
+			m_pElements = pNewElements;
+			m_uiMaxElements = uiCapacity;
+			m_bOwnsElements = true;
+
+			return true;
+		}
+
+		/**
+		Copies the entries of another indexed vector into newly allocated storage. The indexed
+		vector must not hold any storage. It is left empty if the allocator could not provide the
+		storage.
+		@param other The indexed vector to copy */
+		void copyFrom(const Array& other)
+		{
+			m_bOwnsElements = true;
+
+			Entry* pElements = allocateEntries(other.m_uiMaxElements);
+			if (pElements != nullptr)
+			{
+				for (size_t i = 0; i < other.m_uiMaxElements; ++i)
+				{
+					pElements[i] = other.m_pElements[i];
+				}
+
+				m_pElements = pElements;
+				m_uiNumElements = other.m_uiNumElements;
+				m_uiMaxElements = other.m_uiMaxElements;
+			}
+		}
+
+		/**
+		Allocates and default constructs a number of entries.
+		@param uiCount The number of entries
+		@return The entries, or a nullptr if uiCount is 0 or the allocation failed */
+		Entry* allocateEntries(size_t uiCount)
+		{
+			if (uiCount == 0)
+			{
+				return nullptr;
+			}
+
+			Entry* pEntries = EntryAllocatorTraits::allocate(m_allocator, uiCount);
+			if (pEntries != nullptr)
+			{
+				for (size_t i = 0; i < uiCount; ++i)
+				{
+					EntryAllocatorTraits::construct(m_allocator, pEntries + i);
+				}
+			}
+
+			return pEntries;
+		}
+
+		/**
+		Releases the storage unless it is an adopted snapshot image. */
+		void releaseStorage()
+		{
+			if (m_bOwnsElements)
+			{
+				releaseEntries(m_pElements, m_uiMaxElements);
+			}
+		}
+
+		/**
+		Destroys and deallocates entries allocated by allocateEntries.
+		@param pEntries The entries. May be a nullptr
+		@param uiCount The number of entries */
+		void releaseEntries(Entry* pEntries, size_t uiCount)
+		{
+			if (pEntries != nullptr)
+			{
+				for (size_t i = 0; i < uiCount; ++i)
+				{
+					EntryAllocatorTraits::destroy(m_allocator, pEntries + i);
+				}
+
+				EntryAllocatorTraits::deallocate(m_allocator, pEntries, uiCount);
+			}
+		}
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+A lazy initialiser owns a handle to a third party library, such as FreeType, and only initialises
+the library the first time the handle is asked for. Programs that never use the library never pay
+for starting it up, and the library is shut down with the initialiser if it was started.
+
+A failed initialisation is remembered, so the library is not retried on every use. Shutting down
+allows the next use to initialise it again. Retrieving the handle is thread-safe, and costs a
+single atomic load once the library is initialised.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef LAZY_INITIALISER_H
+#define LAZY_INITIALISER_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+template <typename T>
+class LazyInitialiser
+{
+	public:
+		typedef std::function<bool(T&)> InitFunction;
+		typedef std::function<void(T&)> ShutDownFunction;
+
+		/**
+		Constructs an initialiser. Nothing is initialised until the handle is first retrieved.
+		@param initialise Initialises the library, writing its handle. Returns true on success
+		@param shutDown Shuts the library down. May be empty */
+		LazyInitialiser(InitFunction initialise, ShutDownFunction shutDown = ShutDownFunction()) :
+			m_initialise(std::move(initialise)),
+			m_shutDown(std::move(shutDown)),
+			m_handle(),
+			m_state(States::UNINITIALISED)
+		{
+		}
+
+		/**
+		Destructor. Shuts the library down if it was initialised. */
+		~LazyInitialiser()
+		{
+			shutDown();
+		}
+
+		LazyInitialiser(const LazyInitialiser& other) = delete;
+		LazyInitialiser& operator=(const LazyInitialiser& other) = delete;
+
+		/**
+		Retrieves the handle, initialising the library if this is the first use.
+		@return The handle, or nullptr if the library failed to initialise */
+		T* get()
+		{
+			if (m_state.load(std::memory_order_acquire) == States::INITIALISED)
+			{
+				return &m_handle;
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_state.load(std::memory_order_relaxed) == States::UNINITIALISED)
+			{
+				m_state.store(m_initialise(m_handle) ? States::INITIALISED : States::FAILED,
+					std::memory_order_release);
+			}
+
+			return m_state.load(std::memory_order_relaxed) == States::INITIALISED ? &m_handle :
+				nullptr;
+		}
+
+		/**
+		Shuts the library down if it was initialised, and forgets any failure. Must not be called
+		while the handle is in use.
+		@return True if the library had been initialised */
+		bool shutDown()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			const States state = m_state.load(std::memory_order_relaxed);
+			if (state == States::INITIALISED && m_shutDown)
+			{
+				m_shutDown(m_handle);
+			}
+
+			m_handle = T();
+			m_state.store(States::UNINITIALISED, std::memory_order_release);
+			return state == States::INITIALISED;
+		}
+
+		/**
+		Queries whether the library is initialised.
+		@return True if the library is initialised, false if it is not or failed to */
+		bool isInitialised() const
+		{
+			return m_state.load(std::memory_order_acquire) == States::INITIALISED;
+		}
+
+	protected:
+
+	private:
+		enum class States
+		{
+			UNINITIALISED,
+			INITIALISED,
+			FAILED
+		};
+
+		InitFunction m_initialise;
+		ShutDownFunction m_shutDown;
+		T m_handle;
+		std::atomic<States> m_state;
+		std::mutex m_mutex;
+};
+
+#endif
@@ -0,0 +1,911 @@
+#include "Engine/System/Tools/NoiseGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "Engine/System/Tools/RandomEngines.h"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#endif
+
+namespace
+{
+	/**
+	Scales that bring each octave of gradient noise to roughly -1 to 1. */
+	const float fPerlinScale2 = 0.66f;
+	const float fPerlinScale3 = 1.0f;
+	const float fPerlinScale4 = 0.93f;
+	const float fSimplexScale2 = 45.0f;
+	const float fSimplexScale3 = 32.0f;
+	const float fSimplexScale4 = 27.0f;
+
+	/**
+	Eases an offset in to a lattice cell so that the noise is smooth across cell boundaries.
+	@param fT The offset, from 0 to 1
+	@return The interpolation weight */
+	float fade(float fT)
+	{
+		return fT * fT * fT * (fT * (fT * 6.0f - 15.0f) + 10.0f);
+	}
+
+	/**
+	Interpolates between two values.
+	@param fT The weight of the second value
+	@param fA The first value
+	@param fB The second value
+	@return The interpolated value */
+	float lerp(float fT, float fA, float fB)
+	{
+		return fA + fT * (fB - fA);
+	}
+
+	/**
+	Picks a gradient from a hash and projects an offset on to it. The gradients are those of
+	Perlin's improved noise, extended to 2D and 4D by Stefan Gustavson.
+	@param iHash The hash
+	@param fX The x offset
+	@param fY The y offset
+	@return The dot product of the gradient and the offset */
+	float gradient(std::int32_t iHash, float fX, float fY)
+	{
+		const std::int32_t iLow = iHash & 7;
+		const float fU = iLow < 4 ? fX : fY;
+		const float fV = iLow < 4 ? fY : fX;
+		return ((iLow & 1) != 0 ? -fU : fU) + ((iLow & 2) != 0 ? -2.0f * fV : 2.0f * fV);
+	}
+
+	float gradient(std::int32_t iHash, float fX, float fY, float fZ)
+	{
+		const std::int32_t iLow = iHash & 15;
+		const float fU = iLow < 8 ? fX : fY;
+		const float fV = iLow < 4 ? fY : (iLow == 12 || iLow == 14 ? fX : fZ);
+		return ((iLow & 1) != 0 ? -fU : fU) + ((iLow & 2) != 0 ? -fV : fV);
+	}
+
+	float gradient(std::int32_t iHash, float fX, float fY, float fZ, float fW)
+	{
+		const std::int32_t iLow = iHash & 31;
+		const float fU = iLow < 24 ? fX : fY;
+		const float fV = iLow < 16 ? fY : fZ;
+		const float fT = iLow < 8 ? fZ : fW;
+		return ((iLow & 1) != 0 ? -fU : fU) + ((iLow & 2) != 0 ? -fV : fV) +
+			((iLow & 4) != 0 ? -fT : fT);
+	}
+
+	float gradient(std::int32_t iHash, const float* pOffset, size_t uiDimensions)
+	{
+		switch (uiDimensions)
+		{
+			case 2:
+				return gradient(iHash, pOffset[0], pOffset[1]);
+			case 3:
+				return gradient(iHash, pOffset[0], pOffset[1], pOffset[2]);
+			default:
+				return gradient(iHash, pOffset[0], pOffset[1], pOffset[2], pOffset[3]);
+		}
+	}
+
+	/**
+	Evaluates Perlin or value noise, which both interpolate between the corners of the lattice
+	cell holding the point.
+	@param pPermutation The permutation table
+	@param pPoint The coordinates of the point
+	@return The unscaled noise value */
+	template <size_t Dimensions, bool bGradient>
+	float latticeNoise(const std::int32_t* pPermutation, const float* pPoint)
+	{
+		const size_t uiNumCorners = (size_t)1 << Dimensions;
+
+		std::int32_t iCell[Dimensions];
+		float fOffset[Dimensions];
+		float fWeight[Dimensions];
+		for (size_t d = 0; d < Dimensions; ++d)
+		{
+			const float fFloor = std::floor(pPoint[d]);
+			iCell[d] = (std::int32_t)fFloor & 255;
+			fOffset[d] = pPoint[d] - fFloor;
+			fWeight[d] = fade(fOffset[d]);
+		}
+
+		// Bit d of a corner's index is set if the corner is at the far side of dimension d
+		float fCorners[uiNumCorners];
+		for (size_t uiCorner = 0; uiCorner < uiNumCorners; ++uiCorner)
+		{
+			std::int32_t iHash = 0;
+			float fCornerOffset[Dimensions];
+			for (size_t d = 0; d < Dimensions; ++d)
+			{
+				const std::int32_t iBit = (std::int32_t)(uiCorner >> d) & 1;
+				iHash = pPermutation[iHash + iCell[d] + iBit];
+				fCornerOffset[d] = fOffset[d] - (float)iBit;
+			}
+
+			fCorners[uiCorner] = bGradient ? gradient(iHash, fCornerOffset, Dimensions) :
+				(float)iHash * (1.0f / 127.5f) - 1.0f;
+		}
+
+		// Collapse one dimension at a time
+		for (size_t d = 0; d < Dimensions; ++d)
+		{
+			const size_t uiRemaining = uiNumCorners >> (d + 1);
+			for (size_t uiCorner = 0; uiCorner < uiRemaining; ++uiCorner)
+			{
+				fCorners[uiCorner] = lerp(fWeight[d], fCorners[uiCorner * 2],
+					fCorners[uiCorner * 2 + 1]);
+			}
+		}
+
+		return fCorners[0];
+	}
+
+	/**
+	Evaluates Worley noise.
+	@param pPermutation The permutation table
+	@param pPoint The coordinates of the point
+	@return The distance to the nearest feature point */
+	template <size_t Dimensions>
+	float worleyNoise(const std::int32_t* pPermutation, const float* pPoint)
+	{
+		std::int32_t iCell[Dimensions];
+		float fOffset[Dimensions];
+		size_t uiNumNeighbours = 1;
+		for (size_t d = 0; d < Dimensions; ++d)
+		{
+			const float fFloor = std::floor(pPoint[d]);
+			iCell[d] = (std::int32_t)fFloor;
+			fOffset[d] = pPoint[d] - fFloor;
+			uiNumNeighbours *= 3;
+		}
+
+		// The nearest feature point is always in this cell or one of its neighbours
+		float fNearest = 1e30f;
+		for (size_t uiNeighbour = 0; uiNeighbour < uiNumNeighbours; ++uiNeighbour)
+		{
+			std::int32_t iDelta[Dimensions];
+			std::int32_t iHash = 0;
+			size_t uiRemainder = uiNeighbour;
+			for (size_t d = 0; d < Dimensions; ++d)
+			{
+				iDelta[d] = (std::int32_t)(uiRemainder % 3) - 1;
+				uiRemainder /= 3;
+				iHash = pPermutation[iHash + ((iCell[d] + iDelta[d]) & 255)];
+			}
+
+			float fDistance = 0.0f;
+			for (size_t d = 0; d < Dimensions; ++d)
+			{
+				const float fFeature = (float)iDelta[d] +
+					((float)pPermutation[iHash + d] + 0.5f) * (1.0f / 256.0f);
+				const float fDifference = fFeature - fOffset[d];
+				fDistance += fDifference * fDifference;
+			}
+
+			fNearest = std::min(fNearest, fDistance);
+		}
+
+		return std::sqrt(fNearest);
+	}
+
+	/**
+	Calls a noise generator's single octave functions once per point. */
+	template <typename Noise>
+	void evaluateEach(const Noise& noise, const float* const* ppCoordinates, size_t uiDimensions,
+		float* pValues, size_t uiCount)
+	{
+		const float* pX = ppCoordinates[0];
+		const float* pY = ppCoordinates[1];
+		const float* pZ = ppCoordinates[2];
+		const float* pW = ppCoordinates[3];
+		switch (uiDimensions)
+		{
+			case 2:
+				for (size_t i = 0; i < uiCount; ++i)
+				{
+					pValues[i] = noise(pX[i], pY[i]);
+				}
+				break;
+			case 3:
+				for (size_t i = 0; i < uiCount; ++i)
+				{
+					pValues[i] = noise(pX[i], pY[i], pZ[i]);
+				}
+				break;
+			default:
+				for (size_t i = 0; i < uiCount; ++i)
+				{
+					pValues[i] = noise(pX[i], pY[i], pZ[i], pW[i]);
+				}
+				break;
+		}
+	}
+
+	struct PerlinFunction
+	{
+		const NoiseGenerator& generator;
+
+		template <typename... Coordinates>
+		float operator()(Coordinates... fCoordinates) const
+		{
+			return generator.perlin(fCoordinates...);
+		}
+	};
+
+	struct SimplexFunction
+	{
+		const NoiseGenerator& generator;
+
+		template <typename... Coordinates>
+		float operator()(Coordinates... fCoordinates) const
+		{
+			return generator.simplex(fCoordinates...);
+		}
+	};
+
+	struct ValueFunction
+	{
+		const NoiseGenerator& generator;
+
+		template <typename... Coordinates>
+		float operator()(Coordinates... fCoordinates) const
+		{
+			return generator.value(fCoordinates...);
+		}
+	};
+
+	struct WorleyFunction
+	{
+		const NoiseGenerator& generator;
+
+		template <typename... Coordinates>
+		float operator()(Coordinates... fCoordinates) const
+		{
+			return generator.worley(fCoordinates...);
+		}
+	};
+
+#if defined(__AVX2__)
+	/**
+	Splits eight coordinates in to lattice cells, offsets and interpolation weights.
+	@param coordinate The coordinates
+	@param cell The cells, from 0 to 255
+	@param offset The offsets in to the cells
+	@param weight The interpolation weights */
+	void splitCoordinates(__m256 coordinate, __m256i& cell, __m256& offset, __m256& weight)
+	{
+		const __m256 floor = _mm256_floor_ps(coordinate);
+		cell = _mm256_and_si256(_mm256_cvttps_epi32(floor), _mm256_set1_epi32(255));
+		offset = _mm256_sub_ps(coordinate, floor);
+
+		const __m256 cubed = _mm256_mul_ps(_mm256_mul_ps(offset, offset), offset);
+		const __m256 inner = _mm256_add_ps(_mm256_mul_ps(offset,
+			_mm256_sub_ps(_mm256_mul_ps(offset, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))),
+			_mm256_set1_ps(10.0f));
+		weight = _mm256_mul_ps(cubed, inner);
+	}
+
+	__m256 lerp(__m256 t, __m256 a, __m256 b)
+	{
+		return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+	}
+
+	/**
+	Negates the lanes of a value where a bit of the hash is set.
+	@param value The value
+	@param hash The hashes
+	@return The value with the selected lanes negated */
+	template <int iBit>
+	__m256 negateWhere(__m256 value, __m256i hash)
+	{
+		const __m256i bit = _mm256_and_si256(hash, _mm256_set1_epi32(1 << iBit));
+		const __m256i sign = _mm256_slli_epi32(bit, 31 - iBit);
+		return _mm256_xor_ps(value, _mm256_castsi256_ps(sign));
+	}
+
+	/**
+	Selects between two values by comparing hashes with a constant.
+	@param hash The hashes
+	@param iLimit The constant
+	@param below The value for lanes where the hash is below the constant
+	@param other The value for the other lanes
+	@return The selected values */
+	__m256 selectBelow(__m256i hash, int iLimit, __m256 below, __m256 other)
+	{
+		const __m256 mask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(iLimit),
+			hash));
+		return _mm256_blendv_ps(other, below, mask);
+	}
+
+	__m256 gradient(__m256i hash, __m256 x, __m256 y)
+	{
+		const __m256i low = _mm256_and_si256(hash, _mm256_set1_epi32(7));
+		const __m256 u = selectBelow(low, 4, x, y);
+		const __m256 v = selectBelow(low, 4, y, x);
+		return _mm256_add_ps(negateWhere<0>(u, low),
+			negateWhere<1>(_mm256_mul_ps(_mm256_set1_ps(2.0f), v), low));
+	}
+
+	__m256 gradient(__m256i hash, __m256 x, __m256 y, __m256 z)
+	{
+		const __m256i low = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+		const __m256 twelveOrFourteen = _mm256_castsi256_ps(_mm256_or_si256(
+			_mm256_cmpeq_epi32(low, _mm256_set1_epi32(12)),
+			_mm256_cmpeq_epi32(low, _mm256_set1_epi32(14))));
+		const __m256 u = selectBelow(low, 8, x, y);
+		const __m256 v = selectBelow(low, 4, y, _mm256_blendv_ps(z, x, twelveOrFourteen));
+		return _mm256_add_ps(negateWhere<0>(u, low), negateWhere<1>(v, low));
+	}
+
+	__m256i gather(const std::int32_t* pPermutation, __m256i index)
+	{
+		return _mm256_i32gather_epi32((const int*)pPermutation, index, 4);
+	}
+#endif
+}
+
+const size_t NoiseGenerator::uiBlockSize;
+
+NoiseGenerator::NoiseGenerator(std::uint64_t uiSeed, NoiseTypes type,
+	const NoiseFractal& fractal) :
+	m_type(type),
+	m_fractal(fractal)
+{
+	seed(uiSeed);
+}
+
+void NoiseGenerator::seed(std::uint64_t uiSeed)
+{
+	m_uiSeed = uiSeed;
+	for (std::int32_t i = 0; i < 256; ++i)
+	{
+		m_iPermutation[i] = i;
+	}
+
+	// Fisher-Yates shuffle, with the same engine and bounding on every platform
+	Xoshiro256StarStarEngine engine(uiSeed);
+	for (std::uint32_t i = 255; i > 0; --i)
+	{
+		const std::uint32_t uiSwap = (std::uint32_t)(((engine() >> 32) * (i + 1)) >> 32);
+		std::swap(m_iPermutation[i], m_iPermutation[uiSwap]);
+	}
+
+	std::copy(m_iPermutation, m_iPermutation + 256, m_iPermutation + 256);
+}
+
+std::uint64_t NoiseGenerator::getSeed() const
+{
+	return m_uiSeed;
+}
+
+void NoiseGenerator::setType(NoiseTypes type)
+{
+	m_type = type;
+}
+
+NoiseTypes NoiseGenerator::getType() const
+{
+	return m_type;
+}
+
+void NoiseGenerator::setFractal(const NoiseFractal& fractal)
+{
+	m_fractal = fractal;
+}
+
+const NoiseFractal& NoiseGenerator::getFractal() const
+{
+	return m_fractal;
+}
+
+float NoiseGenerator::evaluate(float fX, float fY) const
+{
+	float fValue;
+	evaluate(&fX, &fY, &fValue, 1);
+	return fValue;
+}
+
+float NoiseGenerator::evaluate(float fX, float fY, float fZ) const
+{
+	float fValue;
+	evaluate(&fX, &fY, &fZ, &fValue, 1);
+	return fValue;
+}
+
+float NoiseGenerator::evaluate(float fX, float fY, float fZ, float fW) const
+{
+	float fValue;
+	evaluate(&fX, &fY, &fZ, &fW, &fValue, 1);
+	return fValue;
+}
+
+void NoiseGenerator::evaluate(const float* pX, const float* pY, float* pValues,
+	size_t uiCount) const
+{
+	for (size_t uiStart = 0; uiStart < uiCount; uiStart += uiBlockSize)
+	{
+		const float* ppCoordinates[4] = { pX + uiStart, pY + uiStart, nullptr, nullptr };
+		evaluateBlock(ppCoordinates, 2, pValues + uiStart,
+			std::min(uiBlockSize, uiCount - uiStart));
+	}
+}
+
+void NoiseGenerator::evaluate(const float* pX, const float* pY, const float* pZ,
+	float* pValues, size_t uiCount) const
+{
+	for (size_t uiStart = 0; uiStart < uiCount; uiStart += uiBlockSize)
+	{
+		const float* ppCoordinates[4] = { pX + uiStart, pY + uiStart, pZ + uiStart, nullptr };
+		evaluateBlock(ppCoordinates, 3, pValues + uiStart,
+			std::min(uiBlockSize, uiCount - uiStart));
+	}
+}
+
+void NoiseGenerator::evaluate(const float* pX, const float* pY, const float* pZ,
+	const float* pW, float* pValues, size_t uiCount) const
+{
+	for (size_t uiStart = 0; uiStart < uiCount; uiStart += uiBlockSize)
+	{
+		const float* ppCoordinates[4] = { pX + uiStart, pY + uiStart, pZ + uiStart,
+			pW + uiStart };
+		evaluateBlock(ppCoordinates, 4, pValues + uiStart,
+			std::min(uiBlockSize, uiCount - uiStart));
+	}
+}
+
+void NoiseGenerator::evaluateGrid(float fX, float fY, float fStep, size_t uiWidth,
+	size_t uiHeight, float* pValues) const
+{
+	evaluateSlices(fX, fY, 0.0f, fStep, uiWidth, uiHeight, 1, 2, pValues);
+}
+
+void NoiseGenerator::evaluateGrid(float fX, float fY, float fZ, float fStep, size_t uiWidth,
+	size_t uiHeight, size_t uiDepth, float* pValues) const
+{
+	evaluateSlices(fX, fY, fZ, fStep, uiWidth, uiHeight, uiDepth, 3, pValues);
+}
+
+float NoiseGenerator::perlin(float fX, float fY) const
+{
+	const float fPoint[2] = { fX, fY };
+	return fPerlinScale2 * latticeNoise<2, true>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::perlin(float fX, float fY, float fZ) const
+{
+	const float fPoint[3] = { fX, fY, fZ };
+	return fPerlinScale3 * latticeNoise<3, true>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::perlin(float fX, float fY, float fZ, float fW) const
+{
+	const float fPoint[4] = { fX, fY, fZ, fW };
+	return fPerlinScale4 * latticeNoise<4, true>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::simplex(float fX, float fY) const
+{
+	const float fSkew = 0.366025403f;
+	const float fUnskew = 0.211324865f;
+
+	// Find the simplex cell holding the point, and the point's offset from the cell's origin
+	const float fSkewed = (fX + fY) * fSkew;
+	const std::int32_t iI = (std::int32_t)std::floor(fX + fSkewed);
+	const std::int32_t iJ = (std::int32_t)std::floor(fY + fSkewed);
+	const float fUnskewed = (float)(iI + iJ) * fUnskew;
+	const float fX0 = fX - ((float)iI - fUnskewed);
+	const float fY0 = fY - ((float)iJ - fUnskewed);
+
+	// The middle corner depends on which half of the square the point is in
+	const std::int32_t iI1 = fX0 > fY0 ? 1 : 0;
+	const std::int32_t iJ1 = 1 - iI1;
+
+	const float fOffsets[3][2] = {
+		{ fX0, fY0 },
+		{ fX0 - (float)iI1 + fUnskew, fY0 - (float)iJ1 + fUnskew },
+		{ fX0 - 1.0f + 2.0f * fUnskew, fY0 - 1.0f + 2.0f * fUnskew } };
+	const std::int32_t iII = iI & 255;
+	const std::int32_t iJJ = iJ & 255;
+	const std::int32_t iHashes[3] = {
+		permute(iII + permute(iJJ)),
+		permute(iII + iI1 + permute(iJJ + iJ1)),
+		permute(iII + 1 + permute(iJJ + 1)) };
+
+	float fTotal = 0.0f;
+	for (int iCorner = 0; iCorner < 3; ++iCorner)
+	{
+		const float fX1 = fOffsets[iCorner][0];
+		const float fY1 = fOffsets[iCorner][1];
+		float fT = 0.5f - fX1 * fX1 - fY1 * fY1;
+		if (fT > 0.0f)
+		{
+			fT *= fT;
+			fTotal += fT * fT * gradient(iHashes[iCorner], fX1, fY1);
+		}
+	}
+
+	return fSimplexScale2 * fTotal;
+}
+
+float NoiseGenerator::simplex(float fX, float fY, float fZ) const
+{
+	const float fSkew = 1.0f / 3.0f;
+	const float fUnskew = 1.0f / 6.0f;
+
+	const float fSkewed = (fX + fY + fZ) * fSkew;
+	const std::int32_t iI = (std::int32_t)std::floor(fX + fSkewed);
+	const std::int32_t iJ = (std::int32_t)std::floor(fY + fSkewed);
+	const std::int32_t iK = (std::int32_t)std::floor(fZ + fSkewed);
+	const float fUnskewed = (float)(iI + iJ + iK) * fUnskew;
+	const float fX0 = fX - ((float)iI - fUnskewed);
+	const float fY0 = fY - ((float)iJ - fUnskewed);
+	const float fZ0 = fZ - ((float)iK - fUnskewed);
+
+	// The order of the offsets picks which of the six tetrahedra in the cube holds the point
+	std::int32_t iI1, iJ1, iK1, iI2, iJ2, iK2;
+	if (fX0 >= fY0)
+	{
+		if (fY0 >= fZ0)
+		{
+			iI1 = 1; iJ1 = 0; iK1 = 0; iI2 = 1; iJ2 = 1; iK2 = 0;
+		}
+		else if (fX0 >= fZ0)
+		{
+			iI1 = 1; iJ1 = 0; iK1 = 0; iI2 = 1; iJ2 = 0; iK2 = 1;
+		}
+		else
+		{
+			iI1 = 0; iJ1 = 0; iK1 = 1; iI2 = 1; iJ2 = 0; iK2 = 1;
+		}
+	}
+	else
+	{
+		if (fY0 < fZ0)
+		{
+			iI1 = 0; iJ1 = 0; iK1 = 1; iI2 = 0; iJ2 = 1; iK2 = 1;
+		}
+		else if (fX0 < fZ0)
+		{
+			iI1 = 0; iJ1 = 1; iK1 = 0; iI2 = 0; iJ2 = 1; iK2 = 1;
+		}
+		else
+		{
+			iI1 = 0; iJ1 = 1; iK1 = 0; iI2 = 1; iJ2 = 1; iK2 = 0;
+		}
+	}
+
+	const float fOffsets[4][3] = {
+		{ fX0, fY0, fZ0 },
+		{ fX0 - (float)iI1 + fUnskew, fY0 - (float)iJ1 + fUnskew, fZ0 - (float)iK1 + fUnskew },
+		{ fX0 - (float)iI2 + 2.0f * fUnskew, fY0 - (float)iJ2 + 2.0f * fUnskew,
+			fZ0 - (float)iK2 + 2.0f * fUnskew },
+		{ fX0 - 1.0f + 3.0f * fUnskew, fY0 - 1.0f + 3.0f * fUnskew,
+			fZ0 - 1.0f + 3.0f * fUnskew } };
+	const std::int32_t iII = iI & 255;
+	const std::int32_t iJJ = iJ & 255;
+	const std::int32_t iKK = iK & 255;
+	const std::int32_t iHashes[4] = {
+		permute(iII + permute(iJJ + permute(iKK))),
+		permute(iII + iI1 + permute(iJJ + iJ1 + permute(iKK + iK1))),
+		permute(iII + iI2 + permute(iJJ + iJ2 + permute(iKK + iK2))),
+		permute(iII + 1 + permute(iJJ + 1 + permute(iKK + 1))) };
+
+	float fTotal = 0.0f;
+	for (int iCorner = 0; iCorner < 4; ++iCorner)
+	{
+		const float* pOffset = fOffsets[iCorner];
+		float fT = 0.6f - pOffset[0] * pOffset[0] - pOffset[1] * pOffset[1] -
+			pOffset[2] * pOffset[2];
+		if (fT > 0.0f)
+		{
+			fT *= fT;
+			fTotal += fT * fT * gradient(iHashes[iCorner], pOffset[0], pOffset[1], pOffset[2]);
+		}
+	}
+
+	return fSimplexScale3 * fTotal;
+}
+
+float NoiseGenerator::simplex(float fX, float fY, float fZ, float fW) const
+{
+	const float fSkew = 0.309016994f;
+	const float fUnskew = 0.138196601f;
+
+	const float fPoint[4] = { fX, fY, fZ, fW };
+	const float fSkewed = (fX + fY + fZ + fW) * fSkew;
+	std::int32_t iCell[4];
+	std::int32_t iCellSum = 0;
+	for (int d = 0; d < 4; ++d)
+	{
+		iCell[d] = (std::int32_t)std::floor(fPoint[d] + fSkewed);
+		iCellSum += iCell[d];
+	}
+
+	const float fUnskewed = (float)iCellSum * fUnskew;
+	float fOffset0[4];
+	for (int d = 0; d < 4; ++d)
+	{
+		fOffset0[d] = fPoint[d] - ((float)iCell[d] - fUnskewed);
+	}
+
+	// Rank the offsets. The largest is stepped along first, and so on
+	std::int32_t iRank[4] = { 0, 0, 0, 0 };
+	for (int d = 0; d < 4; ++d)
+	{
+		for (int e = d + 1; e < 4; ++e)
+		{
+			if (fOffset0[d] > fOffset0[e])
+			{
+				++iRank[d];
+			}
+			else
+			{
+				++iRank[e];
+			}
+		}
+	}
+
+	float fTotal = 0.0f;
+	for (std::int32_t iCorner = 0; iCorner < 5; ++iCorner)
+	{
+		std::int32_t iStep[4];
+		float fOffset[4];
+		float fT = 0.6f;
+		for (int d = 0; d < 4; ++d)
+		{
+			iStep[d] = iRank[d] >= 4 - iCorner ? 1 : 0;
+			fOffset[d] = fOffset0[d] - (float)iStep[d] + (float)iCorner * fUnskew;
+			fT -= fOffset[d] * fOffset[d];
+		}
+
+		if (fT > 0.0f)
+		{
+			const std::int32_t iHash = permute((iCell[0] & 255) + iStep[0] +
+				permute((iCell[1] & 255) + iStep[1] +
+				permute((iCell[2] & 255) + iStep[2] +
+				permute((iCell[3] & 255) + iStep[3]))));
+			fT *= fT;
+			fTotal += fT * fT * gradient(iHash, fOffset[0], fOffset[1], fOffset[2], fOffset[3]);
+		}
+	}
+
+	return fSimplexScale4 * fTotal;
+}
+
+float NoiseGenerator::value(float fX, float fY) const
+{
+	const float fPoint[2] = { fX, fY };
+	return latticeNoise<2, false>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::value(float fX, float fY, float fZ) const
+{
+	const float fPoint[3] = { fX, fY, fZ };
+	return latticeNoise<3, false>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::value(float fX, float fY, float fZ, float fW) const
+{
+	const float fPoint[4] = { fX, fY, fZ, fW };
+	return latticeNoise<4, false>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::worley(float fX, float fY) const
+{
+	const float fPoint[2] = { fX, fY };
+	return worleyNoise<2>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::worley(float fX, float fY, float fZ) const
+{
+	const float fPoint[3] = { fX, fY, fZ };
+	return worleyNoise<3>(m_iPermutation, fPoint);
+}
+
+float NoiseGenerator::worley(float fX, float fY, float fZ, float fW) const
+{
+	const float fPoint[4] = { fX, fY, fZ, fW };
+	return worleyNoise<4>(m_iPermutation, fPoint);
+}
+
+void NoiseGenerator::evaluateSlices(float fX, float fY, float fZ, float fStep, size_t uiWidth,
+	size_t uiHeight, size_t uiDepth, size_t uiDimensions, float* pValues) const
+{
+	float fXs[uiBlockSize];
+	float fYs[uiBlockSize];
+	float fZs[uiBlockSize];
+	const float* ppCoordinates[4] = { fXs, fYs, fZs, nullptr };
+
+	for (size_t uiSlice = 0; uiSlice < uiDepth; ++uiSlice)
+	{
+		std::fill(fZs, fZs + uiBlockSize, fZ + (float)uiSlice * fStep);
+		for (size_t uiRow = 0; uiRow < uiHeight; ++uiRow)
+		{
+			std::fill(fYs, fYs + uiBlockSize, fY + (float)uiRow * fStep);
+			for (size_t uiStart = 0; uiStart < uiWidth; uiStart += uiBlockSize)
+			{
+				const size_t uiCount = std::min(uiBlockSize, uiWidth - uiStart);
+				for (size_t i = 0; i < uiCount; ++i)
+				{
+					fXs[i] = fX + (float)(uiStart + i) * fStep;
+				}
+
+				evaluateBlock(ppCoordinates, uiDimensions, pValues + uiStart, uiCount);
+			}
+
+			pValues += uiWidth;
+		}
+	}
+}
+
+void NoiseGenerator::evaluateBlock(const float* const* ppCoordinates, size_t uiDimensions,
+	float* pValues, size_t uiCount) const
+{
+	const std::uint32_t uiOctaves = std::max(m_fractal.uiOctaves, 1u);
+	if (uiOctaves == 1 && m_fractal.fFrequency == 1.0f)
+	{
+		evaluateOctave(ppCoordinates, uiDimensions, pValues, uiCount);
+		return;
+	}
+
+	float fScaled[4][uiBlockSize];
+	float fOctave[uiBlockSize];
+	const float* ppScaled[4] = { fScaled[0], fScaled[1], fScaled[2], fScaled[3] };
+
+	std::fill(pValues, pValues + uiCount, 0.0f);
+	float fFrequency = m_fractal.fFrequency;
+	float fAmplitude = 1.0f;
+	float fTotalAmplitude = 0.0f;
+	for (std::uint32_t uiOctave = 0; uiOctave < uiOctaves; ++uiOctave)
+	{
+		for (size_t d = 0; d < uiDimensions; ++d)
+		{
+			for (size_t i = 0; i < uiCount; ++i)
+			{
+				fScaled[d][i] = ppCoordinates[d][i] * fFrequency;
+			}
+		}
+
+		evaluateOctave(ppScaled, uiDimensions, fOctave, uiCount);
+		for (size_t i = 0; i < uiCount; ++i)
+		{
+			pValues[i] += fOctave[i] * fAmplitude;
+		}
+
+		fTotalAmplitude += fAmplitude;
+		fAmplitude *= m_fractal.fGain;
+		fFrequency *= m_fractal.fLacunarity;
+	}
+
+	const float fNormalise = 1.0f / fTotalAmplitude;
+	for (size_t i = 0; i < uiCount; ++i)
+	{
+		pValues[i] *= fNormalise;
+	}
+}
+
+void NoiseGenerator::evaluateOctave(const float* const* ppCoordinates, size_t uiDimensions,
+	float* pValues, size_t uiCount) const
+{
+	switch (m_type)
+	{
+		case NoiseTypes::PERLIN:
+			if (uiDimensions == 2)
+			{
+				perlinBatch(ppCoordinates[0], ppCoordinates[1], pValues, uiCount);
+			}
+			else if (uiDimensions == 3)
+			{
+				perlinBatch(ppCoordinates[0], ppCoordinates[1], ppCoordinates[2], pValues,
+					uiCount);
+			}
+			else
+			{
+				evaluateEach(PerlinFunction{ *this }, ppCoordinates, uiDimensions, pValues,
+					uiCount);
+			}
+			break;
+		case NoiseTypes::SIMPLEX:
+			evaluateEach(SimplexFunction{ *this }, ppCoordinates, uiDimensions, pValues, uiCount);
+			break;
+		case NoiseTypes::VALUE:
+			evaluateEach(ValueFunction{ *this }, ppCoordinates, uiDimensions, pValues, uiCount);
+			break;
+		case NoiseTypes::WORLEY:
+			evaluateEach(WorleyFunction{ *this }, ppCoordinates, uiDimensions, pValues, uiCount);
+			break;
+	}
+}
+
+void NoiseGenerator::perlinBatch(const float* pX, const float* pY, float* pValues,
+	size_t uiCount) const
+{
+	size_t i = 0;
+#if defined(__AVX2__)
+	// The same steps as latticeNoise, eight points at a time
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256i next = _mm256_set1_epi32(1);
+	for (; i + 8 <= uiCount; i += 8)
+	{
+		__m256i cellX, cellY;
+		__m256 x, y, u, v;
+		splitCoordinates(_mm256_loadu_ps(pX + i), cellX, x, u);
+		splitCoordinates(_mm256_loadu_ps(pY + i), cellY, y, v);
+
+		const __m256i a = _mm256_add_epi32(gather(m_iPermutation, cellX), cellY);
+		const __m256i b = _mm256_add_epi32(gather(m_iPermutation,
+			_mm256_add_epi32(cellX, next)), cellY);
+		const __m256 x1 = _mm256_sub_ps(x, one);
+		const __m256 y1 = _mm256_sub_ps(y, one);
+
+		const __m256 n00 = gradient(gather(m_iPermutation, a), x, y);
+		const __m256 n10 = gradient(gather(m_iPermutation, b), x1, y);
+		const __m256 n01 = gradient(gather(m_iPermutation, _mm256_add_epi32(a, next)),
+			x, y1);
+		const __m256 n11 = gradient(gather(m_iPermutation, _mm256_add_epi32(b, next)),
+			x1, y1);
+
+		const __m256 result = lerp(v, lerp(u, n00, n10), lerp(u, n01, n11));
+		_mm256_storeu_ps(pValues + i, _mm256_mul_ps(_mm256_set1_ps(fPerlinScale2), result));
+	}
+#endif
+
+	for (; i < uiCount; ++i)
+	{
+		pValues[i] = perlin(pX[i], pY[i]);
+	}
+}
+
+void NoiseGenerator::perlinBatch(const float* pX, const float* pY, const float* pZ,
+	float* pValues, size_t uiCount) const
+{
+	size_t i = 0;
+#if defined(__AVX2__)
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256i next = _mm256_set1_epi32(1);
+	for (; i + 8 <= uiCount; i += 8)
+	{
+		__m256i cellX, cellY, cellZ;
+		__m256 x, y, z, u, v, w;
+		splitCoordinates(_mm256_loadu_ps(pX + i), cellX, x, u);
+		splitCoordinates(_mm256_loadu_ps(pY + i), cellY, y, v);
+		splitCoordinates(_mm256_loadu_ps(pZ + i), cellZ, z, w);
+
+		const __m256i a = _mm256_add_epi32(gather(m_iPermutation, cellX), cellY);
+		const __m256i b = _mm256_add_epi32(gather(m_iPermutation,
+			_mm256_add_epi32(cellX, next)), cellY);
+		const __m256i aa = _mm256_add_epi32(gather(m_iPermutation, a), cellZ);
+		const __m256i ba = _mm256_add_epi32(gather(m_iPermutation, b), cellZ);
+		const __m256i ab = _mm256_add_epi32(gather(m_iPermutation, _mm256_add_epi32(a, next)),
+			cellZ);
+		const __m256i bb = _mm256_add_epi32(gather(m_iPermutation, _mm256_add_epi32(b, next)),
+			cellZ);
+		const __m256 x1 = _mm256_sub_ps(x, one);
+		const __m256 y1 = _mm256_sub_ps(y, one);
+		const __m256 z1 = _mm256_sub_ps(z, one);
+
+		const __m256 n000 = gradient(gather(m_iPermutation, aa), x, y, z);
+		const __m256 n100 = gradient(gather(m_iPermutation, ba), x1, y, z);
+		const __m256 n010 = gradient(gather(m_iPermutation, ab), x, y1, z);
+		const __m256 n110 = gradient(gather(m_iPermutation, bb), x1, y1, z);
+		const __m256 n001 = gradient(gather(m_iPermutation, _mm256_add_epi32(aa, next)),
+			x, y, z1);
+		const __m256 n101 = gradient(gather(m_iPermutation, _mm256_add_epi32(ba, next)),
+			x1, y, z1);
+		const __m256 n011 = gradient(gather(m_iPermutation, _mm256_add_epi32(ab, next)),
+			x, y1, z1);
+		const __m256 n111 = gradient(gather(m_iPermutation, _mm256_add_epi32(bb, next)),
+			x1, y1, z1);
+
+		const __m256 result = lerp(w,
+			lerp(v, lerp(u, n000, n100), lerp(u, n010, n110)),
+			lerp(v, lerp(u, n001, n101), lerp(u, n011, n111)));
+		_mm256_storeu_ps(pValues + i, _mm256_mul_ps(_mm256_set1_ps(fPerlinScale3), result));
+	}
+#endif
+
+	for (; i < uiCount; ++i)
+	{
+		pValues[i] = perlin(pX[i], pY[i], pZ[i]);
+	}
+}
@@ -0,0 +1,920 @@
+/**
+A paged indexed vector is an indexed vector that stores its entries in fixed size pages instead of
+a single contiguous buffer. Pages are never moved once allocated, so growing the container only
+ever allocates one new page and never copies existing elements. Pointers and references to stored
+elements remain valid until the element is removed or the container is destroyed.
+
+Ids, entries and versioning behave exactly as they do for the IndexedVector, including support for
+packed id types (see IndexedId.h). Unlike the IndexedVector, indices released by remove are
+recycled through a free index stack so a push does not need to search for an inactive entry.
+
+Iterators remain valid when the container grows, but are invalidated if the container is moved,
+swapped or assigned to.
+
+The page size must be a power of two. Larger pages reduce the number of allocations made during
+growth at the cost of a coarser growth step.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PAGED_INDEXED_VECTOR_H
+#define PAGED_INDEXED_VECTOR_H
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+#include "Engine/System/Tools/IndexedVector.h"
+
+template <typename ElementType, size_t uiPageSize, typename IdType>
+class PagedIndexedVectorIterator
+{
+	private:
+		typedef IndexedVectorEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef PagedIndexedVectorIterator<ElementType, uiPageSize, IdType> Iterator;
+		typedef IdType Id;
+
+	public:
+		PagedIndexedVectorIterator() :
+			m_pPages(nullptr),
+			m_uiElementIndex(0),
+			m_uiMaxIndex(0)
+		{
+		}
+
+		PagedIndexedVectorIterator(const std::vector<Entry*>* pPages,
+			size_t uiElementIndex,
+			size_t uiMaxIndex) :
+			m_pPages(pPages),
+			m_uiElementIndex(uiElementIndex),
+			m_uiMaxIndex(uiMaxIndex)
+		{
+		}
+
+		bool operator==(const Iterator& other) const
+		{
+			return m_pPages == other.m_pPages && m_uiElementIndex == other.m_uiElementIndex;
+		}
+
+		bool operator!=(const Iterator& other) const
+		{
+			return !(*this == other);
+		}
+
+		Iterator& operator++()
+		{
+			if (m_uiElementIndex == m_uiMaxIndex)
+			{
+				return *this;
+			}
+
+			do
+			{
+				++m_uiElementIndex;
+			}
+			while (m_uiElementIndex < m_uiMaxIndex && !entry().bIsActive);
+
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		Iterator& operator--()
+		{
+			if (m_uiElementIndex == 0)
+			{
+				return *this;
+			}
+
+			do
+			{
+				--m_uiElementIndex;
+			}
+			while (m_uiElementIndex > 0 && !entry().bIsActive);
+
+			return *this;
+		}
+
+		Iterator operator--(int)
+		{
+			Iterator temp = *this;
+			--(*this);
+			return temp;
+		}
+
+		ElementType* operator->() const
+		{
+			return &(entry().element);
+		}
+
+		ElementType& operator*() const
+		{
+			return entry().element;
+		}
+
+		Id elementId() const
+		{
+			return Id(m_uiElementIndex, entry().uiVersionNumber);
+		}
+
+	protected:
+
+	private:
+		const std::vector<Entry*>* m_pPages;
+		size_t m_uiElementIndex;
+		size_t m_uiMaxIndex;
+
+		/**
+		Retrieves the entry currently addressed by the iterator.
+		@return The entry */
+		Entry& entry() const
+		{
+			return (*m_pPages)[m_uiElementIndex / uiPageSize][m_uiElementIndex % uiPageSize];
+		}
+};
+
+template <typename ElementType, size_t uiPageSize, typename IdType>
+class PagedIndexedVectorConstIterator
+{
+	private:
+		typedef IndexedVectorEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef PagedIndexedVectorConstIterator<ElementType, uiPageSize, IdType> Iterator;
+		typedef IdType Id;
+
+	public:
+		PagedIndexedVectorConstIterator() :
+			m_pPages(nullptr),
+			m_uiElementIndex(0),
+			m_uiMaxIndex(0)
+		{
+		}
+
+		PagedIndexedVectorConstIterator(const std::vector<Entry*>* pPages,
+			size_t uiElementIndex,
+			size_t uiMaxIndex) :
+			m_pPages(pPages),
+			m_uiElementIndex(uiElementIndex),
+			m_uiMaxIndex(uiMaxIndex)
+		{
+		}
+
+		bool operator==(const Iterator& other) const
+		{
+			return m_pPages == other.m_pPages && m_uiElementIndex == other.m_uiElementIndex;
+		}
+
+		bool operator!=(const Iterator& other) const
+		{
+			return !(*this == other);
+		}
+
+		Iterator& operator++()
+		{
+			if (m_uiElementIndex == m_uiMaxIndex)
+			{
+				return *this;
+			}
+
+			do
+			{
+				++m_uiElementIndex;
+			}
+			while (m_uiElementIndex < m_uiMaxIndex && !entry().bIsActive);
+
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		Iterator& operator--()
+		{
+			if (m_uiElementIndex == 0)
+			{
+				return *this;
+			}
+
+			do
+			{
+				--m_uiElementIndex;
+			}
+			while (m_uiElementIndex > 0 && !entry().bIsActive);
+
+			return *this;
+		}
+
+		Iterator operator--(int)
+		{
+			Iterator temp = *this;
+			--(*this);
+			return temp;
+		}
+
+		const ElementType* operator->() const
+		{
+			return &(entry().element);
+		}
+
+		const ElementType& operator*() const
+		{
+			return entry().element;
+		}
+
+		Id elementId() const
+		{
+			return Id(m_uiElementIndex, entry().uiVersionNumber);
+		}
+
+	protected:
+
+	private:
+		const std::vector<Entry*>* m_pPages;
+		size_t m_uiElementIndex;
+		size_t m_uiMaxIndex;
+
+		/**
+		Retrieves the entry currently addressed by the iterator.
+		@return The entry */
+		const Entry& entry() const
+		{
+			return (*m_pPages)[m_uiElementIndex / uiPageSize][m_uiElementIndex % uiPageSize];
+		}
+};
+
+template <typename ElementType, size_t uiPageSize = 256, typename IdType = IndexedVectorId>
+class PagedIndexedVector
+{
+	private:
+		typedef PagedIndexedVector<ElementType, uiPageSize, IdType> Vector;
+		typedef IndexedVectorEntry<ElementType, typename IdType::VersionType> Entry;
+		typedef IndexedIdVersioning<IdType> Versioning;
+
+	public:
+		typedef PagedIndexedVectorConstIterator<ElementType, uiPageSize, IdType> ConstIterator;
+		typedef PagedIndexedVectorIterator<ElementType, uiPageSize, IdType> Iterator;
+		typedef IdType Id;
+
+		static_assert(uiPageSize > 0 && (uiPageSize & (uiPageSize - 1)) == 0, "PagedIndexedVector "
+			"template parameter 'uiPageSize' must be a power of two.");
+		static_assert(!std::is_const<ElementType>::value, "PagedIndexedVector does not support "
+			"const element types.");
+		static_assert(std::is_default_constructible<ElementType>::value, "PagedIndexedVector "
+			"template parameter 'ElementType' must be default constructible.");
+		static_assert(std::is_copy_assignable<ElementType>::value, "PagedIndexedVector requires "
+			"elements to be copy assignable");
+		static_assert(std::is_destructible<ElementType>::value, "PagedIndexedVector requires "
+			"elements to be destructible");
+
+		/**
+		Constructor. No pages are allocated until the first element is pushed. */
+		PagedIndexedVector() :
+			m_uiNumElements(0),
+			m_uiNextUnusedIndex(0)
+		{
+		}
+
+		/**
+		Destructor. */
+		~PagedIndexedVector()
+		{
+			releasePages();
+		}
+
+		/**
+		Copy constructor.
+		@param other The paged indexed vector to copy */
+		PagedIndexedVector(const Vector& other) :
+			m_uiNumElements(0),
+			m_uiNextUnusedIndex(0)
+		{
+			copyFrom(other);
+		}
+
+		/**
+		Move-copy constructor. The moved from vector is left empty and owns no pages.
+		@param other The paged indexed vector to move */
+		PagedIndexedVector(Vector&& other) :
+			m_pages(std::move(other.m_pages)),
+			m_freeIndices(std::move(other.m_freeIndices)),
+			m_uiNumElements(other.m_uiNumElements),
+			m_uiNextUnusedIndex(other.m_uiNextUnusedIndex)
+		{
+			other.m_pages.clear();
+			other.m_freeIndices.clear();
+			other.m_uiNumElements = 0;
+			other.m_uiNextUnusedIndex = 0;
+		}
+
+		/**
+		Assignment operator.
+		@param other The paged indexed vector to assign from
+		@return A reference to this paged indexed vector */
+		Vector& operator=(const Vector& other)
+		{
+			if (this != &other)
+			{
+				releasePages();
+				copyFrom(other);
+			}
+
+			return *this;
+		}
+
+		/**
+		Move-assignment operator. The moved from vector is left empty and owns no pages.
+		@param other The paged indexed vector to assign from
+		@return A reference to this paged indexed vector */
+		Vector& operator=(Vector&& other)
+		{
+			if (this != &other)
+			{
+				releasePages();
+
+				m_pages = std::move(other.m_pages);
+				m_freeIndices = std::move(other.m_freeIndices);
+				m_uiNumElements = other.m_uiNumElements;
+				m_uiNextUnusedIndex = other.m_uiNextUnusedIndex;
+
+				other.m_pages.clear();
+				other.m_freeIndices.clear();
+				other.m_uiNumElements = 0;
+				other.m_uiNextUnusedIndex = 0;
+			}
+
+			return *this;
+		}
+
+		/**
+		Swaps the contents of the paged indexed vector with another paged indexed vector of the
+		same type.
+		@param other The vector to swap contents with */
+		void swap(Vector& other)
+		{
+			std::swap(m_pages, other.m_pages);
+			std::swap(m_freeIndices, other.m_freeIndices);
+			std::swap(m_uiNumElements, other.m_uiNumElements);
+			std::swap(m_uiNextUnusedIndex, other.m_uiNextUnusedIndex);
+		}
+
+		/**
+		Pushes an element on to the paged indexed vector. A new page is allocated if every existing
+		entry is in use. If the container could not grow, the element is not appended and a
+		default id is returned instead.
+		@param element The element to insert
+		@return The elements id, or a default id */
+		Id push(const ElementType& element)
+		{
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
+			{
+				return Id();
+			}
+
+			Entry& entry = entryAt(uiIndex);
+			entry.bIsActive = true;
+			Versioning::advance(entry.uiVersionNumber);
+			entry.element = element;
+			++m_uiNumElements;
+
+			return Id(uiIndex, entry.uiVersionNumber);
+		}
+
+		/**
+		Pushes an element on to the paged indexed vector. A new page is allocated if every existing
+		entry is in use. If the container could not grow, the element is not appended and a
+		default id is returned instead.
+		@param element The element to insert
+		@return The elements id, or a default id */
+		Id push(ElementType&& element)
+		{
+			size_t uiIndex;
+			if (!acquireIndex(uiIndex))
+			{
+				return Id();
+			}
+
+			Entry& entry = entryAt(uiIndex);
+			entry.bIsActive = true;
+			Versioning::advance(entry.uiVersionNumber);
+			entry.element = std::move(element);
+			++m_uiNumElements;
+
+			return Id(uiIndex, entry.uiVersionNumber);
+		}
+
+		/**
+		Inserts an element at the given index. Fails if the index is not within the current
+		capacity or the entry at the index has been retired.
+		@param element The element to insert
+		@param uiIndex The index to insert at
+		@return The elements id, or a default id */
+		Id insert(const ElementType& element, size_t uiIndex)
+		{
+			if (uiIndex < capacity() &&
+				Versioning::isUsable(entryAt(uiIndex).uiVersionNumber))
+			{
+				Entry& entry = entryAt(uiIndex);
+				if (!entry.bIsActive)
+				{
+					entry.bIsActive = true;
+					++m_uiNumElements;
+				}
+
+				Versioning::advance(entry.uiVersionNumber);
+				entry.element = element;
+
+				return Id(uiIndex, entry.uiVersionNumber);
+			}
+			else
+			{
+				return Id();
+			}
+		}
+
+		/**
+		Inserts an element at the given index. Fails if the index is not within the current
+		capacity or the entry at the index has been retired.
+		@param element The element to insert
+		@param uiIndex The index to insert at
+		@return The elements id, or a default id */
+		Id insert(ElementType&& element, size_t uiIndex)
+		{
+			if (uiIndex < capacity() &&
+				Versioning::isUsable(entryAt(uiIndex).uiVersionNumber))
+			{
+				Entry& entry = entryAt(uiIndex);
+				if (!entry.bIsActive)
+				{
+					entry.bIsActive = true;
+					++m_uiNumElements;
+				}
+
+				Versioning::advance(entry.uiVersionNumber);
+				entry.element = std::move(element);
+
+				return Id(uiIndex, entry.uiVersionNumber);
+			}
+			else
+			{
+				return Id();
+			}
+		}
+
+		/**
+		Pushes a batch of elements on to the paged indexed vector. Every page the
+		batch requires is allocated up front. The ids of the pushed elements are written to the
+		given id array, which must be able to hold uiCount ids, unless it is a nullptr.
+		Pushing stops early if the container cannot grow.
+		@param pElements The elements to insert
+		@param uiCount The number of elements to insert
+		@param pIds Receives the element ids. May be a nullptr
+		@return The number of elements that were pushed */
+		size_t pushBatch(const ElementType* pElements, size_t uiCount, Id* pIds = nullptr)
+		{
+			if (uiCount > capacity() - m_uiNumElements)
+			{
+				reserve(m_uiNumElements + uiCount);
+			}
+
+			size_t uiPushed = 0;
+			size_t uiIndex;
+			while (uiPushed < uiCount && acquireIndex(uiIndex))
+			{
+				Entry& entry = entryAt(uiIndex);
+				entry.bIsActive = true;
+				Versioning::advance(entry.uiVersionNumber);
+				entry.element = pElements[uiPushed];
+
+				if (pIds != nullptr)
+				{
+					pIds[uiPushed] = Id(uiIndex, entry.uiVersionNumber);
+				}
+
+				++uiPushed;
+			}
+
+			m_uiNumElements += uiPushed;
+			return uiPushed;
+		}
+
+		/**
+		Removes a batch of elements. Ids that do not address an element are ignored.
+		@param pIds The ids of the elements to remove
+		@param uiCount The number of ids
+		@return The number of elements that were removed */
+		size_t removeBatch(const Id* pIds, size_t uiCount)
+		{
+			m_freeIndices.reserve(m_freeIndices.size() + uiCount);
+
+			size_t uiRemoved = 0;
+			for (size_t i = 0; i < uiCount; ++i)
+			{
+				const size_t uiIndex = pIds[i].getIndex();
+				if (uiIndex < capacity())
+				{
+					Entry& entry = entryAt(uiIndex);
+					if (entry.bIsActive && entry.uiVersionNumber == pIds[i].getVersion())
+					{
+						entry.bIsActive = false;
+						Versioning::advance(entry.uiVersionNumber);
+						entry.element = ElementType();
+						if (Versioning::isUsable(entry.uiVersionNumber))
+						{
+							m_freeIndices.push_back(uiIndex);
+						}
+
+						++uiRemoved;
+					}
+				}
+			}
+
+			m_uiNumElements -= uiRemoved;
+			return uiRemoved;
+		}
+
+		/**
+		Invokes the given function on every active element whose index lies within the given
+		range. Disjoint ranges may be processed by different threads at the same time, provided
+		the container itself is not modified. See ParallelForEach.h.
+		@param uiBegin The first index of the range
+		@param uiEnd One past the last index of the range. Clamped to the capacity
+		@param function The function to invoke. Receives a reference to each element */
+		template <typename Function>
+		void forEachInRange(size_t uiBegin, size_t uiEnd, Function function)
+		{
+			if (uiEnd > capacity())
+			{
+				uiEnd = capacity();
+			}
+
+			for (size_t uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				Entry& entry = entryAt(uiIndex);
+				if (entry.bIsActive)
+				{
+					function(entry.element);
+				}
+			}
+		}
+
+		/**
+		Invokes the given function on every active element whose index lies within the given
+		range. Disjoint ranges may be processed by different threads at the same time.
+		@param uiBegin The first index of the range
+		@param uiEnd One past the last index of the range. Clamped to the capacity
+		@param function The function to invoke. Receives a const reference to each element */
+		template <typename Function>
+		void forEachInRange(size_t uiBegin, size_t uiEnd, Function function) const
+		{
+			if (uiEnd > capacity())
+			{
+				uiEnd = capacity();
+			}
+
+			for (size_t uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				const Entry& entry = entryAt(uiIndex);
+				if (entry.bIsActive)
+				{
+					function(entry.element);
+				}
+			}
+		}
+
+		/**
+		Reserves space for at least the given number of elements by allocating pages up front. If
+		the given number is less than the current capacity, no action is taken.
+		@param uiCapacity The desired capacity */
+		void reserve(size_t uiCapacity)
+		{
+			while (capacity() < uiCapacity && addPage())
+			{
+			}
+		}
+
+		/**
+		Returns an iterator to an element with the given id. If no such element existed, the
+		iterator will address the end iterator.
+		@param id An id
+		@return An iterator to the element, or an iterator to the end */
+		Iterator find(const Id& id) const
+		{
+			const size_t uiIndex = id.getIndex();
+			if (uiIndex < capacity())
+			{
+				const Entry& entry = entryAt(uiIndex);
+				if (entry.bIsActive && entry.uiVersionNumber == id.getVersion())
+				{
+					return Iterator(&m_pages, uiIndex, capacity());
+				}
+			}
+
+			return end();
+		}
+
+		/**
+		Removes an element with the given id. If no such element existed, the container is not
+		modified. The index of the removed element is made available to subsequent pushes.
+		@param id The id of the element to remove */
+		void remove(const Id& id)
+		{
+			const size_t uiIndex = id.getIndex();
+			if (uiIndex < capacity())
+			{
+				Entry& entry = entryAt(uiIndex);
+				if (entry.bIsActive && entry.uiVersionNumber == id.getVersion())
+				{
+					entry.bIsActive = false;
+					Versioning::advance(entry.uiVersionNumber);
+					entry.element = ElementType();
+					--m_uiNumElements;
+
+					if (Versioning::isUsable(entry.uiVersionNumber))
+					{
+						m_freeIndices.push_back(uiIndex);
+					}
+				}
+			}
+		}
+
+		/**
+		Clears all elements. Version counters are incremented. Pages are retained. */
+		void clear()
+		{
+			const size_t uiCapacity = capacity();
+			for (size_t i = 0; i < uiCapacity; ++i)
+			{
+				Entry& entry = entryAt(i);
+				entry.bIsActive = false;
+				Versioning::advance(entry.uiVersionNumber);
+				entry.element = ElementType();
+			}
+
+			m_freeIndices.clear();
+			m_uiNumElements = 0;
+			m_uiNextUnusedIndex = 0;
+		}
+
+		/**
+		Clears all elements. Version counters are reset to 0. Pages are retained. */
+		void reset()
+		{
+			const size_t uiCapacity = capacity();
+			for (size_t i = 0; i < uiCapacity; ++i)
+			{
+				Entry& entry = entryAt(i);
+				entry.bIsActive = false;
+				entry.uiVersionNumber = 0;
+				entry.element = ElementType();
+			}
+
+			m_freeIndices.clear();
+			m_uiNumElements = 0;
+			m_uiNextUnusedIndex = 0;
+		}
+
+		/**
+		Constructs and returns an iterator addressing the first element.
+		@return An iterator addressing the first element */
+		Iterator begin() const
+		{
+			return Iterator(&m_pages, firstActiveIndex(), capacity());
+		}
+
+		/**
+		Constructs and returns an iterator addressing the end element.
+		@return An iterator addressing the end element */
+		Iterator end() const
+		{
+			return Iterator(&m_pages, capacity(), capacity());
+		}
+
+		/**
+		Constructs and returns a const iterator addressing the first element.
+		@return A const iterator addressing the first element */
+		ConstIterator cbegin() const
+		{
+			return ConstIterator(&m_pages, firstActiveIndex(), capacity());
+		}
+
+		/**
+		Constructs and returns a const iterator addressing the end element.
+		@return A const iterator addressing the end element */
+		ConstIterator cend() const
+		{
+			return ConstIterator(&m_pages, capacity(), capacity());
+		}
+
+		/**
+		Retrieves the current number of elements in the container.
+		@return The current number of elements */
+		size_t size() const
+		{
+			return m_uiNumElements;
+		}
+
+		/**
+		Retrieves the number of elements the container can hold without allocating another page.
+		@return The maximum number of elements */
+		size_t capacity() const
+		{
+			return m_pages.size() * uiPageSize;
+		}
+
+		/**
+		Retrieves the number of pages currently allocated.
+		@return The number of pages */
+		size_t pageCount() const
+		{
+			return m_pages.size();
+		}
+
+		/**
+		Queries whether the paged indexed vector is empty.
+		@return True if the paged indexed vector is empty, false if it is not */
+		bool isEmpty() const
+		{
+			return m_uiNumElements == 0;
+		}
+
+		/**
+		Queries whether the paged indexed vector is not empty.
+		@return True if the paged indexed vector is not empty, false if it is */
+		bool isNotEmpty() const
+		{
+			return m_uiNumElements != 0;
+		}
+
+		/**
+		Queries whether the paged indexed vector is full. A full vector allocates a new page on
+		the next push.
+		@return True if the paged indexed vector is full, false if it is not */
+		bool isFull() const
+		{
+			return m_uiNumElements == capacity();
+		}
+
+		/**
+		Queries whether the paged indexed vector is not full.
+		@return True if the paged indexed vector is not full, false if it is */
+		bool isNotFull() const
+		{
+			return m_uiNumElements != capacity();
+		}
+
+	protected:
+
+	private:
+		std::vector<Entry*> m_pages;
+		std::vector<size_t> m_freeIndices;
+		size_t m_uiNumElements;
+		size_t m_uiNextUnusedIndex;
+
+		/**
+		Retrieves the entry at the given index. The index must be within the current capacity.
+		@param uiIndex The index
+		@return The entry */
+		Entry& entryAt(size_t uiIndex)
+		{
+			return m_pages[uiIndex / uiPageSize][uiIndex % uiPageSize];
+		}
+
+		/**
+		Retrieves the entry at the given index. The index must be within the current capacity.
+		@param uiIndex The index
+		@return The entry */
+		const Entry& entryAt(size_t uiIndex) const
+		{
+			return m_pages[uiIndex / uiPageSize][uiIndex % uiPageSize];
+		}
+
+		/**
+		Finds an inactive index for a push. Recycled indices are preferred over never used ones.
+		Indices that were filled through insert since being released, or that have been retired,
+		are skipped. A new page is allocated if no inactive index remains.
+		@param uiIndex Receives the index
+		@return True if an index was found, false if the container could not grow */
+		bool acquireIndex(size_t& uiIndex)
+		{
+			while (!m_freeIndices.empty())
+			{
+				uiIndex = m_freeIndices.back();
+				m_freeIndices.pop_back();
+				if (isUsableIndex(uiIndex))
+				{
+					return true;
+				}
+			}
+
+			for (;;)
+			{
+				if (m_uiNextUnusedIndex == capacity() && !addPage())
+				{
+					return false;
+				}
+
+				uiIndex = m_uiNextUnusedIndex++;
+				if (isUsableIndex(uiIndex))
+				{
+					return true;
+				}
+			}
+		}
+
+		/**
+		Queries whether the entry at the given index can be handed out by a push.
+		@param uiIndex The index
+		@return True if the entry is inactive and has not been retired */
+		bool isUsableIndex(size_t uiIndex) const
+		{
+			const Entry& entry = entryAt(uiIndex);
+			return !entry.bIsActive && Versioning::isUsable(entry.uiVersionNumber);
+		}
+
+		/**
+		Allocates one additional page. Existing pages are not touched. Pages are only added while
+		every index of the new page is addressable by the id type.
+		@return True if a page was added, false if the maximum capacity was reached */
+		bool addPage()
+		{
+			const size_t uiMaxIndex = Id::uiMaxIndex;
+			if (m_pages.size() >= std::numeric_limits<size_t>::max() / uiPageSize - 1 ||
+				capacity() + (uiPageSize - 1) > uiMaxIndex)
+			{
+				return false;
+			}
+
+			m_pages.push_back(new Entry[uiPageSize]);
+			return true;
+		}
+
+		/**
+		Frees every page and returns the container to its default state. */
+		void releasePages()
+		{
+			for (Entry* pPage : m_pages)
+			{
+				delete[] pPage;
+			}
+
+			m_pages.clear();
+			m_freeIndices.clear();
+			m_uiNumElements = 0;
+			m_uiNextUnusedIndex = 0;
+		}
+
+		/**
+		Copies the pages and bookkeeping of another vector into this, empty, vector.
+		@param other The vector to copy */
+		void copyFrom(const Vector& other)
+		{
+			m_pages.reserve(other.m_pages.size());
+			for (const Entry* pOtherPage : other.m_pages)
+			{
+				Entry* pPage = new Entry[uiPageSize];
+				for (size_t i = 0; i < uiPageSize; ++i)
+				{
+					pPage[i] = pOtherPage[i];
+				}
+				m_pages.push_back(pPage);
+			}
+
+			m_freeIndices = other.m_freeIndices;
+			m_uiNumElements = other.m_uiNumElements;
+			m_uiNextUnusedIndex = other.m_uiNextUnusedIndex;
+		}
+
+		/**
+		Finds the index of the first active entry.
+		@return The index, or the capacity if no entry was active */
+		size_t firstActiveIndex() const
+		{
+			const size_t uiCapacity = capacity();
+			if (m_uiNumElements == 0)
+			{
+				return uiCapacity;
+			}
+
+			size_t uiIndex = 0;
+			while (uiIndex < uiCapacity && !entryAt(uiIndex).bIsActive)
+			{
+				++uiIndex;
+			}
+
+			return uiIndex;
+		}
+};
+
+#endif
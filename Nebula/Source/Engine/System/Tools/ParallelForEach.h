@@ -0,0 +1,101 @@
+/**
+Parallel iteration over the indexed containers (IndexedArray, IndexedVector and
+PagedIndexedVector). The containers index range is split into contiguous chunks, one per thread,
+and each chunk is visited with the containers forEachInRange method. The calling thread
+processes the last chunk itself and returns once every chunk has been processed.
+
+The container must not be modified while it is being iterated. The function is invoked
+concurrently from several threads, so any state it shares between elements must be synchronised
+by the caller. Elements are visited in index order within a chunk but chunks run in no particular
+order.
+
+Threads are created for each call, which makes this suitable for large containers or expensive
+per-element work only. Small containers are processed on the calling thread. Given a task system,
+the chunks are run as tasks on its workers instead, and no threads are created.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PARALLEL_FOR_EACH_H
+#define PARALLEL_FOR_EACH_H
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "Engine/System/Thread/TaskSystem.h"
+
+/**
+The minimum number of entries worth handing to a thread of its own. */
+static const size_t g_uiParallelForEachMinChunkSize = 1024;
+
+/**
+Invokes the given function on every active element of an indexed container, splitting the work
+across multiple threads.
+@param container The container to iterate
+@param function The function to invoke. Receives a reference to each element
+@param uiNumThreads The maximum number of threads to use, including the calling thread. 0 uses
+one thread per hardware thread */
+template <typename ContainerType, typename Function>
+void parallelForEach(ContainerType& container, Function function, size_t uiNumThreads = 0)
+{
+	if (uiNumThreads == 0)
+	{
+		uiNumThreads = std::thread::hardware_concurrency();
+		if (uiNumThreads == 0)
+		{
+			uiNumThreads = 1;
+		}
+	}
+
+	const size_t uiCapacity = container.capacity();
+	const size_t uiMinChunkSize = g_uiParallelForEachMinChunkSize;
+	const size_t uiMaxChunks = (uiCapacity + uiMinChunkSize - 1) / uiMinChunkSize;
+	const size_t uiNumChunks = uiNumThreads < uiMaxChunks ? uiNumThreads : uiMaxChunks;
+
+	if (uiNumChunks <= 1)
+	{
+		container.forEachInRange(0, uiCapacity, function);
+		return;
+	}
+
+	const size_t uiChunkSize = (uiCapacity + uiNumChunks - 1) / uiNumChunks;
+	std::vector<std::thread> threads;
+	threads.reserve(uiNumChunks - 1);
+
+	for (size_t i = 0; i < uiNumChunks - 1; ++i)
+	{
+		const size_t uiBegin = i * uiChunkSize;
+		threads.push_back(std::thread([&container, function, uiBegin, uiChunkSize]()
+		{
+			container.forEachInRange(uiBegin, uiBegin + uiChunkSize, function);
+		}));
+	}
+
+	container.forEachInRange((uiNumChunks - 1) * uiChunkSize, uiCapacity, function);
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+/**
+Invokes the given function on every active element of an indexed container, running chunks of
+the container as tasks. The calling thread works on the container too.
+@param taskSystem The task system to run the chunks on
+@param container The container to iterate
+@param function The function to invoke. Receives a reference to each element */
+template <typename ContainerType, typename Function>
+void parallelForEach(TaskSystem& taskSystem, ContainerType& container, Function function)
+{
+	taskSystem.parallelFor(container.capacity(), g_uiParallelForEachMinChunkSize,
+		[&container, &function](size_t uiBegin, size_t uiEnd)
+	{
+		container.forEachInRange(uiBegin, uiEnd, function);
+	});
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include "Engine/System/Tools/ResourceUsage.h"
+
+#include <chrono>
+
+#include "Engine/System/Memory/AllocationCounter.h"
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <sys/resource.h>
+	#include <time.h>
+#endif
+
+ResourceUsage ResourceUsage::sample()
+{
+	ResourceUsage usage;
+	usage.dWallSeconds = std::chrono::duration<double>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+	usage.dCpuSeconds = 0.0;
+	usage.uiAllocations = AllocationCounter::getThreadAllocations();
+	usage.uiAllocatedBytes = AllocationCounter::getThreadAllocatedBytes();
+	usage.uiPeakResidentBytes = 0;
+
+#ifdef _WIN32
+	FILETIME creationTime;
+	FILETIME exitTime;
+	FILETIME kernelTime;
+	FILETIME userTime;
+	if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+	{
+		// Both times are in units of 100 nanoseconds
+		const std::uint64_t uiKernel = ((std::uint64_t)kernelTime.dwHighDateTime << 32) |
+			kernelTime.dwLowDateTime;
+		const std::uint64_t uiUser = ((std::uint64_t)userTime.dwHighDateTime << 32) |
+			userTime.dwLowDateTime;
+		usage.dCpuSeconds = (double)(uiKernel + uiUser) * 1e-7;
+	}
+
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		usage.uiPeakResidentBytes = counters.PeakWorkingSetSize;
+	}
+#else
+	timespec cpuTime;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) == 0)
+	{
+		usage.dCpuSeconds = (double)cpuTime.tv_sec + (double)cpuTime.tv_nsec * 1e-9;
+	}
+
+	rusage processUsage;
+	if (getrusage(RUSAGE_SELF, &processUsage) == 0)
+	{
+		// Reported in kilobytes on Linux but in bytes on macOS
+	#ifdef __APPLE__
+		usage.uiPeakResidentBytes = (std::uint64_t)processUsage.ru_maxrss;
+	#else
+		usage.uiPeakResidentBytes = (std::uint64_t)processUsage.ru_maxrss * 1024;
+	#endif
+	}
+#endif
+
+	return usage;
+}
@@ -0,0 +1,49 @@
+/**
+A resource usage sample records the time, heap allocations and memory used at a moment, so that
+the cost of a piece of code is the difference between samples taken before and after it.
+
+CPU time and allocations are those of the calling thread, so work the code hands to other threads
+is not included. Peak resident memory is that of the whole process, so it also grows with
+anything running alongside the code being measured.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef RESOURCE_USAGE_H
+#define RESOURCE_USAGE_H
+
+#include <cstdint>
+
+struct ResourceUsage
+{
+	/**
+	The time since an arbitrary fixed point, from a steady clock, in seconds. */
+	double dWallSeconds;
+
+	/**
+	The CPU time the calling thread has used, in seconds. */
+	double dCpuSeconds;
+
+	/**
+	The number of heap allocations the calling thread has made. Zero if allocations are not
+	counted. */
+	std::uint64_t uiAllocations;
+
+	/**
+	The number of bytes the calling thread has allocated. Zero if allocations are not counted. */
+	std::uint64_t uiAllocatedBytes;
+
+	/**
+	The most memory the process has had resident at once, in bytes. Zero where the platform does
+	not report it. */
+	std::uint64_t uiPeakResidentBytes;
+
+	/**
+	Samples the current resource usage.
+	@return The sample */
+	static ResourceUsage sample();
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "Engine/System/Tools/StringId.h"
+
+#include <cassert>
+#include <cstdio>
+
+#ifdef NEB_CONFIG_DEBUG
+	#include <mutex>
+	#include <unordered_map>
+#endif
+
+namespace
+{
+	/**
+	Hashes a string at runtime. Matches the compile time hash for strings without embedded null
+	characters.
+	@param pString The characters
+	@param uiLength The number of characters
+	@return The hash */
+	std::uint64_t hashString(const char* pString, size_t uiLength)
+	{
+		std::uint64_t uiHash = StringId::uiOffsetBasis;
+		for (size_t i = 0; i < uiLength; ++i)
+		{
+			uiHash = (uiHash ^ (std::uint64_t)(unsigned char)pString[i]) * StringId::uiPrime;
+		}
+
+		return uiHash;
+	}
+
+#ifdef NEB_CONFIG_DEBUG
+	/**
+	The reverse lookup table from hashes to the strings they were built from. */
+	struct StringIdRegistry
+	{
+		std::mutex mutex;
+		std::unordered_map<std::uint64_t, std::string> strings;
+	};
+
+	StringIdRegistry& getRegistry()
+	{
+		static StringIdRegistry registry;
+		return registry;
+	}
+
+	void registerHash(std::uint64_t uiHash, const char* pString, size_t uiLength)
+	{
+		StringIdRegistry& registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		auto result = registry.strings.emplace(uiHash, std::string(pString, uiLength));
+
+		// Two different strings with the same id would be indistinguishable as keys
+		assert(result.first->second.compare(0, std::string::npos, pString, uiLength) == 0);
+		(void)result;
+	}
+#endif
+}
+
+StringId::StringId(const std::string& sString) :
+	m_uiHash(hashString(sString.data(), sString.size()))
+{
+#ifdef NEB_CONFIG_DEBUG
+	registerHash(m_uiHash, sString.data(), sString.size());
+#endif
+}
+
+StringId StringId::registerString(const char* sString)
+{
+	const size_t uiLength = std::char_traits<char>::length(sString);
+	const std::uint64_t uiHash = hashString(sString, uiLength);
+
+#ifdef NEB_CONFIG_DEBUG
+	registerHash(uiHash, sString, uiLength);
+#endif
+
+	return fromHash(uiHash);
+}
+
+std::string StringId::getString() const
+{
+#ifdef NEB_CONFIG_DEBUG
+	{
+		StringIdRegistry& registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		auto it = registry.strings.find(m_uiHash);
+		if (it != registry.strings.end())
+		{
+			return it->second;
+		}
+	}
+#endif
+
+	char sHash[19];
+	std::snprintf(sHash, sizeof(sHash), "0x%016llX", (unsigned long long)m_uiHash);
+	return sHash;
+}
@@ -0,0 +1,145 @@
+/**
+A string id is a 64 bit FNV-1a hash of a string. Ids built from string literals are computed at
+compile time, so comparing, ordering and hashing keys only ever touches integers. String ids can
+be used as a DirectoryListing key, in ordered and unordered standard containers and in constant
+expressions such as case labels.
+
+Debug builds keep a reverse lookup table from ids back to their strings for logging, and detect
+two strings hashing to the same id. Only ids created through NEB_STRING_ID or from a runtime
+string are registered, as a constant expression cannot have side effects.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef STRING_ID_H
+#define STRING_ID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "Engine/EngineBuildConfig.h"
+
+class StringId
+{
+	public:
+		/**
+		The FNV-1a 64 bit offset basis and prime. */
+		static const std::uint64_t uiOffsetBasis = 0xCBF29CE484222325ull;
+		static const std::uint64_t uiPrime = 0x100000001B3ull;
+
+		/**
+		Constructs the id of the empty string. */
+		constexpr StringId() :
+			m_uiHash(uiOffsetBasis)
+		{
+		}
+
+		/**
+		Constructs an id from a string literal at compile time.
+		@param sString The string */
+		template <size_t uiLength>
+		constexpr StringId(const char (&sString)[uiLength]) :
+			m_uiHash(hash(sString, uiOffsetBasis))
+		{
+		}
+
+		/**
+		Constructs an id from a runtime string. Registers the string in debug builds.
+		@param sString The string */
+		explicit StringId(const std::string& sString);
+
+		/**
+		Constructs an id from a previously computed hash, such as one loaded from disk.
+		@param uiHash The hash
+		@return The id */
+		static constexpr StringId fromHash(std::uint64_t uiHash)
+		{
+			return StringId(uiHash, 0);
+		}
+
+		/**
+		Constructs an id from a string and registers the string in debug builds. Use through
+		NEB_STRING_ID.
+		@param sString The null terminated string
+		@return The id */
+		static StringId registerString(const char* sString);
+
+		/**
+		Gets the hash.
+		@return The hash */
+		constexpr std::uint64_t getHash() const
+		{
+			return m_uiHash;
+		}
+
+		/**
+		Gets the string the id was built from. The string is only known in debug builds and only
+		if the id was registered, otherwise the hash is returned in hexadecimal.
+		@return The string */
+		std::string getString() const;
+
+		constexpr bool operator==(const StringId& other) const
+		{
+			return m_uiHash == other.m_uiHash;
+		}
+
+		constexpr bool operator!=(const StringId& other) const
+		{
+			return m_uiHash != other.m_uiHash;
+		}
+
+		constexpr bool operator<(const StringId& other) const
+		{
+			return m_uiHash < other.m_uiHash;
+		}
+
+	protected:
+
+	private:
+		std::uint64_t m_uiHash;
+
+		constexpr StringId(std::uint64_t uiHash, int) :
+			m_uiHash(uiHash)
+		{
+		}
+
+		/**
+		Hashes the remaining characters of a null terminated string. Written recursively so that
+		it remains a constant expression under C++11 rules.
+		@param sString The remaining characters
+		@param uiHash The hash of the characters so far
+		@return The hash */
+		static constexpr std::uint64_t hash(const char* sString, std::uint64_t uiHash)
+		{
+			return *sString == '\0' ? uiHash :
+				hash(sString + 1, (uiHash ^ (std::uint64_t)(unsigned char)*sString) * uiPrime);
+		}
+};
+
+/**
+Creates a string id from a literal. Registers the string for reverse lookup in debug builds, in
+which case the result is not a constant expression. Construct a StringId directly where a
+constant expression is required. */
+#ifdef NEB_CONFIG_DEBUG
+	#define NEB_STRING_ID(sString) StringId::registerString(sString)
+#else
+	#define NEB_STRING_ID(sString) StringId(sString)
+#endif
+
+namespace std
+{
+	template <>
+	struct hash<StringId>
+	{
+		size_t operator()(const StringId& id) const
+		{
+			return (size_t)id.getHash();
+		}
+	};
+}
+
+#endif
@@ -1,7 +1,10 @@
 /**
 The launcher is the entry point to the program.
 
-@date edited 26/03/2017
+Launching with --headless runs the engine without a window or graphics context. Other third party
+libraries, such as FreeType, are only initialised once something first uses them.
+
+@date edited 18/10/2026
 @date authored 10/09/2016
 
 @author Nathan Sainsbury */
@@ -18,13 +21,84 @@ The launcher is the entry point to the program.
 
 #include <string>
 #include <iostream>
+#include <fstream>
 
 #include "Engine/EngineBuildConfig.h"
 #include "Engine/EngineLimits.h"
 #include "Engine/Engine.h"
+#include "Engine/System/Tools/LazyInitialiser.h"
 
-int main()
+namespace
 {
+	/**
+	Starts up GLFW, opens a window and loads OpenGL through GLEW.
+	@return The window, or nullptr if any step failed */
+	GLFWwindow* startGraphicsUp()
+	{
+		if (glfwInit() == GLFW_FALSE)
+		{
+			return nullptr;
+		}
+
+		GLFWwindow* pWindow = glfwCreateWindow(200, 200, "Test", nullptr, nullptr);
+		if (pWindow == nullptr)
+		{
+			glfwTerminate();
+			return nullptr;
+		}
+
+		glfwMakeContextCurrent(pWindow);
+
+		glewExperimental = true;
+		if (glewInit() != GLEW_OK)
+		{
+			glfwDestroyWindow(pWindow);
+			glfwTerminate();
+			return nullptr;
+		}
+
+		return pWindow;
+	}
+
+	/**
+	Closes the window and shuts GLFW down.
+	@param pWindow The window */
+	void shutGraphicsDown(GLFWwindow* pWindow)
+	{
+		glfwDestroyWindow(pWindow);
+		glfwTerminate();
+	}
+
+	/**
+	Applies the launch arguments to the engine limits.
+
+	--headless: Runs without a window or graphics context.
+
+	@param iNumArguments The number of arguments, including the program name
+	@param ppArguments The arguments
+	@param limits The limits to apply them to */
+	void applyLaunchArguments(int iNumArguments, char* ppArguments[], EngineLimits& limits)
+	{
+		for (int i = 1; i < iNumArguments; ++i)
+		{
+			const std::string sArgument = ppArguments[i];
+			if (sArgument == "--headless")
+			{
+				limits.bHeadless = true;
+			}
+			else
+			{
+				std::cout << "Ignoring unknown launch argument " << sArgument << std::endl;
+			}
+		}
+	}
+}
+
+int main(int iNumArguments, char* ppArguments[])
+{
+	EngineLimits limits;
+	applyLaunchArguments(iNumArguments, ppArguments, limits);
+
 	///////////////////////////////////////////////////////////////////////////
 	// Testing area
 
@@ -34,34 +108,36 @@ int main()
 	m2.length();
 
 	/////////////////////////
-	// GLFW
-	if (glfwInit() == GLFW_FALSE)
+	// GLFW and GLEW
+	// Headless runs have no display to open a window on, and nothing to draw
+	GLFWwindow* pWindow = nullptr;
+	if (!limits.bHeadless)
 	{
-		return 0;
+		pWindow = startGraphicsUp();
+		if (pWindow == nullptr)
+		{
+			std::cout << "Failed to start graphics. Launch with --headless to run without a "
+				"display" << std::endl;
+			return 1;
+		}
 	}
-	GLFWwindow* window = glfwCreateWindow(200, 200, "Test", nullptr, nullptr);
-	glfwMakeContextCurrent(window);
 
 	/////////////////////////
 	// Freetype
-	FT_Library library;
-	FT_Error error = FT_Init_FreeType(&library);
-	if (error)
+	// Only initialised once something first retrieves the library to draw text
+	LazyInitialiser<FT_Library> freeType([](FT_Library& library)
 	{
-		return 0;
-	}
-
-	/////////////////////////
-	// GLEW
-	glewExperimental = true;
-	GLenum initResult = glewInit();
-	if (initResult != GLEW_OK)
+		return FT_Init_FreeType(&library) == 0;
+	},
+	[](FT_Library& library)
 	{
-		return 0;
-	}
+		FT_Done_FreeType(library);
+	});
 
 	///////////////////////////////////////////////////////////////////////////
 
+	int iResult = 0;
+
 	#ifdef NEB_USE_LAUNCH_MENU
 
 	std::string sInput = "";
@@ -76,7 +152,6 @@ int main()
 		{
 			std::cout << "Starting Nebula engine..." << std::endl;
 
-			EngineLimits limits;
 			Engine engine(limits);
 			if (!engine.startUp())
 			{
@@ -88,8 +163,16 @@ int main()
 				std::cout << "Done" << std::endl;
 			}
 
+			#ifdef NEB_USE_STAT_TRACKING
+			engine.writeStartupReport(std::cout);
+			#endif
+
 			engine.run();
 
+			#ifdef NEB_USE_STAT_TRACKING
+			engine.writeMemoryReport(std::cout);
+			#endif
+
 			std::cout << "Stopping Nebula engine..." << std::endl;
 			if (!engine.shutDown())
 			{
@@ -99,27 +182,37 @@ int main()
 			{
 				std::cout << "Done" << std::endl;
 			}
+
+			#ifdef NEB_USE_STAT_TRACKING
+			std::ofstream traceFile("StartupTrace.json");
+			engine.writeStartupTrace(traceFile);
+			#endif
 		}
 
 		std::cout << std::endl;
 	}
 
-	return 0;
-	
-	#else 	
-	
-	EngineLimits limits;
-	Engine engine(limits);
-	if (engine.startUp())
+	#else
+
 	{
-		engine.run();
-		engine.shutDown();
-		return 0;
+		Engine engine(limits);
+		if (engine.startUp())
+		{
+			engine.run();
+			engine.shutDown();
+		}
+		else
+		{
+			iResult = 1;
+		}
 	}
-	else
+
+	#endif
+
+	if (pWindow != nullptr)
 	{
-		return 1;
+		shutGraphicsDown(pWindow);
 	}
 
-	#endif
+	return iResult;
 }
\ No newline at end of file
@@ -0,0 +1,469 @@
+/**
+Micro-benchmarks for the indexed containers. Each container is compared against std::vector,
+std::unordered_map and a slot map for push, remove, find and full iteration, across a range of
+element sizes and occupancies. Occupancy is the fraction of pushed elements still present after
+randomly removing the rest, which determines how fragmented the indexed containers are.
+
+The std::vector baseline addresses elements by position and removes by swapping with the last
+element. Its handles are not stable, so it represents a lower bound rather than an alternative.
+
+Results are printed as a table, or as CSV when run with --csv so that they can be recorded and
+compared between revisions. Cache misses are reported where hardware counters are available.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/System/Tools/IndexedArray.h"
+#include "Engine/System/Tools/IndexedVector.h"
+#include "Engine/System/Tools/PagedIndexedVector.h"
+
+#include "PerfCounters.h"
+#include "SlotMap.h"
+
+/**
+The number of elements pushed in to each container. */
+static const size_t g_uiNumElements = 1 << 15;
+
+/**
+The number of times find and iteration are repeated to obtain a stable measurement. */
+static const size_t g_uiNumRepeats = 16;
+
+/**
+Prevents the compiler from discarding the results of the measured operations. */
+static volatile std::uint64_t g_uiSink = 0;
+
+template <size_t uiSize>
+struct Payload
+{
+	std::uint64_t data[uiSize / sizeof(std::uint64_t)];
+
+	Payload()
+	{
+		std::memset(data, 0, sizeof(data));
+	}
+
+	explicit Payload(std::uint64_t uiValue)
+	{
+		std::memset(data, 0, sizeof(data));
+		data[0] = uiValue;
+	}
+};
+
+template <typename ElementType>
+class IndexedArrayAdaptor
+{
+	public:
+		typedef IndexedArrayId Handle;
+
+		static const char* name()
+		{
+			return "IndexedArray";
+		}
+
+		Handle push(const ElementType& element)
+		{
+			return m_container.push(element);
+		}
+
+		void remove(const Handle& handle)
+		{
+			m_container.remove(handle);
+		}
+
+		const ElementType* find(const Handle& handle)
+		{
+			auto it = m_container.find(handle);
+			return it != m_container.end() ? &*it : nullptr;
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			m_container.forEachInRange(0, m_container.capacity(), function);
+		}
+
+	private:
+		IndexedArray<ElementType, g_uiNumElements> m_container;
+};
+
+template <typename ElementType>
+class IndexedVectorAdaptor
+{
+	public:
+		typedef IndexedVectorId Handle;
+
+		static const char* name()
+		{
+			return "IndexedVector";
+		}
+
+		Handle push(const ElementType& element)
+		{
+			return m_container.push(element);
+		}
+
+		void remove(const Handle& handle)
+		{
+			m_container.remove(handle);
+		}
+
+		const ElementType* find(const Handle& handle)
+		{
+			auto it = m_container.find(handle);
+			return it != m_container.end() ? &*it : nullptr;
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			m_container.forEachInRange(0, m_container.capacity(), function);
+		}
+
+	private:
+		IndexedVector<ElementType> m_container;
+};
+
+template <typename ElementType>
+class PagedIndexedVectorAdaptor
+{
+	public:
+		typedef IndexedVectorId Handle;
+
+		static const char* name()
+		{
+			return "PagedIndexedVector";
+		}
+
+		Handle push(const ElementType& element)
+		{
+			return m_container.push(element);
+		}
+
+		void remove(const Handle& handle)
+		{
+			m_container.remove(handle);
+		}
+
+		const ElementType* find(const Handle& handle)
+		{
+			auto it = m_container.find(handle);
+			return it != m_container.end() ? &*it : nullptr;
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			m_container.forEachInRange(0, m_container.capacity(), function);
+		}
+
+	private:
+		PagedIndexedVector<ElementType> m_container;
+};
+
+template <typename ElementType>
+class VectorAdaptor
+{
+	public:
+		typedef size_t Handle;
+
+		static const char* name()
+		{
+			return "std::vector";
+		}
+
+		Handle push(const ElementType& element)
+		{
+			m_container.push_back(element);
+			return m_container.size() - 1;
+		}
+
+		void remove(const Handle& handle)
+		{
+			if (!m_container.empty())
+			{
+				m_container[handle % m_container.size()] = m_container.back();
+				m_container.pop_back();
+			}
+		}
+
+		const ElementType* find(const Handle& handle)
+		{
+			return handle < m_container.size() ? &m_container[handle] : nullptr;
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			for (ElementType& element : m_container)
+			{
+				function(element);
+			}
+		}
+
+	private:
+		std::vector<ElementType> m_container;
+};
+
+template <typename ElementType>
+class UnorderedMapAdaptor
+{
+	public:
+		typedef std::uint32_t Handle;
+
+		UnorderedMapAdaptor() :
+			m_uiNextKey(0)
+		{
+		}
+
+		static const char* name()
+		{
+			return "std::unordered_map";
+		}
+
+		Handle push(const ElementType& element)
+		{
+			m_container.emplace(m_uiNextKey, element);
+			return m_uiNextKey++;
+		}
+
+		void remove(const Handle& handle)
+		{
+			m_container.erase(handle);
+		}
+
+		const ElementType* find(const Handle& handle)
+		{
+			auto it = m_container.find(handle);
+			return it != m_container.end() ? &it->second : nullptr;
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			for (auto& pair : m_container)
+			{
+				function(pair.second);
+			}
+		}
+
+	private:
+		std::unordered_map<std::uint32_t, ElementType> m_container;
+		std::uint32_t m_uiNextKey;
+};
+
+template <typename ElementType>
+class SlotMapAdaptor
+{
+	public:
+		typedef SlotMapId Handle;
+
+		static const char* name()
+		{
+			return "SlotMap";
+		}
+
+		Handle push(const ElementType& element)
+		{
+			return m_container.push(element);
+		}
+
+		void remove(const Handle& handle)
+		{
+			m_container.remove(handle);
+		}
+
+		const ElementType* find(const Handle& handle)
+		{
+			return m_container.find(handle);
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			m_container.forEach(function);
+		}
+
+	private:
+		SlotMap<ElementType> m_container;
+};
+
+class Reporter
+{
+	public:
+		Reporter(bool bCsv) :
+			m_bCsv(bCsv)
+		{
+			if (m_bCsv)
+			{
+				std::printf("container,element_bytes,occupancy_percent,operation,ns_per_op,"
+					"cache_misses_per_op\n");
+			}
+			else
+			{
+				std::printf("%-20s %6s %5s %-8s %12s %14s\n", "container", "bytes", "occ%",
+					"op", "ns/op", "misses/op");
+			}
+		}
+
+		void start()
+		{
+			m_counters.start();
+			m_startTime = std::chrono::steady_clock::now();
+		}
+
+		void stop(const char* pContainer, size_t uiElementSize, size_t uiOccupancy,
+			const char* pOperation, size_t uiNumOps)
+		{
+			const std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+			const std::uint64_t uiMisses = m_counters.stop();
+			const double fNanos = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+				endTime - m_startTime).count();
+			const double fOps = uiNumOps != 0 ? (double)uiNumOps : 1.0;
+
+			char sMisses[32];
+			if (m_counters.isAvailable())
+			{
+				std::snprintf(sMisses, sizeof(sMisses), "%.3f", (double)uiMisses / fOps);
+			}
+			else
+			{
+				std::snprintf(sMisses, sizeof(sMisses), m_bCsv ? "" : "-");
+			}
+
+			if (m_bCsv)
+			{
+				std::printf("%s,%zu,%zu,%s,%.3f,%s\n", pContainer, uiElementSize, uiOccupancy,
+					pOperation, fNanos / fOps, sMisses);
+			}
+			else
+			{
+				std::printf("%-20s %6zu %5zu %-8s %12.3f %14s\n", pContainer, uiElementSize,
+					uiOccupancy, pOperation, fNanos / fOps, sMisses);
+			}
+		}
+
+	private:
+		PerfCounters m_counters;
+		std::chrono::steady_clock::time_point m_startTime;
+		bool m_bCsv;
+};
+
+template <template <typename> class Adaptor, size_t uiElementSize>
+void runBenchmarks(Reporter& reporter)
+{
+	typedef Payload<uiElementSize> Element;
+	typedef Adaptor<Element> Container;
+	typedef typename Container::Handle Handle;
+
+	const char* pName = Container::name();
+	const size_t occupancies[] = { 25, 50, 90, 100 };
+	std::mt19937 random(12345);
+
+	// Push in to an empty container, including any growth
+	{
+		Container container;
+		reporter.start();
+		for (size_t i = 0; i < g_uiNumElements; ++i)
+		{
+			container.push(Element(i));
+		}
+		reporter.stop(pName, uiElementSize, 100, "push", g_uiNumElements);
+	}
+
+	for (size_t uiOccupancy : occupancies)
+	{
+		Container container;
+		std::vector<Handle> handles;
+		handles.reserve(g_uiNumElements);
+
+		for (size_t i = 0; i < g_uiNumElements; ++i)
+		{
+			handles.push_back(container.push(Element(i)));
+		}
+
+		// Randomly remove elements until the target occupancy is reached
+		std::shuffle(handles.begin(), handles.end(), random);
+		const size_t uiNumLive = g_uiNumElements * uiOccupancy / 100;
+		for (size_t i = uiNumLive; i < handles.size(); ++i)
+		{
+			container.remove(handles[i]);
+		}
+
+		handles.resize(uiNumLive);
+
+		std::uint64_t uiChecksum = 0;
+		reporter.start();
+		for (size_t uiRepeat = 0; uiRepeat < g_uiNumRepeats; ++uiRepeat)
+		{
+			for (const Handle& handle : handles)
+			{
+				const Element* pElement = container.find(handle);
+				uiChecksum += pElement != nullptr ? pElement->data[0] : 0;
+			}
+		}
+		reporter.stop(pName, uiElementSize, uiOccupancy, "find", uiNumLive * g_uiNumRepeats);
+
+		reporter.start();
+		for (size_t uiRepeat = 0; uiRepeat < g_uiNumRepeats; ++uiRepeat)
+		{
+			container.forEach([&uiChecksum](const Element& element)
+			{
+				uiChecksum += element.data[0];
+			});
+		}
+		reporter.stop(pName, uiElementSize, uiOccupancy, "iterate", uiNumLive * g_uiNumRepeats);
+
+		std::shuffle(handles.begin(), handles.end(), random);
+		reporter.start();
+		for (const Handle& handle : handles)
+		{
+			container.remove(handle);
+		}
+		reporter.stop(pName, uiElementSize, uiOccupancy, "remove", uiNumLive);
+
+		g_uiSink = g_uiSink + uiChecksum;
+	}
+}
+
+template <size_t uiElementSize>
+void runElementSize(Reporter& reporter)
+{
+	runBenchmarks<IndexedArrayAdaptor, uiElementSize>(reporter);
+	runBenchmarks<IndexedVectorAdaptor, uiElementSize>(reporter);
+	runBenchmarks<PagedIndexedVectorAdaptor, uiElementSize>(reporter);
+	runBenchmarks<VectorAdaptor, uiElementSize>(reporter);
+	runBenchmarks<UnorderedMapAdaptor, uiElementSize>(reporter);
+	runBenchmarks<SlotMapAdaptor, uiElementSize>(reporter);
+}
+
+int main(int argc, char* argv[])
+{
+	bool bCsv = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--csv") == 0)
+		{
+			bCsv = true;
+		}
+	}
+
+	Reporter reporter(bCsv);
+	runElementSize<8>(reporter);
+	runElementSize<32>(reporter);
+	runElementSize<64>(reporter);
+	runElementSize<128>(reporter);
+	runElementSize<256>(reporter);
+
+	return 0;
+}
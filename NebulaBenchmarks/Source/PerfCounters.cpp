@@ -0,0 +1,71 @@
+#include "PerfCounters.h"
+
+#ifdef __linux__
+	#include <cstring>
+
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+PerfCounters::PerfCounters() :
+	m_iCacheMissCounter(-1)
+{
+#ifdef __linux__
+	perf_event_attr attributes;
+	std::memset(&attributes, 0, sizeof(attributes));
+	attributes.type = PERF_TYPE_HARDWARE;
+	attributes.size = sizeof(attributes);
+	attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+	attributes.disabled = 1;
+	attributes.exclude_kernel = 1;
+	attributes.exclude_hv = 1;
+
+	m_iCacheMissCounter = (int)syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+	if (m_iCacheMissCounter >= 0)
+	{
+		close(m_iCacheMissCounter);
+	}
+#endif
+}
+
+bool PerfCounters::isAvailable() const
+{
+	return m_iCacheMissCounter >= 0;
+}
+
+void PerfCounters::start()
+{
+#ifdef __linux__
+	if (m_iCacheMissCounter >= 0)
+	{
+		ioctl(m_iCacheMissCounter, PERF_EVENT_IOC_RESET, 0);
+		ioctl(m_iCacheMissCounter, PERF_EVENT_IOC_ENABLE, 0);
+	}
+#endif
+}
+
+std::uint64_t PerfCounters::stop()
+{
+	std::uint64_t uiCount = 0;
+
+#ifdef __linux__
+	if (m_iCacheMissCounter >= 0)
+	{
+		ioctl(m_iCacheMissCounter, PERF_EVENT_IOC_DISABLE, 0);
+		if (read(m_iCacheMissCounter, &uiCount, sizeof(uiCount)) != sizeof(uiCount))
+		{
+			uiCount = 0;
+		}
+	}
+#endif
+
+	return uiCount;
+}
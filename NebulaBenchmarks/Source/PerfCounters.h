@@ -0,0 +1,51 @@
+/**
+Hardware performance counters for the benchmarks. On Linux the last level cache miss counter is
+read through perf_event_open. On other platforms, or when the kernel refuses access (for example
+because of perf_event_paranoid), the counters are unavailable and report nothing.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+
+class PerfCounters
+{
+	public:
+		/**
+		Opens the counters. */
+		PerfCounters();
+
+		/**
+		Destructor. Closes the counters. */
+		~PerfCounters();
+
+		PerfCounters(const PerfCounters& other) = delete;
+		PerfCounters& operator=(const PerfCounters& other) = delete;
+
+		/**
+		Queries whether the counters could be opened.
+		@return True if the counters are available, false otherwise */
+		bool isAvailable() const;
+
+		/**
+		Resets and starts counting. */
+		void start();
+
+		/**
+		Stops counting.
+		@return The number of cache misses since start was called, or 0 if the counters are not
+		available */
+		std::uint64_t stop();
+
+	protected:
+
+	private:
+		int m_iCacheMissCounter;
+};
+
+#endif
@@ -0,0 +1,136 @@
+/**
+A minimal slot map used as a point of comparison for the indexed containers. Elements are kept
+densely packed and addressed through a slot table of indices and version numbers. Removal swaps
+the last element into the hole, so iteration never visits inactive elements.
+
+This implementation only exists for the benchmarks and is not part of the engine.
+
+@date edited 18/10/2026
+@date authored 18/10/2026
+
+@author Nathan Sainsbury */
+
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct SlotMapId
+{
+	std::uint32_t uiSlot;
+	std::uint32_t uiVersion;
+};
+
+template <typename ElementType>
+class SlotMap
+{
+	public:
+		typedef SlotMapId Id;
+
+		SlotMap() :
+			m_uiFreeHead(uiNullSlot)
+		{
+		}
+
+		void reserve(size_t uiCapacity)
+		{
+			m_elements.reserve(uiCapacity);
+			m_elementSlots.reserve(uiCapacity);
+			m_slots.reserve(uiCapacity);
+		}
+
+		Id push(const ElementType& element)
+		{
+			std::uint32_t uiSlot;
+			if (m_uiFreeHead != uiNullSlot)
+			{
+				uiSlot = m_uiFreeHead;
+				m_uiFreeHead = m_slots[uiSlot].uiIndex;
+			}
+			else
+			{
+				uiSlot = (std::uint32_t)m_slots.size();
+				m_slots.push_back(Slot());
+			}
+
+			m_slots[uiSlot].uiIndex = (std::uint32_t)m_elements.size();
+			m_elements.push_back(element);
+			m_elementSlots.push_back(uiSlot);
+
+			Id id;
+			id.uiSlot = uiSlot;
+			id.uiVersion = m_slots[uiSlot].uiVersion;
+			return id;
+		}
+
+		ElementType* find(const Id& id)
+		{
+			if (id.uiSlot < m_slots.size() && m_slots[id.uiSlot].uiVersion == id.uiVersion)
+			{
+				return &m_elements[m_slots[id.uiSlot].uiIndex];
+			}
+
+			return nullptr;
+		}
+
+		void remove(const Id& id)
+		{
+			if (id.uiSlot >= m_slots.size() || m_slots[id.uiSlot].uiVersion != id.uiVersion)
+			{
+				return;
+			}
+
+			Slot& slot = m_slots[id.uiSlot];
+			const std::uint32_t uiLast = (std::uint32_t)m_elements.size() - 1;
+			if (slot.uiIndex != uiLast)
+			{
+				m_elements[slot.uiIndex] = m_elements[uiLast];
+				m_elementSlots[slot.uiIndex] = m_elementSlots[uiLast];
+				m_slots[m_elementSlots[slot.uiIndex]].uiIndex = slot.uiIndex;
+			}
+
+			m_elements.pop_back();
+			m_elementSlots.pop_back();
+
+			++slot.uiVersion;
+			slot.uiIndex = m_uiFreeHead;
+			m_uiFreeHead = id.uiSlot;
+		}
+
+		template <typename Function>
+		void forEach(Function function)
+		{
+			for (ElementType& element : m_elements)
+			{
+				function(element);
+			}
+		}
+
+	protected:
+
+	private:
+		static const std::uint32_t uiNullSlot = 0xFFFFFFFF;
+
+		struct Slot
+		{
+			/**
+			The index of the element while the slot is in use, otherwise the next free slot. */
+			std::uint32_t uiIndex;
+			std::uint32_t uiVersion;
+
+			Slot() :
+				uiIndex(0),
+				uiVersion(0)
+			{
+			}
+		};
+
+		std::vector<ElementType> m_elements;
+		std::vector<std::uint32_t> m_elementSlots;
+		std::vector<Slot> m_slots;
+		std::uint32_t m_uiFreeHead;
+};
+
+#endif
@@ -0,0 +1,177 @@
+#include "Engine/System/File/AsyncFileReader.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const char* const pTestPath = "AsyncFileReaderTest.bin";
+
+	void writeTestFile(const std::string& sContents)
+	{
+		FILE* pFile = std::fopen(pTestPath, "wb");
+		ASSERT_NE(pFile, nullptr);
+		std::fwrite(sContents.data(), 1, sContents.size(), pFile);
+		std::fclose(pFile);
+	}
+
+	void deliverAll(AsyncFileReader& reader)
+	{
+		const std::chrono::steady_clock::time_point timeout =
+			std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		while (reader.getNumPending() > 0 && std::chrono::steady_clock::now() < timeout)
+		{
+			reader.deliverCompletions();
+			std::this_thread::yield();
+		}
+	}
+}
+
+TEST(AsyncFileReader, ReadsInToBuffersOnEachBackend)
+{
+	std::string sContents;
+	for (int i = 0; i < 100000; ++i)
+	{
+		sContents.push_back((char)('a' + i % 26));
+	}
+
+	writeTestFile(sContents);
+
+	for (const bool bAllowIoUring : { false, true })
+	{
+		AsyncFileReader reader;
+		ASSERT_TRUE(reader.start(2, bAllowIoUring));
+		ASSERT_NE(reader.getBackend(), AsyncFileReaderBackends::NONE);
+
+		std::vector<AsyncReadCompletion> completions;
+		const std::thread::id deliveringThread = std::this_thread::get_id();
+		const auto onComplete = [&](const AsyncReadCompletion& completion)
+		{
+			// Completions only arrive on the thread that delivers them
+			ASSERT_EQ(std::this_thread::get_id(), deliveringThread);
+			completions.push_back(completion);
+		};
+
+		std::vector<char> whole(sContents.size());
+		std::vector<char> tail(1000);
+		std::vector<AsyncReadRequest> requests(3);
+		requests[0].sPath = pTestPath;
+		requests[0].pBuffer = whole.data();
+		requests[0].uiSize = whole.size();
+		requests[0].onComplete = onComplete;
+		requests[1] = requests[0];
+		requests[1].uiOffset = sContents.size() - 100;
+		requests[1].pBuffer = tail.data();
+		requests[1].uiSize = tail.size();
+		requests[2] = requests[1];
+		requests[2].sPath = "AsyncFileReaderMissing.bin";
+
+		AsyncReadId ids[3];
+		ASSERT_EQ(reader.submitBatch(requests.data(), requests.size(), ids), 3u);
+		deliverAll(reader);
+		ASSERT_EQ(reader.getNumPending(), 0u);
+		ASSERT_EQ(completions.size(), 3u);
+
+		for (const AsyncReadCompletion& completion : completions)
+		{
+			if (completion.id == ids[0])
+			{
+				ASSERT_EQ(completion.result, AsyncReadResults::SUCCESS);
+				ASSERT_EQ(completion.uiBytesRead, sContents.size());
+				ASSERT_EQ(std::string(whole.begin(), whole.end()), sContents);
+			}
+			else if (completion.id == ids[1])
+			{
+				// Reads past the end of the file stop short
+				ASSERT_EQ(completion.result, AsyncReadResults::SUCCESS);
+				ASSERT_EQ(completion.uiBytesRead, 100u);
+				ASSERT_EQ(std::string(tail.data(), 100), sContents.substr(sContents.size() - 100));
+			}
+			else
+			{
+				ASSERT_EQ(completion.id, ids[2]);
+				ASSERT_EQ(completion.result, AsyncReadResults::FAIL_OPEN);
+			}
+		}
+
+		reader.stop();
+		ASSERT_EQ(reader.submit(requests[0]), 0u);
+	}
+
+	std::remove(pTestPath);
+}
+
+TEST(AsyncFileReader, ServicesByPriorityAndCancelsQueuedReads)
+{
+	writeTestFile("0123456789");
+
+	AsyncFileReader reader;
+	ASSERT_TRUE(reader.start(1, false));
+	reader.pause();
+
+	std::vector<AsyncReadId> order;
+	std::vector<AsyncReadResults> results;
+	char buffers[4][10];
+	AsyncReadId ids[4];
+	const AsyncReadPriorities priorities[4] = { AsyncReadPriorities::BACKGROUND,
+		AsyncReadPriorities::NORMAL, AsyncReadPriorities::URGENT, AsyncReadPriorities::NORMAL };
+
+	for (int i = 0; i < 4; ++i)
+	{
+		AsyncReadRequest request;
+		request.sPath = pTestPath;
+		request.pBuffer = buffers[i];
+		request.uiSize = sizeof(buffers[i]);
+		request.priority = priorities[i];
+		request.onComplete = [&](const AsyncReadCompletion& completion)
+		{
+			order.push_back(completion.id);
+			results.push_back(completion.result);
+		};
+
+		ids[i] = reader.submit(request);
+		ASSERT_NE(ids[i], 0u);
+	}
+
+	ASSERT_TRUE(reader.cancel(ids[3]));
+	ASSERT_FALSE(reader.cancel(ids[3]));
+
+	// Nothing is delivered until asked for
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_TRUE(order.empty());
+	ASSERT_EQ(reader.deliverCompletions(), 1u);
+	ASSERT_EQ(order.back(), ids[3]);
+	ASSERT_EQ(results.back(), AsyncReadResults::CANCELLED);
+
+	reader.resume();
+	deliverAll(reader);
+
+	const std::vector<AsyncReadId> expected = { ids[3], ids[2], ids[1], ids[0] };
+	ASSERT_EQ(order, expected);
+	for (size_t i = 1; i < results.size(); ++i)
+	{
+		ASSERT_EQ(results[i], AsyncReadResults::SUCCESS);
+	}
+
+	// Stopping cancels whatever is still queued
+	reader.pause();
+	AsyncReadRequest request;
+	request.sPath = pTestPath;
+	request.pBuffer = buffers[0];
+	request.uiSize = sizeof(buffers[0]);
+	request.onComplete = [&](const AsyncReadCompletion& completion)
+	{
+		results.push_back(completion.result);
+	};
+
+	reader.submit(request);
+	reader.stop();
+	ASSERT_EQ(results.back(), AsyncReadResults::CANCELLED);
+	ASSERT_EQ(reader.getNumPending(), 0u);
+
+	std::remove(pTestPath);
+}
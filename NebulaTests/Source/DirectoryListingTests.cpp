@@ -0,0 +1,62 @@
+#include "Engine/System/Tools/DirectoryListing.h"
+#include "gtest/gtest.h"
+
+#include <string>
+
+TEST(DirectoryListing, HashedModeAddsFindsAndRemoves)
+{
+	DirectoryListing<int> listing(DirectoryListing<int>::Modes::HASHED);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		ASSERT_EQ(listing.add(i, "./data/" + std::to_string(i) + "/"),
+			DirectoryListing<int>::OpResults::SUCCESS);
+	}
+
+	for (int i = 0; i < 100; i += 2)
+	{
+		listing.remove(i);
+	}
+
+	for (int i = 0; i < 100; ++i)
+	{
+		DirectoryListing<int>::SearchResult result = listing.find(i);
+		ASSERT_EQ(result.bFound, i % 2 == 1);
+		if (result.bFound)
+		{
+			ASSERT_EQ(result.sDirectory, "./data/" + std::to_string(i) + "/");
+		}
+		else
+		{
+			ASSERT_EQ(result.sDirectory, "./default/");
+		}
+	}
+}
+
+TEST(DirectoryListing, FrozenListingFindsEveryKey)
+{
+	DirectoryListing<> listing;
+	for (int i = 0; i < 1000; ++i)
+	{
+		listing.add("dir_" + std::to_string(i), "./data/" + std::to_string(i) + "/");
+	}
+
+	ASSERT_TRUE(listing.freeze());
+	ASSERT_TRUE(listing.isFrozen());
+	ASSERT_EQ(listing.add("late", "./late/"), DirectoryListing<>::OpResults::FAIL_FROZEN);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		DirectoryListing<>::SearchResult result = listing.find("dir_" + std::to_string(i));
+		ASSERT_TRUE(result.bFound);
+		ASSERT_EQ(result.sDirectory, "./data/" + std::to_string(i) + "/");
+	}
+
+	ASSERT_FALSE(listing.find("missing").bFound);
+	ASSERT_FALSE(listing.find("late").bFound);
+
+	listing.thaw();
+	ASSERT_EQ(listing.add("late", "./late/"), DirectoryListing<>::OpResults::SUCCESS);
+	ASSERT_TRUE(listing.find("late").bFound);
+	ASSERT_TRUE(listing.find("dir_999").bFound);
+}
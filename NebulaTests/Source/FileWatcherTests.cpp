@@ -0,0 +1,277 @@
+#include "Engine/System/File/FileWatcher.h"
+#include "Engine/System/File/VirtualFileReloader.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+	#include <direct.h>
+#else
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace
+{
+	class RecordingListener : public FileWatchListener
+	{
+		public:
+			std::vector<std::vector<FileChange>> batches;
+
+			void onFilesChanged(const std::vector<FileChange>& changes) override
+			{
+				batches.push_back(changes);
+			}
+
+			std::map<std::string, FileChangeTypes> take()
+			{
+				std::map<std::string, FileChangeTypes> changes;
+				for (const std::vector<FileChange>& batch : batches)
+				{
+					for (const FileChange& change : batch)
+					{
+						// Each file is only reported once
+						EXPECT_EQ(changes.count(change.sPath), 0u) << change.sPath;
+						changes[change.sPath] = change.type;
+					}
+				}
+
+				batches.clear();
+				return changes;
+			}
+	};
+
+	void makeDirectory(const std::string& sPath)
+	{
+#ifdef _WIN32
+		_mkdir(sPath.c_str());
+#else
+		mkdir(sPath.c_str(), 0755);
+#endif
+	}
+
+	void removeDirectory(const std::string& sPath)
+	{
+#ifdef _WIN32
+		_rmdir(sPath.c_str());
+#else
+		rmdir(sPath.c_str());
+#endif
+	}
+
+	/**
+	Removes files and empty directories when constructed and again when destroyed, so that a test
+	that fails part way through does not leave them behind for the next run. Paths are removed in
+	order, so files must come before the directories that hold them. */
+	class ScopedCleanUp
+	{
+		public:
+			explicit ScopedCleanUp(const std::vector<std::string>& paths) :
+				m_paths(paths)
+			{
+				removeAll();
+			}
+
+			~ScopedCleanUp()
+			{
+				removeAll();
+			}
+
+		private:
+			std::vector<std::string> m_paths;
+
+			void removeAll() const
+			{
+				for (const std::string& sPath : m_paths)
+				{
+					std::remove(sPath.c_str());
+					removeDirectory(sPath);
+				}
+			}
+	};
+
+	void writeFile(const std::string& sPath, const std::string& sContents)
+	{
+		FILE* pFile = std::fopen(sPath.c_str(), "wb");
+		ASSERT_NE(pFile, nullptr);
+		std::fwrite(sContents.data(), 1, sContents.size(), pFile);
+		std::fclose(pFile);
+	}
+
+	/**
+	Updates the watcher until the listener has received the expected number of changes, then for
+	a little longer to catch any unexpected ones. */
+	std::map<std::string, FileChangeTypes> waitForChanges(FileWatcher& watcher,
+		RecordingListener& listener, size_t uiExpected)
+	{
+		const std::chrono::steady_clock::time_point timeout =
+			std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		size_t uiReceived = 0;
+		while (uiReceived < uiExpected && std::chrono::steady_clock::now() < timeout)
+		{
+			uiReceived += watcher.update();
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		watcher.update();
+		return listener.take();
+	}
+}
+
+TEST(FileWatcher, DebouncesAndBatchesChangesOnEachBackend)
+{
+	const std::string sRoot = "FileWatcherTest/";
+	for (const bool bAllowNative : { true, false })
+	{
+		const ScopedCleanUp cleanUp({ sRoot + "scripts/main.lua", sRoot + "config.ini",
+			sRoot + "scripts", sRoot });
+		makeDirectory(sRoot);
+		makeDirectory(sRoot + "scripts");
+
+		FileWatcher watcher;
+		RecordingListener listener;
+		watcher.setDebounceTime(std::chrono::milliseconds(30));
+		watcher.setPollInterval(std::chrono::milliseconds(10));
+		watcher.addListener(&listener);
+		ASSERT_TRUE(watcher.start(bAllowNative));
+		ASSERT_FALSE(watcher.watchExists(watcher.watch("FileWatcherMissing/")));
+
+		const FileWatchId id = watcher.watch(sRoot);
+		ASSERT_TRUE(watcher.watchExists(id));
+		ASSERT_EQ(watcher.getDirectory(id), sRoot);
+
+		// Give the poller time to take its first look at the directory
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		// Several writes to one file are reported as a single change
+		writeFile(sRoot + "scripts/main.lua", "print(1)");
+		writeFile(sRoot + "scripts/main.lua", "print(12)");
+		writeFile(sRoot + "config.ini", "a=1");
+		std::map<std::string, FileChangeTypes> changes = waitForChanges(watcher, listener, 2);
+		ASSERT_EQ(changes.size(), 2u);
+		ASSERT_EQ(changes["scripts/main.lua"], FileChangeTypes::ADDED);
+		ASSERT_EQ(changes["config.ini"], FileChangeTypes::ADDED);
+
+		writeFile(sRoot + "scripts/main.lua", "print(123)");
+		std::remove((sRoot + "config.ini").c_str());
+		changes = waitForChanges(watcher, listener, 2);
+		ASSERT_EQ(changes.size(), 2u);
+		ASSERT_EQ(changes["scripts/main.lua"], FileChangeTypes::MODIFIED);
+		ASSERT_EQ(changes["config.ini"], FileChangeTypes::REMOVED);
+
+		// Nothing is reported once the directory is no longer watched
+		watcher.unwatch(id);
+		ASSERT_FALSE(watcher.watchExists(id));
+		writeFile(sRoot + "scripts/main.lua", "print(1234)");
+		ASSERT_TRUE(waitForChanges(watcher, listener, 0).empty());
+	}
+}
+
+TEST(FileWatcher, ReportsTheFilesOfMovedDirectoriesOnEachBackend)
+{
+	const std::string sRoot = "FileWatcherMoveTest/";
+	const std::string sOutside = "FileWatcherMoveOutside/";
+	for (const bool bAllowNative : { true, false })
+	{
+		const ScopedCleanUp cleanUp({ sRoot + "level/maps/b.png", sRoot + "level/a.png",
+			sRoot + "level/maps", sRoot + "level", sOutside + "level/maps/b.png",
+			sOutside + "level/a.png", sOutside + "level/maps", sOutside + "level", sOutside,
+			sRoot });
+		makeDirectory(sRoot);
+		makeDirectory(sOutside);
+		makeDirectory(sOutside + "level");
+		makeDirectory(sOutside + "level/maps");
+		writeFile(sOutside + "level/a.png", "a");
+		writeFile(sOutside + "level/maps/b.png", "b");
+
+		FileWatcher watcher;
+		watcher.setDebounceTime(std::chrono::milliseconds(30));
+		watcher.setPollInterval(std::chrono::milliseconds(10));
+		ASSERT_TRUE(watcher.start(bAllowNative));
+
+		VirtualFileSystem vfs;
+		RecordingListener listener;
+		VirtualFileReloader reloader(vfs, watcher);
+		reloader.addListener(&listener);
+		reloader.mount("data", std::make_shared<DirectoryFileSource>(sRoot), 0);
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+		// Moving a directory in or out reports each of the files beneath it
+		ASSERT_EQ(std::rename((sOutside + "level").c_str(), (sRoot + "level").c_str()), 0);
+		std::map<std::string, FileChangeTypes> changes = waitForChanges(watcher, listener, 2);
+		ASSERT_EQ(changes.size(), 2u);
+		ASSERT_EQ(changes["data/level/a.png"], FileChangeTypes::ADDED);
+		ASSERT_EQ(changes["data/level/maps/b.png"], FileChangeTypes::ADDED);
+		ASSERT_TRUE(vfs.exists("data/level/maps/b.png"));
+
+		ASSERT_EQ(std::rename((sRoot + "level").c_str(), (sOutside + "level").c_str()), 0);
+		changes = waitForChanges(watcher, listener, 2);
+		ASSERT_EQ(changes.size(), 2u);
+		ASSERT_EQ(changes["data/level/a.png"], FileChangeTypes::REMOVED);
+		ASSERT_EQ(changes["data/level/maps/b.png"], FileChangeTypes::REMOVED);
+		ASSERT_FALSE(vfs.exists("data/level/a.png"));
+	}
+}
+
+TEST(VirtualFileReloader, RefreshesMountsAndReportsVisibleChanges)
+{
+	const std::string sBase = "FileWatcherBase/";
+	const std::string sMod = "FileWatcherMod/";
+	const ScopedCleanUp cleanUp({ sMod + "grass.png", sMod + "tree.png", sBase + "grass.png",
+		sBase + "rock.png", sMod, sBase });
+	makeDirectory(sBase);
+	makeDirectory(sMod);
+	writeFile(sBase + "grass.png", "base grass");
+	writeFile(sBase + "rock.png", "base rock");
+
+	FileWatcher watcher;
+	watcher.setDebounceTime(std::chrono::milliseconds(30));
+	watcher.setPollInterval(std::chrono::milliseconds(10));
+	ASSERT_TRUE(watcher.start());
+
+	VirtualFileSystem vfs;
+	RecordingListener listener;
+	VirtualFileReloader reloader(vfs, watcher);
+	reloader.addListener(&listener);
+
+	const VirtualFileSystem::MountId baseId =
+		reloader.mount("data", std::make_shared<DirectoryFileSource>(sBase), 0);
+	reloader.mount("data", std::make_shared<DirectoryFileSource>(sMod), 10);
+	ASSERT_TRUE(reloader.isWatched(baseId));
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	// A mod file that overrides a base file changes what the virtual path provides
+	writeFile(sMod + "grass.png", "mod grass");
+	writeFile(sMod + "tree.png", "mod tree");
+	std::map<std::string, FileChangeTypes> changes = waitForChanges(watcher, listener, 2);
+	ASSERT_EQ(changes.size(), 2u);
+	ASSERT_EQ(changes["data/grass.png"], FileChangeTypes::MODIFIED);
+	ASSERT_EQ(changes["data/tree.png"], FileChangeTypes::ADDED);
+
+	std::vector<unsigned char> data;
+	ASSERT_TRUE(vfs.read("data/grass.png", data));
+	ASSERT_EQ(std::string(data.begin(), data.end()), "mod grass");
+	ASSERT_TRUE(vfs.exists("data/tree.png"));
+
+	// Changes hidden by the mod are not passed on
+	writeFile(sBase + "grass.png", "new base grass");
+	writeFile(sBase + "rock.png", "new base rock");
+	changes = waitForChanges(watcher, listener, 1);
+	ASSERT_EQ(changes.size(), 1u);
+	ASSERT_EQ(changes["data/rock.png"], FileChangeTypes::MODIFIED);
+
+	// Removing the override reveals the base file again
+	std::remove((sMod + "grass.png").c_str());
+	changes = waitForChanges(watcher, listener, 1);
+	ASSERT_EQ(changes.size(), 1u);
+	ASSERT_EQ(changes["data/grass.png"], FileChangeTypes::MODIFIED);
+	ASSERT_TRUE(vfs.read("data/grass.png", data));
+	ASSERT_EQ(std::string(data.begin(), data.end()), "new base grass");
+}
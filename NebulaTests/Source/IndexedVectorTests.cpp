@@ -0,0 +1,499 @@
+#include "Engine/System/Tools/IndexedVector.h"
+#include "Engine/System/Tools/IndexedArray.h"
+#include "Engine/System/Tools/ConcurrentIndexedVector.h"
+#include "Engine/System/Tools/ParallelForEach.h"
+#include "Engine/System/Memory/ArenaAllocator.h"
+#include "Engine/System/Memory/PoolAllocator.h"
+#include "Engine/System/File/MappedFile.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+TEST(IndexedVector, PackedIdsAreSmall)
+{
+	ASSERT_EQ(sizeof(IndexedId32), 4u);
+	ASSERT_EQ(sizeof(IndexedId64), 8u);
+	ASSERT_EQ(sizeof(IndexedId32::VersionType), 1u);
+	ASSERT_EQ(sizeof(IndexedId64::VersionType), 4u);
+}
+
+TEST(IndexedVector, PackedIdRoundTrip)
+{
+	IndexedVector<int, IndexedId32> vector;
+
+	IndexedId32 a = vector.push(10);
+	IndexedId32 b = vector.push(20);
+
+	ASSERT_EQ(a.getIndex(), 0u);
+	ASSERT_EQ(b.getIndex(), 1u);
+	ASSERT_EQ(*vector.find(b), 20);
+	ASSERT_EQ(*vector.find(IndexedId32::fromPackedValue(a.uiValue)), 10);
+
+	vector.remove(a);
+	ASSERT_TRUE(vector.find(a) == vector.end());
+}
+
+TEST(IndexedVector, RetirePolicyNeverReusesIds)
+{
+	IndexedArray<int, 1, PackedIndexedId<std::uint8_t, 4, IndexedIdOverflowPolicies::RETIRE>> array;
+	typedef decltype(array)::Id Id;
+
+	// 4 version bits give 15 distinct versions. Each push and remove advances the version once.
+	Id last;
+	for (int i = 0; i < 7; ++i)
+	{
+		last = array.push(i);
+		ASSERT_TRUE(array.find(last) != array.end());
+		array.remove(last);
+	}
+
+	last = array.push(7);
+	ASSERT_EQ(last.getVersion(), 15u);
+	array.remove(last);
+
+	// The only entry is now retired
+	ASSERT_TRUE(array.find(last) == array.end());
+	ASSERT_TRUE(array.push(8) == Id());
+	ASSERT_TRUE(array.isEmpty());
+
+	array.reset();
+	ASSERT_TRUE(array.push(9) != Id());
+}
+
+TEST(IndexedVector, WrapPolicyWrapsVersions)
+{
+	IndexedArray<int, 1, PackedIndexedId<std::uint8_t, 4, IndexedIdOverflowPolicies::WRAP>> array;
+	typedef decltype(array)::Id Id;
+
+	Id last;
+	for (int i = 0; i < 8; ++i)
+	{
+		last = array.push(i);
+		array.remove(last);
+	}
+
+	ASSERT_EQ(last.getVersion(), 15u);
+	last = array.push(8);
+	ASSERT_EQ(last.getVersion(), 1u);
+}
+
+TEST(IndexedVector, IndexLimitedByIdType)
+{
+	typedef PackedIndexedId<std::uint8_t, 2> Id;
+	IndexedVector<int, Id> vector;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		ASSERT_EQ(vector.push(i).getIndex(), (size_t)i);
+	}
+
+	ASSERT_TRUE(vector.push(4) == Id());
+	ASSERT_EQ(vector.capacity(), 4u);
+}
+
+TEST(IndexedVector, BatchPushAndRemove)
+{
+	IndexedVector<int> vector;
+	vector.reserve(2);
+	int elements[5] = { 0, 1, 2, 3, 4 };
+	IndexedVectorId ids[5];
+
+	ASSERT_EQ(vector.pushBatch(elements, 5, ids), 5u);
+	ASSERT_EQ(vector.size(), 5u);
+	ASSERT_EQ(*vector.find(ids[3]), 3);
+
+	IndexedVectorId removeIds[3] = { ids[1], ids[3], ids[1] };
+	ASSERT_EQ(vector.removeBatch(removeIds, 3), 2u);
+	ASSERT_EQ(vector.size(), 3u);
+
+	// Freed entries are reused before the vector grows
+	const size_t uiCapacity = vector.capacity();
+	ASSERT_EQ(vector.pushBatch(elements, 2), 2u);
+	ASSERT_EQ(vector.capacity(), uiCapacity);
+	ASSERT_EQ(vector.size(), 5u);
+}
+
+TEST(IndexedVector, BatchPushStopsWhenFull)
+{
+	IndexedArray<int, 4> array;
+	int elements[6] = { 0, 1, 2, 3, 4, 5 };
+
+	array.push(9);
+	ASSERT_EQ(array.pushBatch(elements, 6), 3u);
+	ASSERT_TRUE(array.isFull());
+}
+
+TEST(IndexedVector, ParallelForEachVisitsEveryElement)
+{
+	IndexedVector<int> vector;
+	std::vector<IndexedVectorId> ids;
+	for (int i = 0; i < 10000; ++i)
+	{
+		ids.push_back(vector.push(1));
+	}
+
+	for (size_t i = 0; i < ids.size(); i += 3)
+	{
+		vector.remove(ids[i]);
+	}
+
+	std::atomic<int> iSum(0);
+	parallelForEach(vector, [&iSum](int& iElement)
+	{
+		iSum += iElement;
+	}, 4);
+
+	ASSERT_EQ((size_t)iSum.load(), vector.size());
+}
+
+TEST(IndexedVector, CompactRemapsMovedIds)
+{
+	IndexedVector<int> vector;
+	std::vector<IndexedVectorId> ids;
+	for (int i = 0; i < 100; ++i)
+	{
+		ids.push_back(vector.push(i));
+	}
+
+	std::vector<IndexedVectorId> kept;
+	std::vector<int> values;
+	for (size_t i = 0; i < ids.size(); ++i)
+	{
+		if (i % 4 == 1)
+		{
+			kept.push_back(ids[i]);
+			values.push_back((int)i);
+		}
+		else
+		{
+			vector.remove(ids[i]);
+		}
+	}
+
+	const size_t uiFootprint = vector.memoryFootprint();
+	IndexedVector<int>::Remap remap = vector.compact();
+
+	ASSERT_EQ(vector.capacity(), kept.size());
+	ASSERT_LT(vector.memoryFootprint(), uiFootprint);
+
+	size_t uiMoved = 0;
+	for (size_t i = 0; i < kept.size(); ++i)
+	{
+		if (remap.remap(kept[i]))
+		{
+			++uiMoved;
+		}
+
+		ASSERT_LT(kept[i].getIndex(), vector.capacity());
+		ASSERT_EQ(*vector.find(kept[i]), values[i]);
+	}
+
+	ASSERT_EQ(uiMoved, remap.size());
+	ASSERT_EQ(vector.push(100).getIndex(), kept.size());
+}
+
+TEST(IndexedVector, ShrinkToFitKeepsIds)
+{
+	IndexedVector<int> vector;
+	IndexedVectorId a = vector.push(1);
+	IndexedVectorId b = vector.push(2);
+	IndexedVectorId c = vector.push(3);
+	vector.remove(c);
+	vector.remove(a);
+
+	ASSERT_EQ(vector.shrinkToFit(), 2u);
+	ASSERT_EQ(*vector.find(b), 2);
+	ASSERT_TRUE(vector.find(a) == vector.end());
+}
+
+TEST(IndexedVector, ArenaAllocatorFailsGracefully)
+{
+	LinearArena arena(1024);
+	IndexedVector<int, IndexedVectorId, ArenaAllocator<int>> vector((ArenaAllocator<int>(arena)));
+
+	size_t uiPushed = 0;
+	while (vector.push((int)uiPushed) != IndexedVectorId())
+	{
+		++uiPushed;
+	}
+
+	// Growth stops once the arena cannot hold the doubled storage
+	ASSERT_GT(uiPushed, 0u);
+	ASSERT_EQ(vector.size(), uiPushed);
+	ASSERT_LE(arena.getUsed(), arena.getCapacity());
+}
+
+TEST(IndexedVector, MovesDoNotAllocate)
+{
+	BlockPool pool(1024, 1);
+	IndexedArray<int, 8, IndexedArrayId, PoolAllocator<int>> array((PoolAllocator<int>(pool)));
+	IndexedArrayId id = array.push(5);
+
+	// The pool only has a single block, so the move must not allocate
+	auto moved(std::move(array));
+	ASSERT_EQ(*moved.find(id), 5);
+	ASSERT_TRUE(array.isEmpty());
+	ASSERT_TRUE(array.find(id) == array.end());
+	ASSERT_TRUE(array.push(6) == IndexedArrayId());
+
+	IndexedArray<int, 8, IndexedArrayId, IndexedArrayInlineStorage> inlineArray;
+	id = inlineArray.push(7);
+
+	auto movedInline(std::move(inlineArray));
+	ASSERT_EQ(*movedInline.find(id), 7);
+	ASSERT_TRUE(inlineArray.isEmpty());
+
+	IndexedVector<int> vector;
+	IndexedVectorId vectorId = vector.push(8);
+
+	IndexedVector<int> movedVector(std::move(vector));
+	ASSERT_EQ(*movedVector.find(vectorId), 8);
+	ASSERT_EQ(vector.capacity(), 0u);
+	ASSERT_EQ(vector.push(9).getIndex(), 0u);
+}
+
+TEST(IndexedVector, SnapshotRestoresIdsFromMappedFile)
+{
+	IndexedVector<double, IndexedId32> vector;
+	std::vector<IndexedId32> ids;
+	for (int i = 0; i < 1000; ++i)
+	{
+		ids.push_back(vector.push(i * 0.5));
+	}
+
+	vector.remove(ids[10]);
+
+	std::vector<double> buffer(vector.snapshotSize() / sizeof(double) + 1);
+	ASSERT_EQ(vector.writeSnapshot(buffer.data(), vector.snapshotSize()),
+		IndexedSnapshotResults::SUCCESS);
+
+	const char* pPath = "IndexedVectorSnapshot.bin";
+	{
+		std::ofstream file(pPath, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(buffer.data()), vector.snapshotSize());
+	}
+
+	{
+		MappedFile file;
+		ASSERT_TRUE(file.open(pPath, MappedFileModes::COPY_ON_WRITE));
+
+		IndexedVector<double, IndexedId32> restored;
+		ASSERT_EQ(restored.adoptSnapshot(file.getData(), file.getSize()),
+			IndexedSnapshotResults::SUCCESS);
+		ASSERT_TRUE(restored.isAdopted());
+		ASSERT_EQ(restored.size(), 999u);
+		ASSERT_EQ(*restored.find(ids[500]), 250.0);
+		ASSERT_TRUE(restored.find(ids[10]) == restored.end());
+
+		// Pushing reuses the removed entry inside the image
+		ASSERT_EQ(restored.push(1.0).getIndex(), 10u);
+
+		IndexedVector<float, IndexedId32> incompatible;
+		ASSERT_EQ(incompatible.adoptSnapshot(file.getData(), file.getSize()),
+			IndexedSnapshotResults::FAIL_INCOMPATIBLE_IMAGE);
+	}
+
+	std::remove(pPath);
+}
+
+TEST(IndexedVector, CopyAssignmentLeavesAdoptedImageUntouched)
+{
+	IndexedVector<int, IndexedId32> vector;
+	IndexedId32 id = vector.push(1);
+
+	std::vector<double> buffer(vector.snapshotSize() / sizeof(double) + 1);
+	ASSERT_EQ(vector.writeSnapshot(buffer.data(), vector.snapshotSize()),
+		IndexedSnapshotResults::SUCCESS);
+	const std::vector<double> image(buffer);
+
+	IndexedVector<int, IndexedId32> restored;
+	ASSERT_EQ(restored.adoptSnapshot(buffer.data(), vector.snapshotSize()),
+		IndexedSnapshotResults::SUCCESS);
+
+	IndexedVector<int, IndexedId32> other;
+	other.push(2);
+	other.push(3);
+	restored = other;
+
+	ASSERT_FALSE(restored.isAdopted());
+	ASSERT_EQ(restored.size(), 2u);
+	ASSERT_EQ(*restored.find(id), 2);
+	ASSERT_TRUE(buffer == image);
+}
+
+TEST(IndexedArray, CopyAssignmentLeavesAdoptedImageUntouched)
+{
+	IndexedArray<int, 4> array;
+	IndexedArrayId id = array.push(1);
+
+	std::vector<double> buffer(array.snapshotSize() / sizeof(double) + 1);
+	ASSERT_EQ(array.writeSnapshot(buffer.data(), array.snapshotSize()),
+		IndexedSnapshotResults::SUCCESS);
+	const std::vector<double> image(buffer);
+
+	IndexedArray<int, 4> restored;
+	ASSERT_EQ(restored.adoptSnapshot(buffer.data(), array.snapshotSize()),
+		IndexedSnapshotResults::SUCCESS);
+	ASSERT_TRUE(restored.isAdopted());
+
+	IndexedArray<int, 4> other;
+	other.push(2);
+	restored = other;
+
+	ASSERT_FALSE(restored.isAdopted());
+	ASSERT_EQ(*restored.find(id), 2);
+	ASSERT_TRUE(buffer == image);
+}
+
+TEST(ConcurrentIndexedVector, ParallelPushAndRemove)
+{
+	ConcurrentIndexedVector<int, 64> vector(1 << 16);
+	std::vector<std::thread> threads;
+	std::atomic<int> iFailures(0);
+
+	for (int t = 0; t < 4; ++t)
+	{
+		threads.push_back(std::thread([&vector, &iFailures, t]()
+		{
+			std::vector<IndexedId64> ids;
+			for (int i = 0; i < 5000; ++i)
+			{
+				ids.push_back(vector.push(t * 10000 + i));
+			}
+
+			for (size_t i = 0; i < ids.size(); ++i)
+			{
+				const int* pElement = vector.find(ids[i]);
+				if (pElement == nullptr || *pElement != t * 10000 + (int)i)
+				{
+					++iFailures;
+				}
+
+				if (i % 2 == 0)
+				{
+					vector.remove(ids[i]);
+				}
+			}
+		}));
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	ASSERT_EQ(iFailures.load(), 0);
+	ASSERT_EQ(vector.size(), 10000u);
+	ASSERT_EQ(vector.collect(), 10000u);
+}
+
+TEST(ConcurrentIndexedVector, RecyclesSlotsWhileCollecting)
+{
+	ConcurrentIndexedVector<int, 64> vector(512);
+	std::vector<std::thread> threads;
+	std::atomic<int> iFailures(0);
+	std::atomic<size_t> uiNumRemoved(0);
+	std::atomic<size_t> uiNumReclaimed(0);
+	std::atomic<size_t> uiNumLive(0);
+	std::atomic<int> iNumRunning(4);
+
+	// Only ids that are still live are dereferenced, so collect never touches a found element
+	for (int t = 0; t < 4; ++t)
+	{
+		threads.push_back(std::thread([&, t]()
+		{
+			std::vector<IndexedId64> live;
+			std::vector<IndexedId64> stale;
+			for (int i = 0; i < 20000; ++i)
+			{
+				const int iValue = t * 100000 + i;
+				IndexedId64 id = vector.push(iValue);
+				if (id != IndexedId64())
+				{
+					live.push_back(id);
+				}
+
+				for (const IndexedId64& liveId : live)
+				{
+					if (vector.find(liveId) == nullptr)
+					{
+						++iFailures;
+					}
+				}
+
+				if (id != IndexedId64() && *vector.find(id) != iValue)
+				{
+					++iFailures;
+				}
+
+				for (const IndexedId64& staleId : stale)
+				{
+					if (vector.contains(staleId))
+					{
+						++iFailures;
+					}
+				}
+
+				if (live.size() > 16)
+				{
+					vector.remove(live.front());
+					stale.push_back(live.front());
+					live.erase(live.begin());
+					++uiNumRemoved;
+				}
+
+				if (stale.size() > 64)
+				{
+					stale.erase(stale.begin());
+				}
+			}
+
+			uiNumLive += live.size();
+			--iNumRunning;
+		}));
+	}
+
+	threads.push_back(std::thread([&]()
+	{
+		while (iNumRunning > 0)
+		{
+			uiNumReclaimed += vector.collect();
+			std::this_thread::yield();
+		}
+	}));
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	uiNumReclaimed += vector.collect();
+
+	ASSERT_EQ(iFailures.load(), 0);
+	ASSERT_EQ(vector.size(), uiNumLive.load());
+	ASSERT_EQ(uiNumReclaimed.load(), uiNumRemoved.load());
+	ASSERT_GT(uiNumRemoved.load(), 512u);
+}
+
+TEST(ConcurrentIndexedVector, RemovedSlotsReusedAfterCollect)
+{
+	ConcurrentIndexedVector<int, 4> vector(4);
+
+	IndexedId64 a = vector.push(1);
+	vector.remove(a);
+
+	ASSERT_FALSE(vector.contains(a));
+	ASSERT_EQ(vector.push(2).getIndex(), 1u);
+
+	vector.collect();
+
+	IndexedId64 b = vector.push(3);
+	ASSERT_EQ(b.getIndex(), a.getIndex());
+	ASSERT_NE(b.getVersion(), a.getVersion());
+	ASSERT_FALSE(vector.contains(a));
+	ASSERT_EQ(*vector.find(b), 3);
+}
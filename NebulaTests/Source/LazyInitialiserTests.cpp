@@ -0,0 +1,115 @@
+#include "Engine/System/Tools/LazyInitialiser.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(LazyInitialiser, InitialisesOnFirstUse)
+{
+	int iNumInitialised = 0;
+	int iNumShutDown = 0;
+	{
+		LazyInitialiser<int> library([&](int& iHandle)
+		{
+			++iNumInitialised;
+			iHandle = 42;
+			return true;
+		},
+		[&](int& iHandle)
+		{
+			ASSERT_EQ(iHandle, 42);
+			++iNumShutDown;
+		});
+
+		ASSERT_FALSE(library.isInitialised());
+		ASSERT_EQ(iNumInitialised, 0);
+
+		ASSERT_NE(library.get(), nullptr);
+		ASSERT_EQ(*library.get(), 42);
+		ASSERT_TRUE(library.isInitialised());
+		ASSERT_EQ(iNumInitialised, 1);
+
+		// Shutting down lets the next use initialise again
+		ASSERT_TRUE(library.shutDown());
+		ASSERT_FALSE(library.shutDown());
+		ASSERT_EQ(iNumShutDown, 1);
+		ASSERT_EQ(*library.get(), 42);
+		ASSERT_EQ(iNumInitialised, 2);
+	}
+
+	ASSERT_EQ(iNumShutDown, 2);
+
+	// Never used, so never initialised or shut down
+	{
+		LazyInitialiser<int> unused([&](int&)
+		{
+			++iNumInitialised;
+			return true;
+		},
+		[&](int&)
+		{
+			++iNumShutDown;
+		});
+	}
+
+	ASSERT_EQ(iNumInitialised, 2);
+	ASSERT_EQ(iNumShutDown, 2);
+}
+
+TEST(LazyInitialiser, RemembersFailure)
+{
+	int iNumAttempts = 0;
+	bool bShutDown = false;
+	LazyInitialiser<int> library([&](int&)
+	{
+		++iNumAttempts;
+		return false;
+	},
+	[&](int&)
+	{
+		bShutDown = true;
+	});
+
+	ASSERT_EQ(library.get(), nullptr);
+	ASSERT_EQ(library.get(), nullptr);
+	ASSERT_EQ(iNumAttempts, 1);
+	ASSERT_FALSE(library.isInitialised());
+
+	ASSERT_FALSE(library.shutDown());
+	ASSERT_FALSE(bShutDown);
+	ASSERT_EQ(library.get(), nullptr);
+	ASSERT_EQ(iNumAttempts, 2);
+}
+
+TEST(LazyInitialiser, InitialisesOnceAcrossThreads)
+{
+	std::atomic<int> iNumInitialised(0);
+	LazyInitialiser<int> library([&](int& iHandle)
+	{
+		++iNumInitialised;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		iHandle = 7;
+		return true;
+	});
+
+	std::vector<std::thread> threads;
+	std::atomic<int> iNumCorrect(0);
+	for (int i = 0; i < 8; ++i)
+	{
+		threads.push_back(std::thread([&]()
+		{
+			const int* pHandle = library.get();
+			iNumCorrect += pHandle != nullptr && *pHandle == 7 ? 1 : 0;
+		}));
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	ASSERT_EQ(iNumInitialised.load(), 1);
+	ASSERT_EQ(iNumCorrect.load(), 8);
+}
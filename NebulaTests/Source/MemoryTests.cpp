@@ -0,0 +1,245 @@
+#include "Engine/System/Memory/LinearArena.h"
+#include "Engine/System/Memory/BlockPool.h"
+#include "Engine/System/Memory/FrameAllocator.h"
+#include "Engine/System/Memory/ThreadFrameArenas.h"
+#include "Engine/System/Memory/MemoryTags.h"
+#include "Engine/System/Memory/TlsfAllocator.h"
+#include "Engine/System/Tools/IndexedVector.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST(LinearArena, AllocatesAlignedUntilExhausted)
+{
+	LinearArena arena(64);
+
+	void* pByte = arena.allocate(1, 1);
+	void* pDouble = arena.allocate(sizeof(double), alignof(double));
+
+	ASSERT_NE(pByte, nullptr);
+	ASSERT_NE(pDouble, nullptr);
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pDouble) % alignof(double), 0u);
+	ASSERT_EQ(arena.allocate(64, 1), nullptr);
+
+	arena.reset();
+	ASSERT_EQ(arena.getUsed(), 0u);
+	ASSERT_EQ(arena.allocate(64, 1), pByte);
+}
+
+TEST(BlockPool, RecyclesBlocks)
+{
+	BlockPool pool(24, 2);
+
+	void* pA = pool.allocate();
+	void* pB = pool.allocate();
+
+	ASSERT_NE(pA, nullptr);
+	ASSERT_NE(pB, nullptr);
+	ASSERT_EQ(pool.allocate(), nullptr);
+	ASSERT_TRUE(pool.owns(pA));
+
+	pool.deallocate(pA);
+	ASSERT_EQ(pool.getNumFreeBlocks(), 1u);
+	ASSERT_EQ(pool.allocate(), pA);
+}
+
+TEST(FrameArena, ReleasesMemoryAfterItsFrames)
+{
+	FrameArena arena(256, 1);
+	void* pFirst = arena.allocate(100, 16);
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pFirst) % 16, 0u);
+	ASSERT_EQ(arena.getUsed(), 100u);
+
+	arena.endFrame();
+	ASSERT_EQ(arena.getUsed(), 0u);
+	ASSERT_EQ(arena.allocate(100, 16), pFirst);
+
+	// Memory from a two frame arena survives the next frame
+	FrameArena twoFrames(256, 2);
+	int* pValue = static_cast<int*>(twoFrames.allocate(sizeof(int), alignof(int)));
+	*pValue = 7;
+	twoFrames.endFrame();
+	void* pNext = twoFrames.allocate(sizeof(int), alignof(int));
+	ASSERT_NE(pNext, pValue);
+	ASSERT_EQ(*pValue, 7);
+
+	twoFrames.endFrame();
+	ASSERT_EQ(twoFrames.allocate(sizeof(int), alignof(int)), pValue);
+}
+
+TEST(FrameArena, OverflowsOnToTheHeap)
+{
+	FrameArena arena(64);
+	arena.allocate(48, 1);
+	void* pLarge = arena.allocate(200, 64);
+	ASSERT_NE(pLarge, nullptr);
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pLarge) % 64, 0u);
+	ASSERT_GE(arena.getOverflowBytes(), 200u);
+	ASSERT_GE(arena.getUsed(), 248u);
+
+	arena.endFrame();
+	ASSERT_EQ(arena.getOverflowBytes(), 0u);
+	ASSERT_GE(arena.getPeakUsed(), 248u);
+
+	// Containers grow within the arena
+	FrameVector<int> values{ FrameAllocator<int>(arena) };
+	FrameString sText{ FrameAllocator<char>(arena) };
+	for (int i = 0; i < 10; ++i)
+	{
+		values.push_back(i);
+		sText += "abc";
+	}
+
+	ASSERT_EQ(values[9], 9);
+	ASSERT_EQ(sText.size(), 30u);
+	ASSERT_GT(arena.getUsed(), 0u);
+}
+
+TEST(ThreadFrameArenas, GivesEachThreadItsOwnArena)
+{
+	ThreadFrameArenas arenas;
+	arenas.reserve(1024);
+
+	FrameArena& local = arenas.local();
+	ASSERT_EQ(&arenas.local(), &local);
+	ASSERT_EQ(local.getCapacity(), 1024u);
+
+	FrameArena* pOther = nullptr;
+	std::thread worker([&]()
+	{
+		pOther = &arenas.local();
+		pOther->allocate(100);
+	});
+
+	worker.join();
+	ASSERT_NE(pOther, &local);
+	ASSERT_EQ(arenas.getNumArenas(), 2u);
+	ASSERT_GE(arenas.getPeakUsed(), 100u);
+
+	arenas.endFrame();
+	ASSERT_EQ(pOther->getUsed(), 0u);
+
+	// A second set is not confused with the first by the thread local cache
+	ThreadFrameArenas others;
+	ASSERT_NE(&others.local(), &local);
+	ASSERT_EQ(&arenas.local(), &local);
+}
+
+TEST(TlsfHeap, MergesFreedBlocks)
+{
+	TlsfHeap heap(4096);
+
+	void* pA = heap.allocate(100);
+	void* pB = heap.allocate(200);
+	void* pC = heap.allocate(300);
+	ASSERT_NE(pA, nullptr);
+	ASSERT_NE(pB, nullptr);
+	ASSERT_NE(pC, nullptr);
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pB) % alignof(std::max_align_t), 0u);
+	ASSERT_EQ(heap.getNumAllocations(), 3u);
+
+	// Freeing the middle block first leaves it to be merged with both of its neighbours
+	heap.deallocate(pB);
+	heap.deallocate(pA);
+	heap.deallocate(pC);
+	ASSERT_EQ(heap.getUsed(), 0u);
+	ASSERT_GE(heap.getPeakUsed(), 600u);
+
+	void* pLarge = heap.allocate(2048);
+	ASSERT_EQ(pLarge, pA);
+	ASSERT_EQ(heap.allocate(4096), nullptr);
+
+	void* pAligned = heap.allocate(64, 256);
+	ASSERT_NE(pAligned, nullptr);
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pAligned) % 256, 0u);
+	ASSERT_TRUE(heap.owns(pAligned));
+
+	heap.deallocate(pAligned);
+	heap.deallocate(pLarge);
+	ASSERT_EQ(heap.getNumAllocations(), 0u);
+	ASSERT_EQ(heap.allocate(2048), pA);
+}
+
+TEST(TlsfHeap, BacksContainers)
+{
+	TlsfHeap heap(64 * 1024);
+	IndexedVector<int, IndexedVectorId, TlsfAllocator<int>> vector((TlsfAllocator<int>(heap)));
+
+	for (int i = 0; i < 100; ++i)
+	{
+		vector.push(i);
+	}
+
+	ASSERT_EQ(vector.size(), 100u);
+	ASSERT_GT(heap.getUsed(), 100 * sizeof(int));
+
+	vector.clear();
+	vector.shrinkToFit();
+	ASSERT_EQ(heap.getUsed(), 0u);
+
+	// A heap too small for any block fails to grow the container instead of throwing
+	TlsfHeap tinyHeap(32);
+	IndexedVector<int, IndexedVectorId, TlsfAllocator<int>> tinyVector(
+		(TlsfAllocator<int>(tinyHeap)));
+	ASSERT_TRUE(tinyVector.push(1) == IndexedVectorId());
+}
+
+TEST(MemoryTags, TrackPeaksAndWarnOverBudget)
+{
+	MemoryTags tags;
+	std::string sWarned;
+	tags.setBudgetListener([&](const MemoryTag& tag)
+	{
+		sWarned += tag.getName();
+	});
+
+	MemoryTag& poolTag = tags.add("Pool", 64);
+	ASSERT_EQ(&tags.add("Pool"), &poolTag);
+	ASSERT_EQ(tags.find("Heap"), nullptr);
+
+	BlockPool pool(32, 4);
+	pool.setTag(&poolTag);
+	void* pA = pool.allocate();
+	void* pB = pool.allocate();
+	ASSERT_EQ(poolTag.getUsed(), 2 * pool.getBlockSize());
+	ASSERT_TRUE(sWarned.empty());
+
+	// Only the allocation that crosses the budget warns
+	void* pC = pool.allocate();
+	void* pD = pool.allocate();
+	ASSERT_EQ(sWarned, "Pool");
+	ASSERT_EQ(poolTag.getNumBudgetWarnings(), 1u);
+
+	pool.deallocate(pD);
+	pool.deallocate(pC);
+	pool.deallocate(pB);
+	pool.deallocate(pA);
+	ASSERT_EQ(poolTag.getUsed(), 0u);
+	ASSERT_EQ(poolTag.getNumAllocations(), 0u);
+	ASSERT_EQ(poolTag.getPeakUsed(), 4 * pool.getBlockSize());
+
+	TlsfHeap heap(1024);
+	heap.setTag(&tags.add("Heap"));
+	void* pMemory = heap.allocate(100);
+	ASSERT_EQ(tags.find("Heap")->getUsed(), heap.getUsed());
+	heap.deallocate(pMemory);
+
+	// A frame arena's tag warns when the arena spills on to the heap
+	MemoryTag& arenaTag = tags.add("FrameArena", 256);
+	FrameArena arena(256);
+	arena.setTag(&arenaTag);
+	ASSERT_EQ(arenaTag.getUsed(), 256u);
+	arena.allocate(512);
+	ASSERT_EQ(sWarned, "PoolFrameArena");
+	arena.endFrame();
+	ASSERT_EQ(arenaTag.getUsed(), 256u);
+	ASSERT_EQ(arenaTag.getNumAllocations(), 1u);
+
+	std::ostringstream report;
+	tags.writeReport(report);
+	ASSERT_NE(report.str().find("Pool"), std::string::npos);
+	ASSERT_NE(report.str().find("OVER BUDGET"), std::string::npos);
+}
@@ -0,0 +1,143 @@
+#include "Engine/System/Tools/NoiseGenerator.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+	const NoiseTypes types[] = { NoiseTypes::PERLIN, NoiseTypes::SIMPLEX, NoiseTypes::VALUE,
+		NoiseTypes::WORLEY };
+}
+
+TEST(NoiseGenerator, ProducesSmoothBoundedNoise)
+{
+	for (const NoiseTypes type : types)
+	{
+		NoiseGenerator generator(42, type);
+		const float fLower = type == NoiseTypes::WORLEY ? 0.0f : -1.05f;
+		const float fUpper = type == NoiseTypes::WORLEY ? 1.5f : 1.05f;
+
+		float fMin = 10.0f;
+		float fMax = -10.0f;
+		for (int i = 0; i < 2000; ++i)
+		{
+			const float fX = (float)i * 0.173f - 100.0f;
+			const float fY = (float)i * 0.311f - 200.0f;
+			const float fValues[3] = { generator.evaluate(fX, fY),
+				generator.evaluate(fX, fY, fX * 0.5f),
+				generator.evaluate(fX, fY, fX * 0.5f, fY * 0.25f) };
+
+			for (const float fValue : fValues)
+			{
+				ASSERT_GE(fValue, fLower);
+				ASSERT_LE(fValue, fUpper);
+				fMin = std::min(fMin, fValue);
+				fMax = std::max(fMax, fValue);
+			}
+
+			// A small step gives a small change
+			ASSERT_NEAR(generator.evaluate(fX + 0.001f, fY), fValues[0], 0.05f);
+		}
+
+		ASSERT_GT(fMax - fMin, 0.5f);
+	}
+
+	// Gradient noise is zero on the lattice
+	NoiseGenerator perlin(42);
+	ASSERT_EQ(perlin.perlin(3.0f, -7.0f), 0.0f);
+	ASSERT_EQ(perlin.perlin(3.0f, -7.0f, 12.0f), 0.0f);
+}
+
+TEST(NoiseGenerator, RepeatsForTheSameSeed)
+{
+	NoiseGenerator generator(7, NoiseTypes::SIMPLEX);
+	NoiseGenerator same(7, NoiseTypes::SIMPLEX);
+	NoiseGenerator other(8, NoiseTypes::SIMPLEX);
+
+	int iDifferent = 0;
+	for (int i = 0; i < 100; ++i)
+	{
+		const float fX = (float)i * 0.37f;
+		ASSERT_EQ(generator.evaluate(fX, 1.5f, 2.5f), same.evaluate(fX, 1.5f, 2.5f));
+		iDifferent += generator.evaluate(fX, 1.5f, 2.5f) != other.evaluate(fX, 1.5f, 2.5f);
+	}
+
+	ASSERT_GT(iDifferent, 90);
+
+	other.seed(7);
+	ASSERT_EQ(other.getSeed(), 7u);
+	ASSERT_EQ(generator.evaluate(0.5f, 1.5f, 2.5f), other.evaluate(0.5f, 1.5f, 2.5f));
+}
+
+TEST(NoiseGenerator, BatchesAndGridsMatchSinglePoints)
+{
+	const size_t uiWidth = 300;
+	const size_t uiHeight = 3;
+	const size_t uiDepth = 2;
+	const float fStep = 0.07f;
+
+	for (const NoiseTypes type : types)
+	{
+		for (const std::uint32_t uiOctaves : { 1u, 4u })
+		{
+			NoiseGenerator generator(3, type, NoiseFractal(uiOctaves, 0.5f));
+
+			std::vector<float> grid(uiWidth * uiHeight * uiDepth);
+			generator.evaluateGrid(-3.0f, 5.0f, 0.25f, fStep, uiWidth, uiHeight, uiDepth,
+				grid.data());
+
+			std::vector<float> xs;
+			std::vector<float> ys;
+			std::vector<float> zs;
+			for (size_t z = 0; z < uiDepth; ++z)
+			{
+				for (size_t y = 0; y < uiHeight; ++y)
+				{
+					for (size_t x = 0; x < uiWidth; ++x)
+					{
+						xs.push_back(-3.0f + (float)x * fStep);
+						ys.push_back(5.0f + (float)y * fStep);
+						zs.push_back(0.25f + (float)z * fStep);
+					}
+				}
+			}
+
+			std::vector<float> batch(xs.size());
+			generator.evaluate(xs.data(), ys.data(), zs.data(), batch.data(), batch.size());
+
+			std::vector<float> plane(uiWidth * uiHeight);
+			generator.evaluateGrid(-3.0f, 5.0f, fStep, uiWidth, uiHeight, plane.data());
+
+			// Vectorised and single point paths may round differently
+			for (size_t i = 0; i < xs.size(); ++i)
+			{
+				const float fExpected = generator.evaluate(xs[i], ys[i], zs[i]);
+				ASSERT_NEAR(grid[i], fExpected, 1e-5f);
+				ASSERT_NEAR(batch[i], fExpected, 1e-5f);
+				if (i < plane.size())
+				{
+					ASSERT_NEAR(plane[i], generator.evaluate(xs[i], ys[i]), 1e-5f);
+				}
+			}
+		}
+	}
+}
+
+TEST(NoiseGenerator, SumsOctaves)
+{
+	NoiseGenerator single(5);
+	NoiseGenerator fractal(5, NoiseTypes::PERLIN, NoiseFractal(3, 2.0f, 2.0f, 0.5f));
+
+	// Three octaves at frequencies 2, 4 and 8 with amplitudes 1, 0.5 and 0.25
+	for (int i = 0; i < 50; ++i)
+	{
+		const float fX = (float)i * 0.29f;
+		const float fY = (float)i * -0.13f;
+		const float fExpected = (single.perlin(fX * 2.0f, fY * 2.0f) +
+			0.5f * single.perlin(fX * 4.0f, fY * 4.0f) +
+			0.25f * single.perlin(fX * 8.0f, fY * 8.0f)) / 1.75f;
+		ASSERT_NEAR(fractal.evaluate(fX, fY), fExpected, 1e-5f);
+	}
+}
@@ -0,0 +1,93 @@
+#include "Engine/System/File/PackArchive.h"
+#include "Engine/System/File/PackCodec.h"
+#include "Engine/System/File/PackWriter.h"
+#include "Engine/System/File/VirtualFileSystem.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(PackCodec, RoundTripsAndRejectsMalformedData)
+{
+	std::mt19937 random(7);
+	std::vector<unsigned char> source;
+	for (int i = 0; i < 100000; ++i)
+	{
+		// Mix runs, repeated phrases and noise
+		source.push_back(i % 1000 < 300 ? 'a' : i % 1000 < 700 ?
+			(unsigned char)("nebula "[i % 7]) : (unsigned char)random());
+	}
+
+	std::vector<unsigned char> compressed;
+	packCompress(source.data(), source.size(), compressed);
+	ASSERT_LT(compressed.size(), source.size());
+
+	std::vector<unsigned char> decompressed(source.size());
+	ASSERT_TRUE(packDecompress(compressed.data(), compressed.size(), decompressed.data(),
+		decompressed.size()));
+	ASSERT_EQ(decompressed, source);
+
+	ASSERT_FALSE(packDecompress(compressed.data(), compressed.size() / 2, decompressed.data(),
+		decompressed.size()));
+	ASSERT_FALSE(packDecompress(compressed.data(), compressed.size(), decompressed.data(),
+		decompressed.size() - 1));
+}
+
+TEST(PackArchive, ReadsViewsAndOverridesLooseFiles)
+{
+	const std::string sTexture(4096, 't');
+	const std::string sScript = "print(\"hello\")";
+
+	PackWriter writer;
+	writer.add("./textures\\grass.png", sTexture.data(), sTexture.size(),
+		PackCompressions::LZ);
+	writer.add("scripts/main.lua", sScript.data(), sScript.size());
+
+	const char* pPath = "PackArchiveTest.pak";
+	ASSERT_EQ(writer.write(pPath), PackResults::SUCCESS);
+
+	std::shared_ptr<PackArchive> pPack = std::make_shared<PackArchive>();
+	ASSERT_EQ(pPack->open(pPath), PackResults::SUCCESS);
+	ASSERT_EQ(pPack->getNumEntries(), 2u);
+
+	const PackEntry* pTexture = pPack->find(StringId("textures/grass.png"));
+	ASSERT_NE(pTexture, nullptr);
+	ASSERT_EQ(pTexture, pPack->find("textures/grass.png"));
+	ASSERT_EQ(pTexture->uiCompression, (std::uint32_t)PackCompressions::LZ);
+	ASSERT_TRUE(pPack->verify(*pTexture));
+
+	// Uncompressed files are viewed in place, compressed ones must be read
+	VirtualFileView view;
+	ASSERT_FALSE(pPack->getView(*pTexture, view));
+	ASSERT_TRUE(pPack->getView("scripts/main.lua", view));
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(view.pData) % 64, 0u);
+	ASSERT_EQ(std::string(static_cast<const char*>(view.pData), view.uiSize), sScript);
+
+	VirtualFileSystem vfs;
+	vfs.mount("data", pPack, 10);
+
+	std::vector<unsigned char> data;
+	ASSERT_TRUE(vfs.read("data/textures/grass.png", data));
+	ASSERT_EQ(std::string(data.begin(), data.end()), sTexture);
+	ASSERT_TRUE(vfs.getView("data/scripts/main.lua", view));
+	ASSERT_FALSE(vfs.exists("data/scripts/missing.lua"));
+
+	vfs.unmountAll();
+	pPack->close();
+
+	// A truncated pack is rejected
+	std::vector<char> truncated(32, 0);
+	{
+		FILE* pFile = std::fopen(pPath, "wb");
+		ASSERT_NE(pFile, nullptr);
+		std::fwrite(truncated.data(), 1, truncated.size(), pFile);
+		std::fclose(pFile);
+	}
+
+	ASSERT_EQ(pPack->open(pPath), PackResults::FAIL_INVALID_ARCHIVE);
+	std::remove(pPath);
+}
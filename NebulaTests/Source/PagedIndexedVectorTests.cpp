@@ -0,0 +1,69 @@
+#include "Engine/System/Tools/PagedIndexedVector.h"
+#include "gtest/gtest.h"
+
+TEST(PagedIndexedVector, GrowthKeepsElementAddresses)
+{
+	PagedIndexedVector<int, 4> vector;
+
+	PagedIndexedVector<int, 4>::Id first = vector.push(7);
+	int* pFirst = &(*vector.find(first));
+
+	for (int i = 0; i < 64; ++i)
+	{
+		vector.push(i);
+	}
+
+	ASSERT_EQ(vector.size(), 65u);
+	ASSERT_EQ(vector.pageCount(), 17u);
+	ASSERT_EQ(&(*vector.find(first)), pFirst);
+	ASSERT_EQ(*pFirst, 7);
+}
+
+TEST(PagedIndexedVector, RemovedIndicesAreRecycled)
+{
+	PagedIndexedVector<int, 4> vector;
+
+	PagedIndexedVector<int, 4>::Id a = vector.push(1);
+	PagedIndexedVector<int, 4>::Id b = vector.push(2);
+	vector.remove(a);
+
+	ASSERT_TRUE(vector.find(a) == vector.end());
+	ASSERT_TRUE(vector.find(b) != vector.end());
+
+	PagedIndexedVector<int, 4>::Id c = vector.push(3);
+	ASSERT_EQ(c.uiIndex, a.uiIndex);
+	ASSERT_NE(c.uiVersion, a.uiVersion);
+	ASSERT_EQ(vector.pageCount(), 1u);
+}
+
+TEST(PagedIndexedVector, IteratesActiveElementsOnly)
+{
+	PagedIndexedVector<int, 2> vector;
+
+	PagedIndexedVector<int, 2>::Id a = vector.push(1);
+	vector.push(2);
+	PagedIndexedVector<int, 2>::Id c = vector.push(3);
+	vector.push(4);
+	vector.remove(a);
+	vector.remove(c);
+
+	int iSum = 0;
+	for (int i : vector)
+	{
+		iSum += i;
+	}
+
+	ASSERT_EQ(iSum, 6);
+}
+
+TEST(PagedIndexedVector, MoveLeavesSourceEmpty)
+{
+	PagedIndexedVector<int, 4> source;
+	PagedIndexedVector<int, 4>::Id id = source.push(5);
+
+	PagedIndexedVector<int, 4> target(std::move(source));
+
+	ASSERT_EQ(source.capacity(), 0u);
+	ASSERT_TRUE(source.isEmpty());
+	ASSERT_EQ(*target.find(id), 5);
+}
@@ -0,0 +1,214 @@
+#include "Engine/System/Tools/RandomEngines.h"
+#include "Engine/System/Tools/RandomNumberGenerator.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+static_assert(IsRandomRealType<float>::value && !IsRandomRealType<int>::value,
+	"Unexpected real type traits.");
+static_assert(IsRandomIntType<std::uint64_t>::value && !IsRandomIntType<char>::value &&
+	!IsRandomIntType<bool>::value && !IsRandomIntType<float>::value,
+	"Unexpected integer type traits.");
+
+namespace
+{
+	template <typename Engine>
+	void checkGenerator()
+	{
+		RandomNumberGenerator<int, Engine> generator(Bounds<int>(-5, 5), 1234);
+		RandomNumberGenerator<int, Engine> same(Bounds<int>(-5, 5), 1234);
+		RandomNumberGenerator<double, Engine> real(Bounds<double>(0.0, 1.0), 1234);
+
+		int iCounts[11] = {};
+		for (int i = 0; i < 11000; ++i)
+		{
+			const int iValue = generator.next();
+			ASSERT_GE(iValue, -5);
+			ASSERT_LE(iValue, 5);
+			ASSERT_EQ(iValue, same.next());
+			++iCounts[iValue + 5];
+
+			const double fValue = real.next();
+			ASSERT_GE(fValue, 0.0);
+			ASSERT_LT(fValue, 1.0);
+		}
+
+		for (const int iCount : iCounts)
+		{
+			ASSERT_GT(iCount, 800);
+			ASSERT_LT(iCount, 1200);
+		}
+
+		// Reseeding restarts the sequence
+		generator.seed(99);
+		same.seed(99);
+		ASSERT_EQ(generator.next(), same.next());
+	}
+}
+
+TEST(RandomEngines, MatchReferenceSequences)
+{
+	SplitMix64Engine splitMix(0);
+	ASSERT_EQ(splitMix(), 0xE220A8397B1DCDAFull);
+	ASSERT_EQ(splitMix(), 0x6E789E6AA1B965F4ull);
+	ASSERT_EQ(splitMix(), 0x06C45D188009454Full);
+
+	Pcg64Engine pcg(42, 54);
+	ASSERT_EQ(pcg(), 0x86B1DA1D72062B68ull);
+	ASSERT_EQ(pcg(), 0x1304AA46C9853D39ull);
+	ASSERT_EQ(pcg(), 0xA3670E9E0DD50358ull);
+
+	// Streams and jumps give unrelated sequences
+	Pcg64Engine otherStream(42, 55);
+	Xoshiro256StarStarEngine xoshiro(42);
+	Xoshiro256StarStarEngine jumped(42);
+	jumped.jump();
+	for (int i = 0; i < 100; ++i)
+	{
+		ASSERT_NE(pcg(), otherStream());
+		ASSERT_NE(xoshiro(), jumped());
+	}
+}
+
+TEST(RandomNumberGenerator, GeneratesWithinBoundsForEachEngine)
+{
+	checkGenerator<SplitMix64Engine>();
+	checkGenerator<Xoshiro256StarStarEngine>();
+	checkGenerator<Pcg64Engine>();
+	checkGenerator<Philox4x32Engine>();
+	checkGenerator<std::mt19937_64>();
+
+	ASSERT_LE(sizeof(RandomFloatGenerator), 48u);
+}
+
+TEST(RandomEngines, InterleavesLanesInBulk)
+{
+	// Lane 0 matches the single stream engine, and bulk fills continue the same sequence
+	Xoshiro256StarStarX4Engine bulk(7);
+	Xoshiro256StarStarX4Engine single(7);
+	Xoshiro256StarStarEngine firstLane(7);
+	Xoshiro256StarStarEngine secondLane(7);
+	secondLane.jump();
+
+	std::vector<std::uint64_t> values(1003);
+	size_t uiFilled = 0;
+	for (const size_t uiCount : { 1, 6, 0, 993, 3 })
+	{
+		bulk.fill(values.data() + uiFilled, uiCount);
+		uiFilled += uiCount;
+	}
+
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		ASSERT_EQ(values[i], single());
+		if (i % 4 == 0)
+		{
+			ASSERT_EQ(values[i], firstLane());
+		}
+		else if (i % 4 == 1)
+		{
+			ASSERT_EQ(values[i], secondLane());
+		}
+	}
+}
+
+TEST(RandomNumberGenerator, FillsWithinBounds)
+{
+	RandomFloatBulkGenerator floats(Bounds<float>(-1.0f, 1.0f), 5);
+	const std::vector<float> floatValues = floats.generate(10000);
+	double fSum = 0.0;
+	for (const float fValue : floatValues)
+	{
+		ASSERT_GE(fValue, -1.0f);
+		ASSERT_LT(fValue, 1.0f);
+		fSum += fValue;
+	}
+
+	ASSERT_NEAR(fSum / floatValues.size(), 0.0, 0.05);
+
+	RandomIntBulkGenerator ints(Bounds<int>(-5, 5), 5);
+	int iCounts[11] = {};
+	for (const int iValue : ints.generate(11000))
+	{
+		ASSERT_GE(iValue, -5);
+		ASSERT_LE(iValue, 5);
+		++iCounts[iValue + 5];
+	}
+
+	for (const int iCount : iCounts)
+	{
+		ASSERT_GT(iCount, 800);
+		ASSERT_LT(iCount, 1200);
+	}
+
+	// Ranges too wide for 32 bits, and the full range, on a single stream engine
+	RandomNumberGenerator<std::int64_t> wide(Bounds<std::int64_t>(-(1ll << 40), 1ll << 40), 5);
+	RandomUint64Generator full(Bounds<std::uint64_t>(0, ~0ull), 5);
+	Xoshiro256StarStarEngine engine(5);
+	std::int64_t iWide[64];
+	std::uint64_t uiFull[64];
+	wide.fill(iWide, 64);
+	full.fill(uiFull, 64);
+	bool bNegative = false;
+	for (size_t i = 0; i < 64; ++i)
+	{
+		ASSERT_GE(iWide[i], -(1ll << 40));
+		ASSERT_LE(iWide[i], 1ll << 40);
+		bNegative |= iWide[i] < 0;
+		ASSERT_EQ(uiFull[i], engine());
+	}
+
+	ASSERT_TRUE(bNegative);
+}
+
+TEST(RandomEngines, CountsThroughPhiloxStreams)
+{
+	// Known answers from the Random123 reference implementation
+	const std::uint32_t uiCounter[4] = { 0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u };
+	const std::uint32_t uiKey[2] = { 0xA4093822u, 0x299F31D0u };
+	std::uint32_t uiResult[4];
+	Philox4x32Engine::generateBlock(uiCounter, uiKey, uiResult);
+	ASSERT_EQ(uiResult[0], 0xD16CFE09u);
+	ASSERT_EQ(uiResult[1], 0x94FDCCEBu);
+	ASSERT_EQ(uiResult[2], 0x5001E420u);
+	ASSERT_EQ(uiResult[3], 0x24126EA1u);
+
+	const std::uint32_t uiZero[4] = {};
+	Philox4x32Engine::generateBlock(uiZero, uiZero, uiResult);
+	ASSERT_EQ(uiResult[0], 0x6627E8D5u);
+	ASSERT_EQ(uiResult[3], 0x9B00DBD8u);
+
+	// Each value depends only on the seed, stream and index
+	Philox4x32Engine engine(11, 3);
+	for (std::uint64_t i = 0; i < 100; ++i)
+	{
+		ASSERT_EQ(engine.getPosition(), i);
+		ASSERT_EQ(engine(), Philox4x32Engine::generate(11, 3, i));
+	}
+
+	engine.setPosition(1ull << 40);
+	ASSERT_EQ(engine(), Philox4x32Engine::generate(11, 3, 1ull << 40));
+	engine.discard(2);
+	ASSERT_EQ(engine(), Philox4x32Engine::generate(11, 3, (1ull << 40) + 3));
+	ASSERT_NE(Philox4x32Engine::generate(11, 3, 0), Philox4x32Engine::generate(11, 4, 0));
+	ASSERT_NE(Philox4x32Engine::generate(11, 3, 0), Philox4x32Engine::generate(12, 3, 0));
+
+	// Dividing a stream between jobs gives the same numbers however it is split
+	RandomNumberGenerator<float, Philox4x32Engine> whole(Bounds<float>(0.0f, 10.0f), 11);
+	const std::vector<float> expected = whole.generate(1001);
+	for (const size_t uiJobSize : { 1, 2, 7, 64, 1001 })
+	{
+		std::vector<float> values(expected.size());
+		for (size_t uiStart = 0; uiStart < values.size(); uiStart += uiJobSize)
+		{
+			RandomNumberGenerator<float, Philox4x32Engine> job(Bounds<float>(0.0f, 10.0f), 11);
+			job.getEngine().setPosition(uiStart);
+			job.fill(values.data() + uiStart, std::min(uiJobSize, values.size() - uiStart));
+		}
+
+		ASSERT_EQ(values, expected);
+	}
+}
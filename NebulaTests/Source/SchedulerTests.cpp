@@ -0,0 +1,211 @@
+#include "Engine/System/Memory/AllocationCounter.h"
+#include "Engine/System/Memory/FrameAllocator.h"
+#include "Engine/System/Schedule/Scheduler.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	class CountingItem :
+		public ScheduledItem
+	{
+		public:
+			CountingItem(std::uint64_t uiNumFrames, std::uint64_t uiAllocateFrom,
+				std::uint64_t uiAllocateUntil) :
+				m_uiNumFrames(uiNumFrames),
+				m_uiAllocateFrom(uiAllocateFrom),
+				m_uiAllocateUntil(uiAllocateUntil),
+				m_uiFrame(0)
+			{
+			}
+
+			void onUpdate(const SchedulerTimeInfo& info) override
+			{
+				if (m_uiFrame >= m_uiAllocateFrom && m_uiFrame < m_uiAllocateUntil)
+				{
+					m_allocations.push_back(std::unique_ptr<int>(new int(0)));
+				}
+
+				if (++m_uiFrame == m_uiNumFrames)
+				{
+					m_bRequestingSchedulerStop = true;
+				}
+			}
+
+		private:
+			std::uint64_t m_uiNumFrames;
+			std::uint64_t m_uiAllocateFrom;
+			std::uint64_t m_uiAllocateUntil;
+			std::uint64_t m_uiFrame;
+			std::vector<std::unique_ptr<int>> m_allocations;
+	};
+
+	class EventCounter :
+		public SchedulerListener
+	{
+		public:
+			EventCounter() :
+				m_uiNumAllocatedEvents(0)
+			{
+			}
+
+			void onSchedulerEvent(const SchedulerEvent& schedulerEvent) override
+			{
+				m_uiNumAllocatedEvents +=
+					schedulerEvent.type == SchedulerEventTypes::SCHEDULER_FRAME_ALLOCATED ? 1 : 0;
+			}
+
+			std::uint64_t m_uiNumAllocatedEvents;
+	};
+
+	SchedulerConfig checkingConfig(std::uint32_t uiWarmUpFrames)
+	{
+		SchedulerConfig config;
+		config.updateRate = SchedulerRate(SchedulerRatePresets::UNLIMITED);
+		config.bRefuseStopRequests = false;
+		config.bCheckFrameAllocations = true;
+		config.uiAllocationWarmUpFrames = uiWarmUpFrames;
+		return config;
+	}
+}
+
+TEST(Scheduler, ChecksFramesAllocateNothingAfterWarmUp)
+{
+	if (!AllocationCounter::isEnabled())
+	{
+		return;
+	}
+
+	// Allocating during warm up is allowed. The item stops the scheduler on its last frame,
+	// which takes effect the frame after
+	Scheduler quiet(checkingConfig(10));
+	CountingItem warmUpOnly(50, 0, 10);
+	quiet.reserve(1, 1);
+	quiet.addScheduledItem(&warmUpOnly, SchedulerRate(SchedulerRatePresets::UNLIMITED));
+	quiet.start();
+	ASSERT_EQ(quiet.getExecutionData().uiFramesExecuted, 51u);
+	ASSERT_EQ(quiet.getExecutionData().uiFramesAllocating, 0u);
+
+	// The vector may grow as well, so a frame makes at least one allocation
+	Scheduler noisy(checkingConfig(10));
+	EventCounter listener;
+	CountingItem allocating(50, 30, 50);
+	noisy.addSchedulerListener(&listener);
+	noisy.addScheduledItem(&allocating, SchedulerRate(SchedulerRatePresets::UNLIMITED));
+	noisy.start();
+	ASSERT_EQ(noisy.getExecutionData().uiFramesAllocating, 20u);
+	ASSERT_GE(noisy.getExecutionData().uiFrameAllocations, 20u);
+	ASSERT_EQ(listener.m_uiNumAllocatedEvents, 20u);
+}
+
+TEST(Scheduler, ReleasesFrameMemoryEachFrame)
+{
+	class ScratchItem :
+		public ScheduledItem
+	{
+		public:
+			ScratchItem() :
+				m_uiFrame(0),
+				m_uiMostUsed(0)
+			{
+			}
+
+			void onUpdate(const SchedulerTimeInfo& info) override
+			{
+				FrameVector<int> scratch{ FrameAllocator<int>(*info.frameMemory.pFrameArena) };
+				scratch.assign(100, 1);
+				m_uiMostUsed = std::max(m_uiMostUsed, info.frameMemory.pFrameArena->getUsed());
+
+				if (++m_uiFrame == 20)
+				{
+					m_bRequestingSchedulerStop = true;
+				}
+			}
+
+			std::uint64_t m_uiFrame;
+			size_t m_uiMostUsed;
+	};
+
+	FrameArena frameArena(4096);
+	FrameMemory frameMemory;
+	frameMemory.pFrameArena = &frameArena;
+
+	SchedulerConfig config;
+	config.updateRate = SchedulerRate(SchedulerRatePresets::UNLIMITED);
+	config.bRefuseStopRequests = false;
+
+	Scheduler scheduler(config);
+	ScratchItem item;
+	scheduler.setFrameMemory(frameMemory);
+	scheduler.addScheduledItem(&item, SchedulerRate(SchedulerRatePresets::UNLIMITED));
+	scheduler.start();
+
+	// Twenty frames of scratch only ever fill one frame's worth
+	ASSERT_EQ(item.m_uiFrame, 20u);
+	ASSERT_GE(item.m_uiMostUsed, 100 * sizeof(int));
+	ASSERT_LT(item.m_uiMostUsed, 2 * 100 * sizeof(int));
+	ASSERT_EQ(frameArena.getOverflowBytes(), 0u);
+}
+
+TEST(Scheduler, HandsItemsTheTaskSystem)
+{
+	class FanOutItem :
+		public ScheduledItem
+	{
+		public:
+			FanOutItem() :
+				m_uiFrame(0),
+				m_iSum(0)
+			{
+			}
+
+			void onUpdate(const SchedulerTimeInfo& info) override
+			{
+				// Workers build their part of the sum in their own frame arenas
+				info.pTaskSystem->parallelFor(1000, 50, [this, &info](size_t uiBegin, size_t uiEnd)
+				{
+					FrameArena& arena = info.frameMemory.pThreadArenas->local();
+					FrameVector<int> values{ FrameAllocator<int>(arena) };
+					values.assign(uiEnd - uiBegin, 1);
+					for (const int iValue : values)
+					{
+						m_iSum += iValue;
+					}
+				});
+
+				if (++m_uiFrame == 10)
+				{
+					m_bRequestingSchedulerStop = true;
+				}
+			}
+
+			std::uint64_t m_uiFrame;
+			std::atomic<int> m_iSum;
+	};
+
+	ThreadFrameArenas threadArenas;
+	threadArenas.reserve(4096);
+	FrameMemory frameMemory;
+	frameMemory.pThreadArenas = &threadArenas;
+
+	TaskSystem taskSystem;
+	taskSystem.start(2, 64, 1, false);
+
+	SchedulerConfig config;
+	config.updateRate = SchedulerRate(SchedulerRatePresets::UNLIMITED);
+	config.bRefuseStopRequests = false;
+
+	Scheduler scheduler(config);
+	FanOutItem item;
+	scheduler.setFrameMemory(frameMemory);
+	scheduler.setTaskSystem(&taskSystem);
+	scheduler.addScheduledItem(&item, SchedulerRate(SchedulerRatePresets::UNLIMITED));
+	scheduler.start();
+
+	ASSERT_EQ(item.m_iSum, 10 * 1000);
+	ASSERT_GE(threadArenas.getNumArenas(), 1u);
+}
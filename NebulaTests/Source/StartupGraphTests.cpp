@@ -0,0 +1,250 @@
+#include "Engine/System/Memory/AllocationCounter.h"
+#include "Engine/System/Schedule/StartupGraph.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	class Recorder
+	{
+		public:
+			StartupGraph::TaskFunction record(int iTask, bool bResult = true)
+			{
+				return [this, iTask, bResult]()
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_order.push_back(iTask);
+					return bResult;
+				};
+			}
+
+			std::vector<int> take()
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				std::vector<int> order;
+				order.swap(m_order);
+				return order;
+			}
+
+		private:
+			std::mutex m_mutex;
+			std::vector<int> m_order;
+	};
+
+	size_t positionOf(const std::vector<int>& order, int iTask)
+	{
+		return std::find(order.begin(), order.end(), iTask) - order.begin();
+	}
+}
+
+TEST(StartupGraph, StartsInDependencyOrder)
+{
+	for (const size_t uiNumThreads : { 1u, 4u })
+	{
+		Recorder startUps;
+		Recorder shutDowns;
+		StartupGraph graph;
+
+		// 0 -> 1, 2 -> 3, with 4 independent
+		const StartupTaskId a = graph.addTask("a", startUps.record(0), shutDowns.record(0));
+		const StartupTaskId b = graph.addTask("b", startUps.record(1), shutDowns.record(1), { a });
+		const StartupTaskId c = graph.addTask("c", startUps.record(2), shutDowns.record(2), { a });
+		graph.addTask("d", startUps.record(3), shutDowns.record(3), { b, c });
+		graph.addTask("e", startUps.record(4), shutDowns.record(4));
+
+		ASSERT_TRUE(graph.startUp(uiNumThreads));
+		const std::vector<int> started = startUps.take();
+		ASSERT_EQ(started.size(), 5u);
+		ASSERT_LT(positionOf(started, 0), positionOf(started, 1));
+		ASSERT_LT(positionOf(started, 0), positionOf(started, 2));
+		ASSERT_LT(positionOf(started, 1), positionOf(started, 3));
+		ASSERT_LT(positionOf(started, 2), positionOf(started, 3));
+
+		// Already started tasks are not started again
+		ASSERT_TRUE(graph.startUp(uiNumThreads));
+		ASSERT_TRUE(startUps.take().empty());
+
+		ASSERT_TRUE(graph.shutDown(uiNumThreads));
+		const std::vector<int> shutDown = shutDowns.take();
+		ASSERT_EQ(shutDown.size(), 5u);
+		ASSERT_LT(positionOf(shutDown, 3), positionOf(shutDown, 1));
+		ASSERT_LT(positionOf(shutDown, 3), positionOf(shutDown, 2));
+		ASSERT_LT(positionOf(shutDown, 1), positionOf(shutDown, 0));
+		ASSERT_LT(positionOf(shutDown, 2), positionOf(shutDown, 0));
+
+		if (uiNumThreads == 1)
+		{
+			ASSERT_EQ(started, std::vector<int>({ 0, 1, 2, 3, 4 }));
+			ASSERT_EQ(shutDown, std::vector<int>({ 4, 3, 2, 1, 0 }));
+		}
+
+		for (size_t i = 0; i < graph.getNumTasks(); ++i)
+		{
+			ASSERT_FALSE(graph.isStarted(i));
+		}
+	}
+}
+
+TEST(StartupGraph, StartsIndependentTasksConcurrently)
+{
+	std::atomic<int> iRunning(0);
+	std::atomic<int> iMostRunning(0);
+	auto slowTask = [&]()
+	{
+		const int iNow = ++iRunning;
+		int iMost = iMostRunning.load();
+		while (iNow > iMost && !iMostRunning.compare_exchange_weak(iMost, iNow))
+		{
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		--iRunning;
+		return true;
+	};
+
+	StartupGraph graph;
+	for (int i = 0; i < 4; ++i)
+	{
+		graph.addTask("slow", slowTask);
+	}
+
+	ASSERT_TRUE(graph.startUp(4));
+	ASSERT_GT(iMostRunning.load(), 1);
+
+	iMostRunning = 0;
+	graph.clear();
+	for (int i = 0; i < 4; ++i)
+	{
+		graph.addTask("slow", slowTask);
+	}
+
+	ASSERT_TRUE(graph.startUp(1));
+	ASSERT_EQ(iMostRunning.load(), 1);
+}
+
+TEST(StartupGraph, SkipsDependentsOfFailedTasks)
+{
+	Recorder startUps;
+	Recorder shutDowns;
+	StartupGraph graph;
+
+	const StartupTaskId a = graph.addTask("a", startUps.record(0), shutDowns.record(0));
+	const StartupTaskId b = graph.addTask("b", startUps.record(1, false), shutDowns.record(1),
+		{ a });
+	const StartupTaskId c = graph.addTask("c", startUps.record(2), shutDowns.record(2), { b });
+	const StartupTaskId d = graph.addTask("d", startUps.record(3), shutDowns.record(3));
+
+	ASSERT_FALSE(graph.startUp(2));
+	std::vector<int> started = startUps.take();
+	std::sort(started.begin(), started.end());
+	ASSERT_EQ(started, std::vector<int>({ 0, 1, 3 }));
+	ASSERT_TRUE(graph.isStarted(a));
+	ASSERT_FALSE(graph.isStarted(b));
+	ASSERT_FALSE(graph.isStarted(c));
+	ASSERT_TRUE(graph.isStarted(d));
+	ASSERT_EQ(graph.getName(b), "b");
+
+	// Only started tasks are shut down
+	ASSERT_TRUE(graph.shutDown(2));
+	std::vector<int> shutDown = shutDowns.take();
+	std::sort(shutDown.begin(), shutDown.end());
+	ASSERT_EQ(shutDown, std::vector<int>({ 0, 3 }));
+}
+
+TEST(StartupGraph, ShutsDownDependenciesOfFailedShutDowns)
+{
+	Recorder shutDowns;
+	StartupGraph graph;
+
+	const StartupTaskId a = graph.addTask("a", []() { return true; }, shutDowns.record(0));
+	graph.addTask("b", []() { return true; }, shutDowns.record(1, false), { a });
+
+	ASSERT_TRUE(graph.startUp(1));
+	ASSERT_FALSE(graph.shutDown(1));
+	ASSERT_EQ(shutDowns.take(), std::vector<int>({ 1, 0 }));
+	ASSERT_FALSE(graph.isStarted(a));
+}
+
+TEST(StartupGraph, RecordsTimings)
+{
+	std::vector<std::unique_ptr<int>> allocations;
+	StartupGraph graph;
+	const StartupTaskId a = graph.addTask("allocates", [&]()
+	{
+		for (int i = 0; i < 10; ++i)
+		{
+			allocations.push_back(std::unique_ptr<int>(new int(i)));
+		}
+
+		return true;
+	});
+
+	graph.addTask("sleeps", []()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		return true;
+	},
+	[]()
+	{
+		return false;
+	},
+	{ a });
+
+	ASSERT_TRUE(graph.startUp(2));
+	ASSERT_EQ(graph.getTimings().size(), 2u);
+
+	const StartupTiming& allocates = graph.getTimings()[0];
+	ASSERT_EQ(allocates.sName, "allocates");
+	ASSERT_TRUE(allocates.bStartUp);
+	ASSERT_TRUE(allocates.bSucceeded);
+	if (AllocationCounter::isEnabled())
+	{
+		// The vector also allocates as it grows
+		ASSERT_GE(allocates.uiAllocations, 10u);
+		ASSERT_GE(allocates.uiAllocatedBytes, 10 * sizeof(int));
+	}
+
+	const StartupTiming& sleeps = graph.getTimings()[1];
+	ASSERT_EQ(sleeps.sName, "sleeps");
+	ASSERT_GE(sleeps.dWallSeconds, 0.015);
+	ASSERT_LT(sleeps.dCpuSeconds, sleeps.dWallSeconds);
+	ASSERT_GE(sleeps.dStartSeconds, allocates.dStartSeconds + allocates.dWallSeconds);
+
+	// Shut down timings are kept alongside the start up ones
+	ASSERT_FALSE(graph.shutDown(2));
+	ASSERT_EQ(graph.getTimings().size(), 4u);
+	ASSERT_EQ(graph.getTimings()[2].sName, "sleeps");
+	ASSERT_FALSE(graph.getTimings()[2].bStartUp);
+	ASSERT_FALSE(graph.getTimings()[2].bSucceeded);
+
+	// Starting again replaces only the start up timings
+	ASSERT_TRUE(graph.startUp(2));
+	ASSERT_EQ(graph.getTimings().size(), 4u);
+	ASSERT_EQ(std::count_if(graph.getTimings().begin(), graph.getTimings().end(),
+		[](const StartupTiming& timing) { return timing.bStartUp; }), 2);
+
+	std::ostringstream report;
+	writeStartupReport(report, graph.getTimings());
+	const std::string sReport = report.str();
+	ASSERT_NE(sReport.find("allocates"), std::string::npos);
+	ASSERT_NE(sReport.find("FAILED"), std::string::npos);
+	ASSERT_EQ(std::count(sReport.begin(), sReport.end(), '\n'), 5);
+
+	std::ostringstream trace;
+	writeStartupTrace(trace, graph.getTimings());
+	ASSERT_EQ(trace.str().find("{\"traceEvents\":["), 0u);
+	ASSERT_NE(trace.str().find("\"name\":\"sleeps\",\"cat\":\"shutdown\",\"ph\":\"X\""),
+		std::string::npos);
+	ASSERT_NE(trace.str().find("\"succeeded\":false"), std::string::npos);
+
+	graph.clear();
+	ASSERT_TRUE(graph.getTimings().empty());
+}
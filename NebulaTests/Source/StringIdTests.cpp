@@ -0,0 +1,44 @@
+#include "Engine/System/Tools/DirectoryListing.h"
+#include "Engine/System/Tools/StringId.h"
+#include "gtest/gtest.h"
+
+#include <string>
+
+TEST(StringId, LiteralAndRuntimeIdsMatch)
+{
+	constexpr StringId literalId("textures");
+	static_assert(StringId("a") != StringId("b"), "Literal ids should differ");
+	static_assert(StringId() == StringId(""), "The default id should be the empty string");
+
+	ASSERT_EQ(literalId, StringId(std::string("textures")));
+	ASSERT_EQ(literalId, NEB_STRING_ID("textures"));
+	ASSERT_NE(literalId, StringId(std::string("texture")));
+
+	// FNV-1a 64 reference value
+	ASSERT_EQ(StringId("a").getHash(), 0xAF63DC4C8601EC8Cull);
+}
+
+TEST(StringId, ReverseLookup)
+{
+	const StringId id = NEB_STRING_ID("sounds");
+	const std::string sHash = StringId::fromHash(1).getString();
+
+	ASSERT_EQ(sHash, "0x0000000000000001");
+	ASSERT_EQ(id, StringId("sounds"));
+
+#ifdef NEB_CONFIG_DEBUG
+	ASSERT_EQ(id.getString(), "sounds");
+#endif
+}
+
+TEST(StringId, UsableAsDirectoryListingKey)
+{
+	DirectoryListing<StringId> listing(DirectoryListing<StringId>::Modes::HASHED);
+	listing.add("textures", "./data/textures/");
+	listing.add("sounds", "./data/sounds/");
+
+	ASSERT_TRUE(listing.freeze());
+	ASSERT_EQ(listing.find("textures").sDirectory, "./data/textures/");
+	ASSERT_EQ(listing.find(StringId(std::string("sounds"))).sDirectory, "./data/sounds/");
+	ASSERT_FALSE(listing.find("models").bFound);
+}
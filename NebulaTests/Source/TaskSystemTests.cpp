@@ -0,0 +1,193 @@
+#include "Engine/System/Thread/TaskSystem.h"
+#include "Engine/System/Tools/IndexedVector.h"
+#include "Engine/System/Tools/ParallelForEach.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	/**
+	Counts the indices of every range it is run over. */
+	void countRange(void* pData, size_t uiBegin, size_t uiEnd)
+	{
+		std::vector<std::atomic<int>>& counts = *static_cast<std::vector<std::atomic<int>>*>(pData);
+		for (size_t i = uiBegin; i < uiEnd; ++i)
+		{
+			++counts[i];
+		}
+	}
+
+	struct Stages
+	{
+		std::atomic<int> iFirstDone;
+		std::atomic<int> iSecondSawFirst;
+
+		Stages() :
+			iFirstDone(0),
+			iSecondSawFirst(0)
+		{
+		}
+	};
+
+	void runFirstStage(void* pData, size_t, size_t)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		++static_cast<Stages*>(pData)->iFirstDone;
+	}
+
+	void runSecondStage(void* pData, size_t, size_t)
+	{
+		Stages& stages = *static_cast<Stages*>(pData);
+		stages.iSecondSawFirst += stages.iFirstDone == 4 ? 1 : 0;
+	}
+}
+
+TEST(WorkStealingDeque, OwnerPopsNewestAndThievesStealOldest)
+{
+	WorkStealingDeque<int> deque(3);
+	ASSERT_EQ(deque.getCapacity(), 4u);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		ASSERT_TRUE(deque.push(i));
+	}
+
+	ASSERT_FALSE(deque.push(4));
+
+	int iItem = -1;
+	ASSERT_TRUE(deque.pop(iItem));
+	ASSERT_EQ(iItem, 3);
+	ASSERT_TRUE(deque.steal(iItem));
+	ASSERT_EQ(iItem, 0);
+	ASSERT_TRUE(deque.pop(iItem));
+	ASSERT_TRUE(deque.pop(iItem));
+	ASSERT_EQ(iItem, 1);
+	ASSERT_FALSE(deque.pop(iItem));
+	ASSERT_FALSE(deque.steal(iItem));
+	ASSERT_TRUE(deque.isEmpty());
+}
+
+TEST(TaskSystem, ParallelForCoversEveryIndexOnce)
+{
+	TaskSystem tasks;
+	ASSERT_TRUE(tasks.start(3, 64, 2, false));
+	ASSERT_FALSE(tasks.start(3, 64, 2, false));
+	ASSERT_EQ(tasks.getNumWorkers(), 3u);
+
+	std::vector<std::atomic<int>> counts(100000);
+	tasks.parallelFor(counts.size(), 100, [&counts](size_t uiBegin, size_t uiEnd)
+	{
+		countRange(&counts, uiBegin, uiEnd);
+	});
+
+	for (const std::atomic<int>& iCount : counts)
+	{
+		ASSERT_EQ(iCount, 1);
+	}
+
+	// Tasks submitted from other threads are run too
+	std::vector<std::atomic<int>> submitted(1000);
+	std::thread other([&tasks, &submitted]()
+	{
+		TaskCounter otherCounter;
+		for (size_t i = 0; i < submitted.size(); ++i)
+		{
+			tasks.submit(&countRange, &submitted, otherCounter, i, i + 1);
+		}
+
+		tasks.wait(otherCounter);
+	});
+
+	other.join();
+	for (const std::atomic<int>& iCount : submitted)
+	{
+		ASSERT_EQ(iCount, 1);
+	}
+
+	tasks.stop();
+	ASSERT_FALSE(tasks.isRunning());
+}
+
+TEST(TaskSystem, RunsDependentsOnceTheirDependencyIsDone)
+{
+	TaskSystem tasks;
+	tasks.start(2, 64, 1, false);
+
+	Stages stages;
+	TaskCounter first;
+	TaskCounter second;
+	for (int i = 0; i < 4; ++i)
+	{
+		tasks.submit(&runFirstStage, &stages, first);
+	}
+
+	tasks.submitAfter(first, &runSecondStage, &stages, second);
+	tasks.submitAfter(first, &runSecondStage, &stages, second);
+	tasks.wait(second);
+
+	ASSERT_TRUE(first.isDone());
+	ASSERT_EQ(stages.iSecondSawFirst, 2);
+}
+
+TEST(TaskSystem, WakesSleepingWorkers)
+{
+	TaskSystem tasks;
+	tasks.start(2, 64, 1, false);
+
+	// Only a worker can run the tasks, as this thread never waits on them
+	for (int i = 0; i < 20; ++i)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+		std::vector<std::atomic<int>> counts(1);
+		TaskCounter counter;
+		tasks.submit(&countRange, &counts, counter, 0, 1);
+
+		const std::chrono::steady_clock::time_point timeout =
+			std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (!counter.isDone() && std::chrono::steady_clock::now() < timeout)
+		{
+			std::this_thread::yield();
+		}
+
+		ASSERT_TRUE(counter.isDone());
+		ASSERT_EQ(counts[0], 1);
+	}
+}
+
+TEST(TaskSystem, RunsTasksInlineWithoutWorkers)
+{
+	TaskSystem tasks;
+	IndexedVector<int> vector;
+	for (int i = 0; i < 5000; ++i)
+	{
+		vector.push(1);
+	}
+
+	std::atomic<int> iSum(0);
+	parallelForEach(tasks, vector, [&iSum](int& iElement)
+	{
+		iSum += iElement;
+	});
+
+	ASSERT_EQ(iSum, 5000);
+
+	// A full ring or deque runs tasks on the submitting thread instead of dropping them
+	tasks.start(1, 1, 1, false);
+	std::vector<std::atomic<int>> counts(64);
+	TaskCounter counter;
+	for (size_t i = 0; i < counts.size(); ++i)
+	{
+		tasks.submit(&countRange, &counts, counter, i, i + 1);
+	}
+
+	tasks.wait(counter);
+	for (const std::atomic<int>& iCount : counts)
+	{
+		ASSERT_EQ(iCount, 1);
+	}
+}
@@ -0,0 +1,95 @@
+#include "Engine/System/File/VirtualFileSystem.h"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	class MemoryFileSource : public VirtualFileSource
+	{
+		public:
+			void add(const std::string& sPath, const std::string& sContents)
+			{
+				m_files[sPath] = sContents;
+			}
+
+			void listFiles(std::vector<std::string>& files) const override
+			{
+				for (const std::pair<const std::string, std::string>& file : m_files)
+				{
+					files.push_back(file.first);
+				}
+			}
+
+			bool read(const std::string& sPath, std::vector<unsigned char>& data) const override
+			{
+				auto it = m_files.find(sPath);
+				if (it == m_files.end())
+				{
+					return false;
+				}
+
+				data.assign(it->second.begin(), it->second.end());
+				return true;
+			}
+
+		private:
+			std::map<std::string, std::string> m_files;
+	};
+
+	std::string readString(const VirtualFileSystem& vfs, const std::string& sPath)
+	{
+		std::vector<unsigned char> data;
+		return vfs.read(sPath, data) ? std::string(data.begin(), data.end()) : "";
+	}
+}
+
+TEST(VirtualFileSystem, HigherPriorityMountsOverride)
+{
+	std::shared_ptr<MemoryFileSource> pBase = std::make_shared<MemoryFileSource>();
+	pBase->add("textures/grass.png", "base grass");
+	pBase->add("textures/rock.png", "base rock");
+
+	std::shared_ptr<MemoryFileSource> pMod = std::make_shared<MemoryFileSource>();
+	pMod->add("textures/grass.png", "mod grass");
+
+	VirtualFileSystem vfs;
+	vfs.mount("data", pBase, 0);
+	const VirtualFileSystem::MountId modId = vfs.mount("./data/", pMod, 10);
+
+	ASSERT_EQ(vfs.getNumFiles(), 2u);
+	ASSERT_EQ(readString(vfs, "data/textures/grass.png"), "mod grass");
+	ASSERT_EQ(readString(vfs, "data\\textures\\rock.png"), "base rock");
+	ASSERT_FALSE(vfs.exists("textures/grass.png"));
+
+	vfs.unmount(modId);
+	ASSERT_EQ(readString(vfs, "data/textures/grass.png"), "base grass");
+
+	// Later mounts at the same priority win
+	std::shared_ptr<MemoryFileSource> pPatch = std::make_shared<MemoryFileSource>();
+	pPatch->add("textures/rock.png", "patched rock");
+	vfs.mount("data", pPatch, 0);
+	ASSERT_EQ(readString(vfs, "data/textures/rock.png"), "patched rock");
+}
+
+TEST(VirtualFileSystem, ResolvesThroughDirectoryListing)
+{
+	std::shared_ptr<MemoryFileSource> pSource = std::make_shared<MemoryFileSource>();
+	pSource->add("sounds/step.wav", "step");
+
+	VirtualFileSystem vfs;
+	vfs.mount("", pSource);
+
+	DirectoryListing<> listing;
+	listing.add("sounds", "./sounds/");
+
+	const VirtualFileLocation* pLocation = vfs.resolve(listing, std::string("sounds"),
+		"step.wav");
+	ASSERT_NE(pLocation, nullptr);
+	ASSERT_EQ(pLocation->pSource, pSource.get());
+	ASSERT_EQ(pLocation->sSourcePath, "sounds/step.wav");
+	ASSERT_EQ(vfs.resolve(listing, std::string("music"), "step.wav"), nullptr);
+}